@@ -0,0 +1,673 @@
+/*
+ * bench - compare utf.c against glibc's iconv, mbrtowc() and mbrtoc16()
+ *
+ * usage: ./bench [-s size] [file...]
+ *
+ * The last workload compares loop_runes() calling the external functions of
+ * libutf.a against the definitions inlined with UTF_INLINE, see inline.c.
+ *
+ * Every file is loaded, stripped of null bytes (utfconv() works on
+ * null-terminated strings) and repeated to at least `size` bytes. Then each
+ * workload runs through every implementation in a child process, so
+ * allocations and peak RSS can be attributed to it. Before timing anything,
+ * the outputs are checked to agree unit by unit on the unrepeated input, which
+ * surfaces differences in the handling of malformed input. Malformed sequences
+ * are replaced by U+FFFD skipping a single byte in the glibc implementations,
+ * which is what utf.c does. The validators stop at the first malformed
+ * sequence, so they are only timed on files all of them find valid.
+ */
+#include <errno.h>
+#include <iconv.h>
+#include <locale.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <uchar.h>
+#include <unistd.h>
+#include <wchar.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "utf.h"
+
+#define MIN_SECONDS 0.25
+
+/* counting allocator, interposed on glibc's */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static size_t alloc_cnt, alloc_bytes;
+
+void *malloc(size_t size)
+{
+	alloc_cnt++;
+	alloc_bytes += size;
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+	alloc_cnt++;
+	alloc_bytes += nmemb * size;
+	return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	alloc_cnt++;
+	alloc_bytes += size;
+	return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr)
+{
+	__libc_free(ptr);
+}
+
+/* output of a workload: code units and their size */
+struct output {
+	void *buf;
+	size_t len;
+	size_t unit;
+};
+
+struct impl {
+	const char *name;
+	size_t (*func)(const char *str, size_t n, struct output *out);
+};
+
+struct workload {
+	const char *name;
+	struct impl impls[4];
+	int valid_only; /* whether to time it only where all find it valid */
+};
+
+static iconv_t to_utf16, to_utf32;
+
+/* convert with iconv, replacing malformed sequences byte by byte */
+static size_t iconv_all(iconv_t cd, const char *str, size_t n, void *dest,
+                        size_t size, size_t unit, int keep)
+{
+	char *in = (char *)str, *out = dest, *scratch = dest;
+	size_t inleft = n, outleft = size, units = 0;
+
+	iconv(cd, NULL, NULL, NULL, NULL);
+	while (inleft) {
+		if (iconv(cd, &in, &inleft, &out, &outleft) != (size_t)-1)
+			break;
+		if (errno == E2BIG && !keep) {
+			units += (out - scratch) / unit;
+			out = scratch;
+			outleft = size;
+			continue;
+		}
+		if (errno != EILSEQ && errno != EINVAL)
+			return (size_t)-1;
+		if (outleft < unit) {
+			units += (out - scratch) / unit;
+			out = scratch;
+			outleft = size;
+		}
+		if (unit == 2) {
+			char16_t c = 0xfffd;
+
+			memcpy(out, &c, unit);
+		} else {
+			char32_t c = 0xfffd;
+
+			memcpy(out, &c, unit);
+		}
+		out += unit;
+		outleft -= unit;
+		in++;
+		inleft--;
+	}
+	return units + (out - scratch) / unit;
+}
+
+static size_t utf_utf16(const char *str, size_t n, struct output *out)
+{
+	int ret = utfconv(&out->buf, UTFCONV_UTF16, str, UTFCONV_UTF8);
+
+	(void)n;
+	out->unit = sizeof(char16_t);
+	return out->len = (ret < 0) ? 0 : ret;
+}
+
+static size_t utf_utf32(const char *str, size_t n, struct output *out)
+{
+	int ret = utfconv(&out->buf, UTFCONV_UTF32, str, UTFCONV_UTF8);
+
+	(void)n;
+	out->unit = sizeof(char32_t);
+	return out->len = (ret < 0) ? 0 : ret;
+}
+
+static size_t iconv_utf16(const char *str, size_t n, struct output *out)
+{
+	out->unit = sizeof(char16_t);
+	out->buf = malloc((n + 1) * out->unit);
+	out->len = iconv_all(to_utf16, str, n, out->buf, n * out->unit,
+	                     out->unit, 1);
+	return out->len;
+}
+
+static size_t iconv_utf32(const char *str, size_t n, struct output *out)
+{
+	out->unit = sizeof(char32_t);
+	out->buf = malloc((n + 1) * out->unit);
+	out->len = iconv_all(to_utf32, str, n, out->buf, n * out->unit,
+	                     out->unit, 1);
+	return out->len;
+}
+
+static size_t mbrtoc16_utf16(const char *str, size_t n, struct output *out)
+{
+	char16_t *dest = malloc((n + 1) * sizeof(*dest));
+	mbstate_t st;
+	size_t i = 0, len = 0;
+
+	memset(&st, 0, sizeof(st));
+	while (i < n) {
+		size_t w = mbrtoc16(&dest[len], str + i, n - i, &st);
+
+		if (w == (size_t)-3) {
+			len++;
+			continue;
+		}
+		if (w == (size_t)-1 || w == (size_t)-2) {
+			memset(&st, 0, sizeof(st));
+			dest[len] = 0xfffd;
+			w = 1;
+		}
+		len++;
+		i += w ? w : 1;
+	}
+	out->buf = dest;
+	out->unit = sizeof(*dest);
+	return out->len = len;
+}
+
+static size_t mbrtowc_utf32(const char *str, size_t n, struct output *out)
+{
+	wchar_t *dest = malloc((n + 1) * sizeof(*dest));
+	mbstate_t st;
+	size_t i = 0, len = 0;
+
+	memset(&st, 0, sizeof(st));
+	while (i < n) {
+		size_t w = mbrtowc(&dest[len], str + i, n - i, &st);
+
+		if (w == (size_t)-1 || w == (size_t)-2) {
+			memset(&st, 0, sizeof(st));
+			dest[len] = 0xfffd;
+			w = 1;
+		}
+		len++;
+		i += w ? w : 1;
+	}
+	out->buf = dest;
+	out->unit = sizeof(*dest);
+	return out->len = len;
+}
+
+static size_t utf_valid(const char *str, size_t n, struct output *out)
+{
+	out->buf = NULL;
+	return out->len = utfnvalid(str, n, NULL);
+}
+
+static size_t iconv_valid(const char *str, size_t n, struct output *out)
+{
+	char scratch[4096], *in = (char *)str;
+	size_t inleft = n;
+
+	out->buf = NULL;
+	iconv(to_utf32, NULL, NULL, NULL, NULL);
+	while (inleft) {
+		char *o = scratch;
+		size_t oleft = sizeof(scratch);
+
+		if (iconv(to_utf32, &in, &inleft, &o, &oleft) != (size_t)-1)
+			break;
+		if (errno != E2BIG)
+			return out->len = 0;
+	}
+	return out->len = 1;
+}
+
+static size_t mbrtowc_valid(const char *str, size_t n, struct output *out)
+{
+	mbstate_t st;
+	size_t i = 0;
+
+	out->buf = NULL;
+	memset(&st, 0, sizeof(st));
+	while (i < n) {
+		size_t w = mbrtowc(NULL, str + i, n - i, &st);
+
+		if (w == (size_t)-1 || w == (size_t)-2)
+			return out->len = 0;
+		i += w ? w : 1;
+	}
+	return out->len = 1;
+}
+
+static size_t utf_count(const char *str, size_t n, struct output *out)
+{
+	(void)n;
+	out->buf = NULL;
+	return out->len = utflen(str);
+}
+
+static size_t iconv_count(const char *str, size_t n, struct output *out)
+{
+	char32_t scratch[1024];
+
+	out->buf = NULL;
+	return out->len = iconv_all(to_utf32, str, n, scratch, sizeof(scratch),
+	                            sizeof(*scratch), 0);
+}
+
+static size_t mbrlen_count(const char *str, size_t n, struct output *out)
+{
+	mbstate_t st;
+	size_t i = 0, len = 0;
+
+	out->buf = NULL;
+	memset(&st, 0, sizeof(st));
+	while (i < n) {
+		size_t w = mbrlen(str + i, n - i, &st);
+
+		if (w == (size_t)-1 || w == (size_t)-2) {
+			memset(&st, 0, sizeof(st));
+			w = 1;
+		}
+		len++;
+		i += w ? w : 1;
+	}
+	return out->len = len;
+}
+
+/* in inline.c */
+size_t recode_inline(const char *str, size_t n, char *dest);
+
+static size_t recode_extern(const char *str, size_t n, struct output *out)
+{
+	char *dest = malloc(n * UTFmax + 1);
+	size_t i, len = 0;
+	Rune rune;
+
+	loop_runes(i, rune, str, n, {
+		len += runetochar(dest + len, &rune);
+	});
+	out->buf = dest;
+	out->unit = 1;
+	return out->len = len;
+}
+
+static size_t recode_inlined(const char *str, size_t n, struct output *out)
+{
+	out->buf = malloc(n * UTFmax + 1);
+	out->unit = 1;
+	return out->len = recode_inline(str, n, out->buf);
+}
+
+static size_t mbrtowc_recode(const char *str, size_t n, struct output *out)
+{
+	char *dest = malloc(n * UTFmax + 1);
+	mbstate_t st, wst;
+	size_t i = 0, len = 0;
+	wchar_t wc;
+
+	memset(&st, 0, sizeof(st));
+	memset(&wst, 0, sizeof(wst));
+	while (i < n) {
+		size_t w = mbrtowc(&wc, str + i, n - i, &st);
+
+		if (w == (size_t)-1 || w == (size_t)-2) {
+			memset(&st, 0, sizeof(st));
+			wc = 0xfffd;
+			w = 1;
+		}
+		len += wcrtomb(dest + len, wc, &wst);
+		i += w ? w : 1;
+	}
+	out->buf = dest;
+	out->unit = 1;
+	return out->len = len;
+}
+
+static size_t writer_put(const char *str, size_t n, struct output *out)
+{
+	struct utfwriter wr;
+	char *buf;
+	size_t i, len;
+	Rune rune;
+	FILE *fp = open_memstream(&buf, &len);
+
+	utfwriterfile(&wr, fp, UTFCONV_UTF8);
+	loop_runes(i, rune, str, n, {
+		utfputrune(&wr, rune);
+	});
+	utfwriterfree(&wr);
+	fclose(fp);
+	out->buf = buf;
+	out->unit = 1;
+	return out->len = len;
+}
+
+static size_t fwrite_put(const char *str, size_t n, struct output *out)
+{
+	char *buf, tmp[UTFmax];
+	size_t i, len;
+	Rune rune;
+	FILE *fp = open_memstream(&buf, &len);
+
+	loop_runes(i, rune, str, n, {
+		fwrite(tmp, 1, runetochar(tmp, &rune), fp);
+	});
+	fclose(fp);
+	out->buf = buf;
+	out->unit = 1;
+	return out->len = len;
+}
+
+static size_t utf_escape(const char *str, size_t n, struct output *out)
+{
+	size_t len;
+	char *ret = utfescape(str, n, UTFESCAPE_JSON, NULL, &len);
+
+	/* nothing to free if nothing was escaped */
+	out->buf = (ret != str) ? ret : NULL;
+	out->unit = 1;
+	return out->len = len;
+}
+
+/* validate first, then escape byte by byte, decoding only invalid input */
+static size_t loop_escape(const char *str, size_t n, struct output *out)
+{
+	static const char hex[] = "0123456789abcdef";
+	static const char named[] = {
+		['\b'] = 'b', ['\t'] = 't', ['\n'] = 'n', ['\f'] = 'f',
+		['\r'] = 'r', ['"'] = '"', ['\\'] = '\\'
+	};
+	/* an invalid byte grows to 3, a control character to 6 */
+	char *dest = malloc(n * 6 + 1);
+	int valid = utfnvalid(str, n, NULL);
+	size_t i = 0, len = 0;
+
+	while (i < n) {
+		unsigned char c = str[i];
+		Rune rune;
+		int w;
+
+		if (c < sizeof(named) && named[c]) {
+			dest[len++] = '\\';
+			dest[len++] = named[c];
+		} else if (c < 0x20) {
+			memcpy(dest + len, "\\u00", 4);
+			dest[len + 4] = hex[c >> 4];
+			dest[len + 5] = hex[c & 0xf];
+			len += 6;
+		} else if (c < 0x80 || valid) {
+			dest[len++] = c;
+		} else {
+			/* invalid bytes become U+FFFD one by one */
+			w = charntorune(&rune, str + i, n - i);
+			len += runetochar(dest + len, &rune);
+			i += w;
+			continue;
+		}
+		i++;
+	}
+	out->buf = dest;
+	out->unit = 1;
+	return out->len = len;
+}
+
+static const struct workload workloads[] = {
+	{"utf-8 to utf-16", {
+		{"utfconv", utf_utf16},
+		{"iconv", iconv_utf16},
+		{"mbrtoc16", mbrtoc16_utf16},
+	}, 0},
+	{"utf-8 to utf-32", {
+		{"utfconv", utf_utf32},
+		{"iconv", iconv_utf32},
+		{"mbrtowc", mbrtowc_utf32},
+	}, 0},
+	{"validate", {
+		{"utfnvalid", utf_valid},
+		{"iconv", iconv_valid},
+		{"mbrtowc", mbrtowc_valid},
+	}, 1},
+	{"count runes", {
+		{"utflen", utf_count},
+		{"iconv", iconv_count},
+		{"mbrlen", mbrlen_count},
+	}, 0},
+	{"recode utf-8 rune by rune", {
+		{"extern", recode_extern},
+		{"UTF_INLINE", recode_inlined},
+		{"mbrtowc", mbrtowc_recode},
+	}, 0},
+	{"write utf-8 rune by rune", {
+		{"utfputrune", writer_put},
+		{"fwrite", fwrite_put},
+	}, 0},
+	{"escape json", {
+		{"utfescape", utf_escape},
+		{"loop", loop_escape},
+	}, 0},
+};
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* read a file without its null bytes */
+static char *load(const char *path, size_t *n)
+{
+	FILE *fp = fopen(path, "rb");
+	char *buf = NULL;
+	size_t len = 0, cap = 0, i, j;
+	int c;
+
+	if (!fp) {
+		perror(path);
+		exit(1);
+	}
+	while ((c = getc(fp)) != EOF) {
+		if (len + 1 >= cap) {
+			cap = cap ? cap * 2 : 4096;
+			buf = realloc(buf, cap);
+		}
+		buf[len++] = c;
+	}
+	fclose(fp);
+	for (i = j = 0; i < len; i++) {
+		if (buf[i])
+			buf[j++] = buf[i];
+	}
+	buf[j] = '\0';
+	*n = j;
+	return buf;
+}
+
+/* byte offset in @str of the rune encoded at code unit @idx of the output */
+static size_t offset_of(const char *str, size_t n, size_t unit, size_t idx)
+{
+	size_t off = 0, units;
+	Rune rune;
+	int w;
+
+	while (off < n) {
+		w = charntorune(&rune, str + off, n - off);
+		units = (unit == 2 && rune > 0xffff) ? 2 : 1;
+		if (idx < units)
+			break;
+		idx -= units;
+		off += w;
+	}
+	return off;
+}
+
+/* check that all implementations of a workload produce the same output */
+static int compare(const struct workload *wl, const char *str, size_t n)
+{
+	struct output ref, out;
+	const struct impl *impl;
+	int same = 1;
+
+	wl->impls[0].func(str, n, &ref);
+	for (impl = wl->impls + 1; impl->name; impl++) {
+		size_t i, len;
+
+		impl->func(str, n, &out);
+		len = (out.len < ref.len) ? out.len : ref.len;
+		for (i = 0; ref.buf && out.buf && i < len; i++) {
+			if (memcmp((char *)ref.buf + i * ref.unit,
+			           (char *)out.buf + i * out.unit, ref.unit))
+				break;
+		}
+		if (out.len != ref.len)
+			printf("  %s: %s returns %zu, %s returns %zu\n",
+			       wl->name, wl->impls[0].name, ref.len,
+			       impl->name, out.len);
+		if (ref.buf && out.buf && (i < len || out.len != ref.len))
+			printf("  %s: %s and %s differ from unit %zu, "
+			       "input offset %zu\n", wl->name,
+			       wl->impls[0].name, impl->name, i,
+			       offset_of(str, n, ref.unit, i));
+		same &= !((ref.buf && out.buf && i < len) ||
+		          out.len != ref.len);
+		free(out.buf);
+	}
+	free(ref.buf);
+	return same;
+}
+
+struct result {
+	double secs;
+	size_t iters;
+	size_t allocs;
+	size_t alloc_bytes;
+};
+
+/* time an implementation in a child process */
+static void run(const struct impl *impl, const char *str, size_t n)
+{
+	struct result res = {0, 0, 0, 0};
+	struct rusage ru;
+	int fds[2], status;
+	pid_t pid;
+
+	if (pipe(fds) < 0 || (pid = fork()) < 0) {
+		perror("bench");
+		exit(1);
+	}
+	if (!pid) {
+		struct output out;
+		double start;
+
+		close(fds[0]);
+		alloc_cnt = alloc_bytes = 0;
+		start = now();
+		do {
+			impl->func(str, n, &out);
+			free(out.buf);
+			res.iters++;
+		} while ((res.secs = now() - start) < MIN_SECONDS);
+		res.allocs = alloc_cnt;
+		res.alloc_bytes = alloc_bytes;
+		if (write(fds[1], &res, sizeof(res)) != sizeof(res))
+			_exit(1);
+		_exit(0);
+	}
+	close(fds[1]);
+	if (read(fds[0], &res, sizeof(res)) != sizeof(res))
+		res.iters = 0;
+	close(fds[0]);
+	wait4(pid, &status, 0, &ru);
+	if (!res.iters) {
+		printf("  %-10s failed\n", impl->name);
+		return;
+	}
+	printf("  %-10s %10.1f MB/s %10.1f allocs %10.1f KB/op %10ld KB\n",
+	       impl->name, n * res.iters / res.secs / 1e6,
+	       (double)res.allocs / res.iters,
+	       res.alloc_bytes / 1024.0 / res.iters, ru.ru_maxrss);
+}
+
+int main(int argc, char **argv)
+{
+	static const char *defaults[] = {
+		"../UTF-8-test.txt", "../UTF-8-demo.txt", NULL
+	};
+	const char **files = defaults;
+	size_t size = 16 << 20;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:")) != -1) {
+		if (opt == 's') {
+			size = strtoul(optarg, NULL, 0);
+		} else {
+			fprintf(stderr, "usage: %s [-s size] [file...]\n",
+			        argv[0]);
+			return 1;
+		}
+	}
+	if (optind < argc)
+		files = (const char **)argv + optind;
+	if (!setlocale(LC_CTYPE, "C.UTF-8")) {
+		fprintf(stderr, "bench: no C.UTF-8 locale\n");
+		return 1;
+	}
+	to_utf16 = iconv_open("UTF-16LE", "UTF-8");
+	to_utf32 = iconv_open("UTF-32LE", "UTF-8");
+	if (to_utf16 == (iconv_t)-1 || to_utf32 == (iconv_t)-1) {
+		perror("iconv_open");
+		return 1;
+	}
+	for (; *files; files++) {
+		size_t i, n, len;
+		char *str = load(*files, &n), *big;
+		int same[sizeof(workloads) / sizeof(*workloads)];
+		int valid = utfnvalid(str, n, NULL);
+
+		printf("%s (%zu bytes)\n", *files, n);
+		printf("checking outputs\n");
+		for (i = 0; i < sizeof(workloads) / sizeof(*workloads); i++)
+			same[i] = compare(&workloads[i], str, n);
+		for (len = n; len < size; len += n)
+			/* nothing */;
+		big = malloc(len + 1);
+		for (i = 0; i < len; i += n)
+			memcpy(big + i, str, n);
+		big[len] = '\0';
+		printf("timing on %zu bytes: throughput, allocations per "
+		       "call, allocated per call, peak RSS\n", len);
+		for (i = 0; i < sizeof(workloads) / sizeof(*workloads); i++) {
+			const struct impl *impl;
+
+			printf(" %s\n", workloads[i].name);
+			if (workloads[i].valid_only && !(valid && same[i])) {
+				printf("  not timed, the input is invalid\n");
+				continue;
+			}
+			for (impl = workloads[i].impls; impl->name; impl++)
+				run(impl, big, len);
+		}
+		free(big);
+		free(str);
+	}
+	return 0;
+}
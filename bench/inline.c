@@ -0,0 +1,16 @@
+/* the recoding loop of bench.c, with the utf-8 primitives inlined */
+#define UTF_INLINE
+#include "utf.h"
+
+size_t recode_inline(const char *str, size_t n, char *dest);
+
+size_t recode_inline(const char *str, size_t n, char *dest)
+{
+	size_t i, len = 0;
+	Rune rune;
+
+	loop_runes(i, rune, str, n, {
+		len += runetochar(dest + len, &rune);
+	});
+	return len;
+}
@@ -0,0 +1,157 @@
+#include "utf.h"
+#include "utfint.h"
+
+/* bytes examined when there is no byte order mark */
+#define DETECT_MAX 4096
+
+/* return a word with the high bit set in every null byte */
+static inline uint64_t word_zeros(uint64_t w)
+{
+	return ~(((w & ~WORD_HIGH_BITS) + ~WORD_HIGH_BITS) | w) &
+	       WORD_HIGH_BITS;
+}
+
+/* count the null bytes at every offset modulo 4 */
+static void count_zeros(const unsigned char *s, size_t n, size_t zeros[4])
+{
+	/* masks loaded from bytes don't depend on the host byte order */
+	static const unsigned char lanes[4][8] = {
+		{ 0x80, 0, 0, 0, 0x80, 0, 0, 0 },
+		{ 0, 0x80, 0, 0, 0, 0x80, 0, 0 },
+		{ 0, 0, 0x80, 0, 0, 0, 0x80, 0 },
+		{ 0, 0, 0, 0x80, 0, 0, 0, 0x80 }
+	};
+	uint64_t mask[4];
+	size_t i = 0;
+	int k;
+
+	for (k = 0; k < 4; k++) {
+		mask[k] = load64(lanes[k]);
+		zeros[k] = 0;
+	}
+	for (; i + 8 <= n; i += 8) {
+		uint64_t z = word_zeros(load64(s + i));
+
+		if (!z)
+			continue;
+		for (k = 0; k < 4; k++)
+			zeros[k] += word_cnt(z & mask[k]);
+	}
+	for (; i < n; i++)
+		zeros[i & 3] += !s[i];
+}
+
+/* return 1 if the n bytes at s are valid utf-32 */
+static int valid32(const unsigned char *s, size_t n, int be)
+{
+	size_t i;
+
+	for (i = 0; i + 4 <= n; i += 4) {
+		Rune rune = be ? (Rune)s[i] << 24 | (Rune)s[i + 1] << 16 |
+		                 (Rune)s[i + 2] << 8 | s[i + 3]
+		               : (Rune)s[i + 3] << 24 | (Rune)s[i + 2] << 16 |
+		                 (Rune)s[i + 1] << 8 | s[i];
+
+		if (!validrune(rune))
+			return 0;
+	}
+	return 1;
+}
+
+/* return 1 if the n bytes at s are valid utf-16, possibly cut off */
+static int valid16(const unsigned char *s, size_t n, int be)
+{
+	size_t i;
+
+	for (i = 0; i + 2 <= n; i += 2) {
+		char16_t c = be ? s[i] << 8 | s[i + 1] : s[i + 1] << 8 | s[i];
+
+		if (UTF16_IS_TRAILING(c))
+			return 0;
+		if (!UTF16_IS_LEADING(c))
+			continue;
+		i += 2;
+		if (i + 2 > n)
+			break;
+		c = be ? s[i] << 8 | s[i + 1] : s[i + 1] << 8 | s[i];
+		if (!UTF16_IS_TRAILING(c))
+			return 0;
+	}
+	return 1;
+}
+
+/* return the size of the first n bytes without a rune cut off at the end */
+static size_t utf8_complete(const unsigned char *s, size_t n)
+{
+	size_t i = n;
+
+	while (i > 0 && n - i < UTFmax - 1 && UTF8_IS_TRAILING(s[i - 1]))
+		i--;
+	/* dropping a complete last rune doesn't matter either */
+	return (i > 0 && UTF8_IS_LEADING(s[i - 1])) ? i - 1 : n;
+}
+
+/* guess the encoding of a buffer without a byte order mark */
+static enum utfconv_type detect(const unsigned char *s, size_t n, int cut)
+{
+	size_t zeros[4], even, odd;
+
+	count_zeros(s, n, zeros);
+	even = zeros[0] + zeros[2];
+	odd = zeros[1] + zeros[3];
+
+	/* the high byte of every utf-32 code unit is null */
+	if (n && !(n & 3)) {
+		if (zeros[3] == n / 4 && valid32(s, n, 0))
+			return UTFCONV_UTF32LE;
+		if (zeros[0] == n / 4 && valid32(s, n, 1))
+			return UTFCONV_UTF32BE;
+	}
+	/* mostly latin utf-16 has a null high byte in half the code units */
+	if (odd >= n / 4 && odd > 2 * even && valid16(s, n, 0))
+		return UTFCONV_UTF16LE;
+	if (even >= n / 4 && even > 2 * odd && valid16(s, n, 1))
+		return UTFCONV_UTF16BE;
+
+	if (utfnvalid((const char *)s, cut ? utf8_complete(s, n) : n, NULL))
+		return UTFCONV_UTF8;
+	if (!(n & 1) || cut) {
+		if (valid16(s, n, 0))
+			return UTFCONV_UTF16LE;
+		if (valid16(s, n, 1))
+			return UTFCONV_UTF16BE;
+	}
+	return UTFCONV_UTF8;
+}
+
+enum utfconv_type utfdetect(const void *buf, size_t n, size_t *bomlen)
+{
+	const unsigned char *s = buf;
+	enum utfconv_type type;
+	size_t bom = 0;
+
+	/* the utf-32le byte order mark starts like the utf-16le one */
+	if (n >= 4 && !memcmp(s, "\xff\xfe\0\0", 4)) {
+		type = UTFCONV_UTF32LE;
+		bom = 4;
+	} else if (n >= 4 && !memcmp(s, "\0\0\xfe\xff", 4)) {
+		type = UTFCONV_UTF32BE;
+		bom = 4;
+	} else if (n >= 3 && !memcmp(s, "\xef\xbb\xbf", 3)) {
+		type = UTFCONV_UTF8;
+		bom = 3;
+	} else if (n >= 2 && !memcmp(s, "\xff\xfe", 2)) {
+		type = UTFCONV_UTF16LE;
+		bom = 2;
+	} else if (n >= 2 && !memcmp(s, "\xfe\xff", 2)) {
+		type = UTFCONV_UTF16BE;
+		bom = 2;
+	} else if (n > DETECT_MAX) {
+		type = detect(s, DETECT_MAX, 1);
+	} else {
+		type = detect(s, n, 0);
+	}
+	if (bomlen)
+		*bomlen = bom;
+	return type;
+}
@@ -0,0 +1,449 @@
+#include <stdlib.h>
+#include "utf.h"
+#include "utfint.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* longest escape of a rune, two \uXXXX for a surrogate pair */
+#define ESCAPE_MAX 12
+
+struct escbuf {
+	char *p;
+	size_t len;
+	size_t cap;
+};
+
+static int escbuf_reserve(struct escbuf *b, size_t n)
+{
+	if (b->len + n > b->cap) {
+		size_t cap = (b->cap + n) * 2;
+		char *p = realloc(b->p, cap);
+
+		if (!p)
+			return -1;
+		b->p = p;
+		b->cap = cap;
+	}
+	return 0;
+}
+
+/* return 1 if a byte can't be copied without looking at it */
+static inline int escape_special(unsigned char c, enum utfescape_type type)
+{
+	if (c < 0x20 || c >= 0x80 || c == '"')
+		return 1;
+	if (type == UTFESCAPE_XML)
+		return c == '&' || c == '<' || c == '>' || c == '\'';
+	return c == '\\';
+}
+
+/* return 1 if a word of 8 bytes contains a byte equal to c */
+static inline int word_has(uint64_t w, unsigned char c)
+{
+	w ^= c * WORD_LOW_BITS;
+	return ((w - WORD_LOW_BITS) & ~w & WORD_HIGH_BITS) != 0;
+}
+
+/* return the number of leading bytes that are copied as they are */
+static size_t escape_skip(const char *str, size_t n, enum utfescape_type type)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	/* signed, so bytes from 0x80 are less than 0x20 too */
+	__m128i ctrl = _mm_set1_epi8(0x20), quot = _mm_set1_epi8('"');
+	__m128i c1 = _mm_set1_epi8(type == UTFESCAPE_XML ? '&' : '\\');
+	__m128i c2 = _mm_set1_epi8(type == UTFESCAPE_XML ? '<' : '\\');
+	__m128i c3 = _mm_set1_epi8(type == UTFESCAPE_XML ? '>' : '\\');
+	__m128i c4 = _mm_set1_epi8(type == UTFESCAPE_XML ? '\'' : '\\');
+
+	for (; i + 16 <= n; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(str + i));
+		__m128i m = _mm_or_si128(_mm_cmplt_epi8(v, ctrl),
+		                         _mm_cmpeq_epi8(v, quot));
+		int mask;
+
+		m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, c1),
+		                                 _mm_cmpeq_epi8(v, c2)));
+		m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, c3),
+		                                 _mm_cmpeq_epi8(v, c4)));
+		mask = _mm_movemask_epi8(m);
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+#endif
+	for (; i + 8 <= n; i += 8) {
+		uint64_t w = load64(str + i);
+
+		/* bytes from 0x80, or below 0x20 */
+		if ((w | ((w - 0x20 * WORD_LOW_BITS) & ~w)) & WORD_HIGH_BITS)
+			break;
+		if (word_has(w, '"'))
+			break;
+		if (type != UTFESCAPE_XML && word_has(w, '\\'))
+			break;
+		if (type == UTFESCAPE_XML &&
+		    (word_has(w, '&') || word_has(w, '<') ||
+		     word_has(w, '>') || word_has(w, '\'')))
+			break;
+	}
+	while (i < n && !escape_special(str[i], type))
+		i++;
+	return i;
+}
+
+/* write \uXXXX for a utf-16 code unit */
+static inline int escape_unit(char *buf, char16_t c)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	buf[0] = '\\';
+	buf[1] = 'u';
+	buf[2] = hex[c >> 12];
+	buf[3] = hex[c >> 8 & 0xf];
+	buf[4] = hex[c >> 4 & 0xf];
+	buf[5] = hex[c & 0xf];
+	return 6;
+}
+
+/*
+ * write the escape of a valid rune, return 0 if it needs none and -1 if the
+ * type can't hold it
+ */
+static int escape_rune(char *buf, Rune c, enum utfescape_type type)
+{
+	static const char *const xml[] = {
+		['"'] = "&quot;", ['&'] = "&amp;", ['\''] = "&#39;",
+		['<'] = "&lt;", ['>'] = "&gt;"
+	};
+	static const char json[] = {
+		['\b'] = 'b', ['\t'] = 't', ['\n'] = 'n', ['\f'] = 'f',
+		['\r'] = 'r', ['"'] = '"', ['\\'] = '\\'
+	};
+	char16_t u[2];
+	int n;
+
+	if (type == UTFESCAPE_XML) {
+		/* xml has no escapes for most control characters */
+		if ((c < 0x20 && c != '\t' && c != '\n' && c != '\r') ||
+		    c == 0xfffe || c == 0xffff)
+			return -1;
+		if (c >= Runeself || !xml[c])
+			return 0;
+		n = strlen(xml[c]);
+		memcpy(buf, xml[c], n);
+		return n;
+	}
+	if (c < sizeof(json) && json[c]) {
+		buf[0] = '\\';
+		buf[1] = json[c];
+		return 2;
+	}
+	if (c < 0x20)
+		return escape_unit(buf, c);
+	if (c < Runeself || type != UTFESCAPE_JSON_ASCII)
+		return 0;
+	n = runetochar16(u, &c);
+	escape_unit(buf, u[0]);
+	if (n == 2)
+		escape_unit(buf + 6, u[1]);
+	return n * 6;
+}
+
+char *utfescape(const char *str, size_t n, enum utfescape_type type,
+                const struct utfconv_opts *opts, size_t *len)
+{
+	struct escbuf out = {NULL, 0, 0};
+	Rune repl = opts ? opts->replacement : 0xfffd;
+	int strict = opts && opts->strict;
+	size_t i = 0, done = 0; /* bytes of @str before done are in @out */
+	char esc[ESCAPE_MAX];
+	STAT(uint64_t runes = 0, ascii = 0, replaced = 0);
+
+	if (type > UTFESCAPE_XML || !validrune(repl) ||
+	    escape_rune(esc, repl, type) < 0)
+		return NULL;
+	while (i < n) {
+		size_t skip = escape_skip(str + i, n - i, type);
+		Rune rune;
+		int w = 1, k;
+
+		i += skip;
+		STAT(runes += skip, ascii += skip);
+		if (i == n)
+			break;
+		rune = (unsigned char)str[i];
+		if (rune >= Runeself)
+			w = utf_charntorune(&rune, str + i, n - i, RUNEBAD);
+		STAT(runes++, ascii += rune < 0x80);
+		k = (rune == RUNEBAD) ? -1 : escape_rune(esc, rune, type);
+		if (!k) {
+			i += w;
+			/* stay here for text that's mostly beyond ascii */
+			while (i < n && (unsigned char)str[i] >= Runeself &&
+			       type != UTFESCAPE_JSON_ASCII) {
+				w = utf_charntorune(&rune, str + i, n - i,
+				                    RUNEBAD);
+				if (rune == RUNEBAD || rune == 0xfffe ||
+				    rune == 0xffff)
+					break;
+				i += w;
+				STAT(runes++);
+			}
+			continue;
+		}
+		if (k < 0) {
+			if (strict)
+				goto fail;
+			STAT(replaced++);
+			k = escape_rune(esc, repl, type);
+			if (!k)
+				k = runetochar(esc, &repl);
+		}
+		/* most strings need few escapes */
+		if (!out.p) {
+			out.cap = n + n / 8 + ESCAPE_MAX + 1;
+			out.p = malloc(out.cap);
+		}
+		/* copy what needed no escapes in one go */
+		if (!out.p || escbuf_reserve(&out, i - done + k + 1) < 0)
+			goto fail;
+		memcpy(out.p + out.len, str + done, i - done);
+		out.len += i - done;
+		memcpy(out.p + out.len, esc, k);
+		out.len += k;
+		i += w;
+		done = i;
+	}
+	if (!out.p) {
+		STAT(stats_add(n, runes, ascii, 0, 0));
+		if (len)
+			*len = n;
+		return (char *)str;
+	}
+	if (escbuf_reserve(&out, n - done + 1) < 0)
+		goto fail;
+	memcpy(out.p + out.len, str + done, n - done);
+	out.len += n - done;
+	out.p[out.len] = '\0';
+	STAT(stats_add(n, runes, ascii, replaced, out.cap));
+	if (len)
+		*len = out.len;
+	return out.p;
+fail:
+	free(out.p);
+	return NULL;
+}
+
+/* return the number of leading bytes that are ascii other than c */
+static size_t unescape_skip(const char *str, size_t n, unsigned char c)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	/* signed, so bytes from 0x80 are negative */
+	__m128i zero = _mm_setzero_si128(), pat = _mm_set1_epi8(c);
+
+	for (; i + 16 <= n; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(str + i));
+		int mask = _mm_movemask_epi8(_mm_or_si128(
+			_mm_cmplt_epi8(v, zero), _mm_cmpeq_epi8(v, pat)));
+
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+#endif
+	for (; i + 8 <= n; i += 8) {
+		uint64_t w = load64(str + i);
+
+		if ((w & WORD_HIGH_BITS) || word_has(w, c))
+			break;
+	}
+	while (i < n && (unsigned char)str[i] < 0x80 &&
+	       (unsigned char)str[i] != c)
+		i++;
+	return i;
+}
+
+/* return the value of a hex digit, or -1 */
+static inline int hex_digit(unsigned char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	c |= 0x20;
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return -1;
+}
+
+/* return the value of 4 hex digits, or -1 */
+static inline long hex4(const char *str, size_t n)
+{
+	long u = 0;
+	int i, d;
+
+	if (n < 4)
+		return -1;
+	for (i = 0; i < 4; i++) {
+		if ((d = hex_digit(str[i])) < 0)
+			return -1;
+		u = u << 4 | d;
+	}
+	return u;
+}
+
+/*
+ * read a json escape at str, RUNEBAD if it's malformed or a lone surrogate,
+ * and return the number of bytes consumed
+ */
+static size_t json_escape(Rune *rune, const char *str, size_t n)
+{
+	static const char map[] = {
+		['"'] = '"', ['\\'] = '\\', ['/'] = '/', ['b'] = '\b',
+		['f'] = '\f', ['n'] = '\n', ['r'] = '\r', ['t'] = '\t'
+	};
+	unsigned char c;
+	long hi, lo;
+
+	*rune = RUNEBAD;
+	if (n < 2)
+		return 1;
+	c = str[1];
+	if (c != 'u') {
+		if (c < sizeof(map) && map[c])
+			*rune = map[c];
+		return 2;
+	}
+	if ((hi = hex4(str + 2, n - 2)) < 0)
+		return 2;
+	if (!UTF16_IS_LEADING(hi)) {
+		if (!UTF16_IS_TRAILING(hi))
+			*rune = hi;
+		return 6;
+	}
+	if (n < 12 || str[6] != '\\' || str[7] != 'u' ||
+	    (lo = hex4(str + 8, n - 8)) < 0 || !UTF16_IS_TRAILING(lo))
+		return 6;
+	*rune = 0x10000 + ((hi & 0x3ff) << 10 | (lo & 0x3ff));
+	return 12;
+}
+
+/* read a byte that may be percent-encoded, return 0 if it's malformed */
+static inline size_t percent_byte(unsigned char *b, const char *str, size_t n)
+{
+	int hi, lo;
+
+	if (*str != '%') {
+		*b = *str;
+		return 1;
+	}
+	if (n < 3 || (hi = hex_digit(str[1])) < 0 ||
+	    (lo = hex_digit(str[2])) < 0)
+		return 0;
+	*b = hi << 4 | lo;
+	return 3;
+}
+
+/*
+ * read the bytes of a rune that may be percent-encoded into buf, setting
+ * *len to their number, RUNEBAD if they're invalid, and return the number of
+ * bytes consumed
+ */
+static size_t percent_rune(Rune *rune, char *buf, int *len, const char *str,
+                           size_t n)
+{
+	unsigned char b;
+	size_t first = percent_byte(&b, str, n), w = first;
+	int t, m = 1;
+
+	*rune = RUNEBAD;
+	*len = 0;
+	if (!first)
+		return 1;
+	buf[0] = b;
+	t = utf_trail_cnt(b);
+	while (m <= t && m < UTFmax && w < n) {
+		size_t k = percent_byte(&b, str + w, n - w);
+
+		if (!k || !UTF8_IS_TRAILING(b))
+			break;
+		buf[m++] = b;
+		w += k;
+	}
+	*len = m;
+	/* like charntorune(), only the first byte is invalid */
+	if (utf_charntorune(rune, buf, m, RUNEBAD) != m || *rune == RUNEBAD) {
+		*rune = RUNEBAD;
+		return first;
+	}
+	return w;
+}
+
+int utfunescape(char *dest, size_t size, const char *str, size_t n,
+                enum utfunescape_type type, const struct utfconv_opts *opts,
+                size_t *len)
+{
+	Rune repl = opts ? opts->replacement : 0xfffd;
+	int strict = opts && opts->strict;
+	unsigned char esc = (type == UTFUNESCAPE_JSON) ? '\\' : '%';
+	size_t i = 0, done = 0, o = 0; /* @str up to done is in o bytes */
+	char buf[UTFmax];
+	STAT(uint64_t runes = 0, ascii = 0, replaced = 0);
+
+	if (type > UTFUNESCAPE_PERCENT || !validrune(repl))
+		return -1;
+	while (i < n) {
+		size_t skip = unescape_skip(str + i, n - i, esc), w;
+		Rune rune;
+		int k;
+
+		i += skip;
+		STAT(runes += skip, ascii += skip);
+		if (i == n)
+			break;
+		if (type == UTFUNESCAPE_PERCENT) {
+			w = percent_rune(&rune, buf, &k, str + i, n - i);
+		} else if (str[i] == '\\') {
+			w = json_escape(&rune, str + i, n - i);
+			k = (rune == RUNEBAD) ? 0 : runetochar(buf, &rune);
+		} else {
+			w = utf_charntorune(&rune, str + i, n - i, RUNEBAD);
+			k = w;
+		}
+		STAT(runes++, ascii += rune < 0x80);
+		/* valid runes without escapes stay as they are */
+		if (rune != RUNEBAD && (size_t)k == w) {
+			i += w;
+			continue;
+		}
+		if (rune == RUNEBAD) {
+			if (strict)
+				return -1;
+			STAT(replaced++);
+			k = runetochar(buf, &repl);
+		}
+		if (o + (i - done) + k > size)
+			return -1;
+		if (dest + o != str + done)
+			memmove(dest + o, str + done, i - done);
+		o += i - done;
+		i += w;
+		/* in place, the result can't get ahead of the input */
+		if (dest == str && o + k > i)
+			return -1;
+		memcpy(dest + o, buf, k);
+		o += k;
+		done = i;
+	}
+	if (o + (n - done) > size)
+		return -1;
+	if (dest + o != str + done)
+		memmove(dest + o, str + done, n - done);
+	o += n - done;
+	STAT(stats_add(n, runes, ascii, replaced, 0));
+	if (len)
+		*len = o;
+	return 0;
+}
@@ -0,0 +1,159 @@
+#include <string.h>
+#include "utf.h"
+#include "utfint.h"
+#include "grapheme.h"
+
+/* what has been seen of an emoji zwj sequence */
+enum {
+	EMOJI_NONE,
+	EMOJI_PICT,    /* ExtPict Extend* */
+	EMOJI_PICT_ZWJ /* ExtPict Extend* ZWJ */
+};
+
+struct gstate {
+	int prev;  /* break class of the previous rune */
+	int emoji; /* emoji zwj sequence state */
+	int ri;    /* number of preceding regional indicators */
+};
+
+static inline int gcb(Rune c)
+{
+	return (c <= Runemax) ? gcb_lookup(c) : GCB_Other;
+}
+
+static inline int iscontrol(int p)
+{
+	return p == GCB_Control || p == GCB_CR || p == GCB_LF;
+}
+
+/* return 1 if there is a cluster boundary before a rune of class @p */
+static int isbreak(const struct gstate *s, int p)
+{
+	int prev = s->prev;
+
+	if (prev == GCB_CR && p == GCB_LF)                         /* GB3 */
+		return 0;
+	if (iscontrol(prev) || iscontrol(p))                       /* GB4, GB5 */
+		return 1;
+	if (prev == GCB_L && (p == GCB_L || p == GCB_V || p == GCB_LV ||
+	                      p == GCB_LVT))                       /* GB6 */
+		return 0;
+	if ((prev == GCB_LV || prev == GCB_V) &&
+	    (p == GCB_V || p == GCB_T))                            /* GB7 */
+		return 0;
+	if ((prev == GCB_LVT || prev == GCB_T) && p == GCB_T)      /* GB8 */
+		return 0;
+	if (p == GCB_Extend || p == GCB_ZWJ || p == GCB_SpacingMark ||
+	    prev == GCB_Prepend)                                   /* GB9-GB9b */
+		return 0;
+	if (s->emoji == EMOJI_PICT_ZWJ && p == GCB_ExtPict)        /* GB11 */
+		return 0;
+	if (prev == GCB_Regional_Indicator && p == GCB_Regional_Indicator &&
+	    s->ri % 2)                                             /* GB12, GB13 */
+		return 0;
+	return 1;                                                  /* GB999 */
+}
+
+static void advance(struct gstate *s, int p)
+{
+	if (p == GCB_ExtPict)
+		s->emoji = EMOJI_PICT;
+	else if (p == GCB_Extend && s->emoji == EMOJI_PICT)
+		s->emoji = EMOJI_PICT;
+	else if (p == GCB_ZWJ && s->emoji == EMOJI_PICT)
+		s->emoji = EMOJI_PICT_ZWJ;
+	else
+		s->emoji = EMOJI_NONE;
+	s->ri = (p == GCB_Regional_Indicator) ? s->ri + 1 : 0;
+	s->prev = p;
+}
+
+/* utfgraphemenext(), adding the runes of the cluster and the ascii ones */
+static inline size_t grapheme_next(const char *str, size_t n, size_t *runes,
+                                   size_t *ascii)
+{
+	struct gstate s = {GCB_Other, EMOJI_NONE, 0};
+	size_t i;
+	Rune rune;
+
+	if (!n)
+		return 0;
+	if (UTF8_IS_ASCII(str[0]) && (n == 1 || UTF8_IS_ASCII(str[1]))) {
+		i = (str[0] == '\r' && n > 1 && str[1] == '\n') ? 2 : 1;
+		*runes += i;
+		*ascii += i;
+		return i;
+	}
+	i = charntorune(&rune, str, n);
+	advance(&s, gcb(rune));
+	++*runes;
+	*ascii += rune < 0x80;
+	while (i < n) {
+		int w = charntorune(&rune, str + i, n - i);
+		int p = gcb(rune);
+
+		if (isbreak(&s, p))
+			break;
+		advance(&s, p);
+		i += w;
+		++*runes;
+		*ascii += rune < 0x80;
+	}
+	return i;
+}
+
+size_t utfgraphemenext(const char *str, size_t n)
+{
+	size_t runes = 0, ascii = 0, i = grapheme_next(str, n, &runes, &ascii);
+
+	STAT(stats_add(i, runes, ascii, 0, 0));
+	return i;
+}
+
+/* return the number of CR LF pairs in an ascii string */
+static size_t crlf_cnt(const char *str, size_t n)
+{
+	const char *end = str + n;
+	size_t cnt = 0;
+
+	while ((str = memchr(str, '\r', end - str)) && ++str < end) {
+		if (*str == '\n')
+			cnt++;
+	}
+	return cnt;
+}
+
+size_t utfgraphemelen(const char *str, size_t n)
+{
+	size_t len = 0, runes = 0, ascii = 0;
+	STAT(size_t units = n);
+
+	while (n) {
+		size_t w = ascii_span(str, n);
+
+		if (w == n) {
+			len += w - crlf_cnt(str, w);
+			STAT(runes += w, ascii += w);
+			break;
+		}
+		/*
+		 * Every ascii byte is a cluster of its own, except for CR LF and
+		 * the last one, which might be followed by a combining mark.
+		 */
+		if (w > 1) {
+			w--;
+			if (str[w - 1] == '\r' && str[w] == '\n')
+				w--;
+			len += w - crlf_cnt(str, w);
+			str += w;
+			n -= w;
+			STAT(runes += w, ascii += w);
+		}
+		w = grapheme_next(str, n, &runes, &ascii);
+		str += w;
+		n -= w;
+		len++;
+	}
+	STAT(stats_add(units, runes, ascii, 0, 0));
+	return len;
+}
@@ -0,0 +1,402 @@
+#!/usr/bin/env perl
+#
+# mktables.pl - generate the unicode lookup tables used by libutf
+#
+# usage: perl mktables.pl <table> > <table>.h
+#
+# The data is taken from the UCD shipped with perl (Unicode::UCD), so no
+# network access or separate download is needed. Every table is emitted as a
+# multi-stage lookup: the rune's high bits select a block, the low bits index
+# into it. Identical blocks are shared, and the index itself is split the same
+# way if that pays off. Block sizes are chosen to keep the combined size of
+# all stages minimal.
+
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap prop_invlist prop_value_aliases);
+use Unicode::Normalize qw(getCanon getCompat getCombinClass);
+
+my $RUNEMAX = 0x10ffff;
+
+# expand a property to one value per code point
+sub expand
+{
+	my ($prop, $conv) = @_;
+	my ($list, $map, $format, $default) = prop_invmap($prop);
+	my @v;
+
+	die "unknown property $prop\n" unless $list;
+	for my $i (0 .. $#$list) {
+		my $start = $list->[$i];
+		my $end = $i < $#$list ? $list->[$i + 1] - 1 : $RUNEMAX;
+
+		last if $start > $RUNEMAX;
+		$end = $RUNEMAX if $end > $RUNEMAX;
+		for my $c ($start .. $end) {
+			my $val = $map->[$i];
+
+			if ($format =~ /^a/ && $val =~ /^-?\d+$/ && $val ne $default) {
+				$val += $c - $start;
+			} elsif ($format =~ /^a/ && !ref $val) {
+				$val = $c;
+			}
+			$v[$c] = $conv ? $conv->($val, $c) : $val;
+		}
+	}
+	return \@v;
+}
+
+# expand a binary property to 0/1 per code point
+sub expand_bool
+{
+	my ($prop) = @_;
+	my @list = prop_invlist($prop);
+	my @v = (0) x ($RUNEMAX + 1);
+
+	die "unknown property $prop\n" unless @list;
+	push @list, $RUNEMAX + 1 if @list % 2;
+	for (my $i = 0; $i < @list; $i += 2) {
+		my $end = $list[$i + 1] - 1;
+
+		$end = $RUNEMAX if $end > $RUNEMAX;
+		$v[$_] = 1 for $list[$i] .. $end;
+	}
+	return \@v;
+}
+
+sub ctype
+{
+	my ($min, $max) = @_;
+
+	return 'uint8_t' if $min >= 0 && $max <= 0xff;
+	return 'uint16_t' if $min >= 0 && $max <= 0xffff;
+	return 'int8_t' if $min >= -0x80 && $max <= 0x7f;
+	return 'int16_t' if $min >= -0x8000 && $max <= 0x7fff;
+	return $min >= 0 ? 'uint32_t' : 'int32_t';
+}
+
+sub csize
+{
+	my ($type) = @_;
+
+	return $type =~ /8/ ? 1 : $type =~ /16/ ? 2 : 4;
+}
+
+sub minmax
+{
+	my ($min, $max) = ($_[0], $_[0]);
+
+	for (@_) {
+		$min = $_ if $_ < $min;
+		$max = $_ if $_ > $max;
+	}
+	return ($min, $max);
+}
+
+# print a C array
+sub emit_array
+{
+	my ($name, $type, $vals) = @_;
+	my $line = "\t";
+
+	printf "static const %s %s[%d] = {\n", $type, $name, scalar @$vals;
+	for my $i (0 .. $#$vals) {
+		my $s = $vals->[$i] . ($i < $#$vals ? ',' : '');
+
+		if (length($line) + length($s) + 1 > 72) {
+			$line =~ s/ $//;
+			print "$line\n";
+			$line = "\t";
+		}
+		$line .= "$s ";
+	}
+	$line =~ s/ $//;
+	print "$line\n};\n\n";
+}
+
+# split values into blocks of 1 << shift, sharing identical ones
+sub split_blocks
+{
+	my ($vals, $shift) = @_;
+	my $bs = 1 << $shift;
+	my (%seen, @idx, @blk);
+
+	for (my $b = 0; $b < @$vals; $b += $bs) {
+		my @block = @$vals[$b .. $b + $bs - 1];
+		my $key = join ',', map { $_ // 0 } @block;
+
+		unless (exists $seen{$key}) {
+			$seen{$key} = @blk / $bs;
+			push @blk, map { $_ // 0 } @block;
+		}
+		push @idx, $seen{$key};
+	}
+	return (\@idx, \@blk);
+}
+
+sub array_size
+{
+	my ($vals) = @_;
+
+	return @$vals * csize(ctype(minmax(@$vals)));
+}
+
+# print a two- or three-stage table and its lookup function
+sub emit_table
+{
+	my ($name, $vals) = @_;
+	my ($best, $bestsize);
+
+	for my $s1 (4 .. 9) {
+		my ($idx, $blk) = split_blocks($vals, $s1);
+		my $size = array_size($idx) + array_size($blk);
+
+		if (!defined $bestsize || $size < $bestsize) {
+			$bestsize = $size;
+			$best = [$s1, 0, $idx, undef, $blk];
+		}
+		for my $s2 (2 .. 8) {
+			my ($idx1, $idx2) = split_blocks($idx, $s2);
+			my $size = array_size($idx1) + array_size($idx2) +
+			           array_size($blk);
+
+			if ($size < $bestsize) {
+				$bestsize = $size;
+				$best = [$s1, $s2, $idx1, $idx2, $blk];
+			}
+		}
+	}
+	my ($s1, $s2, $idx1, $idx2, $blk) = @$best;
+	my $vtype = ctype(minmax(@$blk));
+
+	printf "/* %s: %d bytes */\n", $name, $bestsize;
+	emit_array("${name}_idx1", ctype(minmax(@$idx1)), $idx1);
+	emit_array("${name}_idx2", ctype(minmax(@$idx2)), $idx2) if $s2;
+	emit_array("${name}_blk", $vtype, $blk);
+	print "static inline $vtype ${name}_lookup(Rune c)\n{\n";
+	if ($s2) {
+		printf "\tsize_t i = (size_t)%s_idx1[c >> %d] << %d | " .
+		       "(c >> %d & 0x%x);\n\n", $name, $s1 + $s2, $s2, $s1,
+		       (1 << $s2) - 1;
+		printf "\treturn %s_blk[(size_t)%s_idx2[i] << %d | " .
+		       "(c & 0x%x)];\n", $name, $name, $s1, (1 << $s1) - 1;
+	} else {
+		printf "\treturn %s_blk[(size_t)%s_idx1[c >> %d] << %d | " .
+		       "(c & 0x%x)];\n", $name, $name, $s1, $s1,
+		       (1 << $s1) - 1;
+	}
+	print "}\n\n";
+}
+
+# map values to indices into a table of distinct values
+sub intern
+{
+	my ($vals) = @_;
+	my (%seen, @uniq, @ret);
+
+	for (@$vals) {
+		my $v = $_;
+
+		unless (exists $seen{$v}) {
+			$seen{$v} = @uniq;
+			push @uniq, $v;
+		}
+		push @ret, $seen{$v};
+	}
+	return (\@ret, \@uniq);
+}
+
+sub gen_casefold
+{
+	my $fold = expand('Simple_Case_Folding');
+	my @delta = map { $fold->[$_] - $_ } 0 .. $RUNEMAX;
+	my ($idx, $uniq) = intern(\@delta);
+
+	emit_array('casefold_delta', ctype(minmax(@$uniq)), $uniq);
+	emit_table('casefold', $idx);
+}
+
+# quick check bits, see norm.c
+my %QC = (
+	NFC_Quick_Check => [0, {Yes => 0, M => 1, N => 2}],
+	NFD_Quick_Check => [2, {Yes => 0, N => 2}],
+	NFKC_Quick_Check => [4, {Yes => 0, M => 1, N => 2}],
+	NFKD_Quick_Check => [6, {Yes => 0, N => 2}],
+);
+
+sub gen_norm
+{
+	my @ccc = map { getCombinClass($_) } 0 .. $RUNEMAX;
+	my @qc = (0) x ($RUNEMAX + 1);
+	my (@pool, %poolseen, @canon, @compat, %entryseen, @decomp);
+	my $type = expand('Decomposition_Type');
+	my $map = expand('Decomposition_Mapping');
+	my $excl = expand_bool('Full_Composition_Exclusion');
+	my @comp;
+
+	for my $prop (sort keys %QC) {
+		my ($shift, $vals) = @{$QC{$prop}};
+		my $v = expand($prop, sub { $vals->{$_[0]} });
+
+		$qc[$_] |= $v->[$_] << $shift for 0 .. $RUNEMAX;
+	}
+
+	# full decompositions as offset << 5 | length into a shared pool
+	my $store = sub {
+		my ($str) = @_;
+		my @runes = map { ord } split //, $str;
+		my $key = join ',', @runes;
+
+		unless (exists $poolseen{$key}) {
+			$poolseen{$key} = @pool;
+			push @pool, @runes;
+		}
+		return $poolseen{$key} << 5 | @runes;
+	};
+	push @canon, 0;
+	push @compat, 0;
+	$entryseen{'0,0'} = 0;
+	for my $c (0 .. $RUNEMAX) {
+		my ($can, $cpt) = (0, 0);
+
+		if ($type->[$c] eq 'None' || ($c >= 0xac00 && $c <= 0xd7a3)) {
+			push @decomp, 0;
+			next;
+		}
+		$can = $store->(getCanon($c)) if $type->[$c] eq 'Canonical';
+		$cpt = $store->(getCompat($c));
+		my $key = "$can,$cpt";
+
+		unless (exists $entryseen{$key}) {
+			$entryseen{$key} = @canon;
+			push @canon, $can;
+			push @compat, $cpt;
+		}
+		push @decomp, $entryseen{$key};
+	}
+
+	# primary composites, sorted by their decomposition
+	for my $c (0 .. $RUNEMAX) {
+		next unless $type->[$c] eq 'Canonical' && ref $map->[$c];
+		next if $excl->[$c] || @{$map->[$c]} != 2;
+		push @comp, [$map->[$c][0] << 21 | $map->[$c][1], $c];
+	}
+	@comp = sort { $a->[0] <=> $b->[0] } @comp;
+
+	my ($prop, $uniq) = intern([map { $ccc[$_] << 8 | $qc[$_] } 0 .. $RUNEMAX]);
+
+	emit_array('normprop_ccc', 'uint8_t', [map { $_ >> 8 } @$uniq]);
+	emit_array('normprop_qc', 'uint8_t', [map { $_ & 0xff } @$uniq]);
+	emit_table('normprop', $prop);
+	printf "#define NORMDECOMP_MAX %d\n\n",
+	       (sort { $b <=> $a } map { $_ & 0x1f } @compat)[0];
+	emit_array('normdecomp_pool', 'uint32_t', \@pool);
+	emit_array('normdecomp_canon', 'uint32_t', \@canon);
+	emit_array('normdecomp_compat', 'uint32_t', \@compat);
+	emit_table('normdecomp', \@decomp);
+	emit_array('normcomp_key', 'uint64_t', [map { $_->[0] } @comp]);
+	emit_array('normcomp_val', 'uint32_t', [map { $_->[1] } @comp]);
+}
+
+# grapheme cluster break classes, extended pictographic is folded in
+my @GCB = qw(Other CR LF Control Extend ZWJ Regional_Indicator Prepend
+             SpacingMark L V T LV LVT ExtPict_XX);
+
+sub gen_grapheme
+{
+	my %val = map { $GCB[$_] => $_ } 0 .. $#GCB;
+	my $gcb = expand('Grapheme_Cluster_Break', sub {
+		die "unknown grapheme cluster break $_[0]\n"
+			unless exists $val{$_[0]};
+		$val{$_[0]};
+	});
+
+	print "enum {\n";
+	printf "\tGCB_%s,\n", $GCB[$_] =~ s/_XX$//r for 0 .. $#GCB;
+	print "};\n\n";
+	emit_table('gcb', $gcb);
+}
+
+# terminal column widths, like wcwidth() but without -1 for control codes
+sub gen_width
+{
+	my $gc = expand('General_Category');
+	my $eaw = expand('East_Asian_Width');
+	my $emoji = expand_bool('Emoji_Presentation');
+	my $ignorable = expand_bool('Default_Ignorable_Code_Point');
+	my @width;
+
+	for my $c (0 .. $RUNEMAX) {
+		my $w = 1;
+
+		if ($gc->[$c] =~ /^(Mn|Me|Cf|Cc|Zl|Zp)$/ || $ignorable->[$c] ||
+		    ($c >= 0x1160 && $c <= 0x11ff) ||
+		    ($c >= 0xd7b0 && $c <= 0xd7ff)) {
+			$w = 0;
+		} elsif ($eaw->[$c] =~ /^[WF]$/ || $emoji->[$c]) {
+			$w = 2;
+		}
+		$w = 1 if $c == 0xad; # soft hyphen, usually rendered
+		$width[$c] = $w;
+	}
+	emit_table('width', \@width);
+}
+
+# general categories in the order of enum runecategory
+my @GC = qw(Cn Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po Sm Sc
+            Sk So Zs Zl Zp Cc Cf Cs Co);
+
+# binary properties, see runeprop.c
+my @PROPS = qw(White_Space Alphabetic Uppercase Lowercase);
+
+sub gen_prop
+{
+	my %gcval = map { $GC[$_] => $_ } 0 .. $#GC;
+	my $gc = expand('General_Category', sub { $gcval{$_[0]} });
+	my (%scval, @scripts);
+	my $sc = expand('Script', sub {
+		my $code = (prop_value_aliases('Script', $_[0]))[0];
+
+		unless (exists $scval{$code}) {
+			$scval{$code} = @scripts;
+			push @scripts, $code;
+		}
+		$scval{$code};
+	});
+	my @flags = (0) x ($RUNEMAX + 1);
+
+	for my $i (0 .. $#PROPS) {
+		my $v = expand_bool($PROPS[$i]);
+
+		$flags[$_] |= $v->[$_] << $i for 0 .. $RUNEMAX;
+	}
+	my ($prop, $uniq) = intern([map {
+		$gc->[$_] | $flags[$_] << 5 | $sc->[$_] << 16
+	} 0 .. $RUNEMAX]);
+
+	emit_array('runeprop_script', 'uint32_t', [map {
+		my @c = map { ord } split //;
+		sprintf "0x%08x", $c[0] << 24 | $c[1] << 16 | $c[2] << 8 | $c[3];
+	} @scripts]);
+	my ($unassigned) = grep { $uniq->[$_] == $scval{Zzzz} << 16 } 0 .. $#$uniq;
+
+	printf "#define RUNEPROP_UNASSIGNED %d\n\n", $unassigned;
+	emit_array('runeprop_gc', 'uint8_t', [map { $_ & 0x1f } @$uniq]);
+	emit_array('runeprop_flags', 'uint8_t', [map { $_ >> 5 & 0xff } @$uniq]);
+	emit_array('runeprop_sc', 'uint8_t', [map { $_ >> 16 } @$uniq]);
+	emit_table('runeprop', $prop);
+}
+
+my %gen = (
+	casefold => \&gen_casefold,
+	grapheme => \&gen_grapheme,
+	norm => \&gen_norm,
+	runeprop => \&gen_prop,
+	width => \&gen_width,
+);
+
+my $table = shift or die "usage: $0 <" . join('|', sort keys %gen) . ">\n";
+die "unknown table $table\n" unless $gen{$table};
+printf "/* generated by mktables.pl from Unicode %s, do not edit */\n\n",
+       Unicode::UCD::UnicodeVersion();
+$gen{$table}->();
@@ -0,0 +1,314 @@
+#include <stdlib.h>
+#include <string.h>
+#include "utf.h"
+#include "utfint.h"
+#include "norm.h"
+
+/* quick check values, two bits per form, see mktables.pl */
+enum {
+	QC_YES,
+	QC_MAYBE,
+	QC_NO
+};
+
+/* hangul syllables are composed algorithmically */
+enum {
+	SBase = 0xac00,
+	LBase = 0x1100,
+	VBase = 0x1161,
+	TBase = 0x11a7,
+	LCount = 19,
+	VCount = 21,
+	TCount = 28,
+	NCount = VCount * TCount,
+	SCount = LCount * NCount
+};
+
+struct runebuf {
+	Rune *r;
+	size_t len;
+	size_t cap;
+};
+
+struct charbuf {
+	char *p;
+	size_t len;
+	size_t cap;
+};
+
+static inline unsigned normprop(Rune c)
+{
+	return (c <= Runemax) ? normprop_lookup(c) : 0;
+}
+
+static inline int ccc(Rune c)
+{
+	return normprop_ccc[normprop(c)];
+}
+
+static inline int quickcheck(unsigned prop, enum utfnorm_form form)
+{
+	return normprop_qc[prop] >> (2 * form) & 3;
+}
+
+/* return 1 if the rune at @str is a malformed sequence */
+static inline int isinvalid(const char *str, int w)
+{
+	return w == 1 && !UTF8_IS_ASCII(*str);
+}
+
+static int runebuf_reserve(struct runebuf *b, size_t n)
+{
+	if (b->len + n > b->cap) {
+		size_t cap = (b->cap + n) * 2;
+		Rune *r = realloc(b->r, cap * sizeof(*r));
+
+		if (!r)
+			return -1;
+		b->r = r;
+		b->cap = cap;
+	}
+	return 0;
+}
+
+static int charbuf_reserve(struct charbuf *b, size_t n)
+{
+	if (b->len + n > b->cap) {
+		size_t cap = (b->cap + n) * 2;
+		char *p = realloc(b->p, cap);
+
+		if (!p)
+			return -1;
+		b->p = p;
+		b->cap = cap;
+	}
+	return 0;
+}
+
+/* append the full decomposition of a rune */
+static void decompose(struct runebuf *b, Rune c, int compat)
+{
+	uint32_t d;
+
+	if (c - SBase < SCount) {
+		c -= SBase;
+		b->r[b->len++] = LBase + c / NCount;
+		b->r[b->len++] = VBase + (c % NCount) / TCount;
+		if (c % TCount)
+			b->r[b->len++] = TBase + c % TCount;
+		return;
+	}
+	if (c > Runemax)
+		d = 0;
+	else if (compat)
+		d = normdecomp_compat[normdecomp_lookup(c)];
+	else
+		d = normdecomp_canon[normdecomp_lookup(c)];
+	if (!d) {
+		b->r[b->len++] = c;
+		return;
+	}
+	memcpy(b->r + b->len, normdecomp_pool + (d >> 5),
+	       (d & 0x1f) * sizeof(Rune));
+	b->len += d & 0x1f;
+}
+
+/* sort runs of combining marks by their combining class, stable */
+static void reorder(Rune *r, size_t n)
+{
+	size_t i, j;
+
+	for (i = 1; i < n; i++) {
+		Rune c = r[i];
+		int cc = ccc(c);
+
+		if (!cc)
+			continue;
+		for (j = i; j > 0 && ccc(r[j - 1]) > cc; j--)
+			r[j] = r[j - 1];
+		r[j] = c;
+	}
+}
+
+/* return the primary composite of two runes, or 0 */
+static Rune composepair(Rune a, Rune b)
+{
+	uint64_t key = (uint64_t)a << 21 | b;
+	size_t lo = 0, hi = sizeof(normcomp_key) / sizeof(*normcomp_key);
+
+	if (a - LBase < LCount && b - VBase < VCount)
+		return SBase + ((a - LBase) * VCount + (b - VBase)) * TCount;
+	if (a - SBase < SCount && !((a - SBase) % TCount) &&
+	    b - TBase - 1 < TCount - 1)
+		return a + (b - TBase);
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (normcomp_key[mid] < key)
+			lo = mid + 1;
+		else if (normcomp_key[mid] > key)
+			hi = mid;
+		else
+			return normcomp_val[mid];
+	}
+	return 0;
+}
+
+/* canonically compose a decomposed sequence in place */
+static size_t compose(Rune *r, size_t n)
+{
+	size_t i, j, starter = 0;
+	int have_starter = 0, lastcc = 0;
+
+	for (i = j = 0; i < n; i++) {
+		Rune c = r[i], comp;
+		int cc = ccc(c);
+
+		if (have_starter && (j - 1 == starter || (lastcc && lastcc < cc)) &&
+		    (comp = composepair(r[starter], c))) {
+			r[starter] = comp;
+			continue;
+		}
+		if (!cc) {
+			starter = j;
+			have_starter = 1;
+		}
+		lastcc = cc;
+		r[j++] = c;
+	}
+	return j;
+}
+
+/* utfnormspan(), adding the runes looked at and the ascii ones */
+static size_t norm_span(const char *str, size_t n, enum utfnorm_form form,
+                        size_t *runes, size_t *ascii)
+{
+	size_t i = 0, safe = 0;
+	int lastcc = 0;
+
+	while (i < n) {
+		unsigned prop;
+		Rune rune;
+		int w, cc;
+
+		if (UTF8_IS_ASCII(str[i])) {
+			w = ascii_span(str + i, n - i);
+			i += w;
+			*runes += w;
+			*ascii += w;
+			safe = i - 1;
+			lastcc = 0;
+			continue;
+		}
+		w = charntorune(&rune, str + i, n - i);
+		++*runes;
+		if (isinvalid(str + i, w))
+			return safe;
+		prop = normprop(rune);
+		cc = normprop_ccc[prop];
+		if ((cc && lastcc > cc) || quickcheck(prop, form) != QC_YES)
+			return safe;
+		if (!cc)
+			safe = i;
+		lastcc = cc;
+		i += w;
+	}
+	return n;
+}
+
+size_t utfnormspan(const char *str, size_t n, enum utfnorm_form form)
+{
+	size_t runes = 0, ascii = 0, span = norm_span(str, n, form, &runes,
+	                                              &ascii);
+
+	STAT(stats_add(span, runes, ascii, 0, 0));
+	return span;
+}
+
+/* return the end of the segment starting at @i, the next safe starter */
+static size_t segment_end(const char *str, size_t n, size_t i,
+                          enum utfnorm_form form)
+{
+	Rune rune;
+	int w;
+
+	for (i += charntorune(&rune, str + i, n - i); i < n; i += w) {
+		unsigned prop;
+
+		if (UTF8_IS_ASCII(str[i]))
+			break;
+		w = charntorune(&rune, str + i, n - i);
+		if (isinvalid(str + i, w))
+			break;
+		prop = normprop(rune);
+		if (!normprop_ccc[prop] && quickcheck(prop, form) == QC_YES)
+			break;
+	}
+	return i;
+}
+
+char *utfnormalize(const char *str, size_t n, enum utfnorm_form form,
+                   size_t *len)
+{
+	int compat = form == UTFNORM_NFKC || form == UTFNORM_NFKD;
+	int composed = form == UTFNORM_NFC || form == UTFNORM_NFKC;
+	struct runebuf seg = {NULL, 0, 0};
+	struct charbuf out;
+	size_t i, runes = 0, ascii = 0;
+	size_t span = norm_span(str, n, form, &runes, &ascii);
+	STAT(uint64_t replaced = 0);
+
+	if (span == n) {
+		STAT(stats_add(n, runes, ascii, 0, 0));
+		if (len)
+			*len = n;
+		return (char *)str;
+	}
+	out.len = 0;
+	out.cap = n + n / 4 + UTFmax + 1;
+	out.p = malloc(out.cap);
+	if (!out.p)
+		return NULL;
+	memcpy(out.p, str, span);
+	out.len = span;
+	for (i = span; i < n; ) {
+		size_t j, end = segment_end(str, n, i, form);
+
+		seg.len = 0;
+		while (i < end) {
+			Rune rune;
+			int w;
+
+			if (runebuf_reserve(&seg, NORMDECOMP_MAX) < 0)
+				goto fail;
+			w = charntorune(&rune, str + i, end - i);
+			STAT(runes++, ascii += rune < 0x80,
+			     replaced += isinvalid(str + i, w));
+			i += w;
+			decompose(&seg, rune, compat);
+		}
+		reorder(seg.r, seg.len);
+		if (composed)
+			seg.len = compose(seg.r, seg.len);
+		if (charbuf_reserve(&out, seg.len * UTFmax) < 0)
+			goto fail;
+		for (j = 0; j < seg.len; j++)
+			out.len += runetochar(out.p + out.len, &seg.r[j]);
+		span = norm_span(str + i, n - i, form, &runes, &ascii);
+		if (charbuf_reserve(&out, span + 1) < 0)
+			goto fail;
+		memcpy(out.p + out.len, str + i, span);
+		out.len += span;
+		i += span;
+	}
+	free(seg.r);
+	out.p[out.len] = '\0';
+	STAT(stats_add(n, runes, ascii, replaced, out.cap));
+	if (len)
+		*len = out.len;
+	return out.p;
+fail:
+	free(seg.r);
+	free(out.p);
+	return NULL;
+}
@@ -0,0 +1,2686 @@
+/* generated by mktables.pl from Unicode 14.0.0, do not edit */
+
+static const uint8_t normprop_ccc[69] = {
+	0, 0, 0, 230, 230, 232, 220, 216, 202, 220, 202, 1, 1, 230, 240, 233,
+	234, 0, 0, 222, 228, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+	22, 23, 24, 25, 30, 31, 32, 27, 28, 29, 33, 34, 35, 36, 7, 9, 7, 0,
+	84, 91, 9, 103, 107, 118, 122, 216, 129, 130, 132, 214, 218, 224, 8,
+	26, 6, 226
+};
+
+static const uint8_t normprop_qc[69] = {
+	0, 160, 136, 17, 0, 0, 0, 17, 0, 17, 17, 0, 17, 170, 17, 0, 0, 170,
+	168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 17, 0, 0, 17, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 17, 0, 0, 0
+};
+
+/* normprop: 11232 bytes */
+static const uint8_t normprop_idx1[1088] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 14, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17,
+	13, 13, 13, 13, 13, 13, 13, 13, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+	27, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 28, 29, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 30, 13, 13, 13, 13, 31, 32, 13, 13, 33, 13,
+	34, 35, 36, 13, 37, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	38, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13
+};
+
+static const uint16_t normprop_idx2[2496] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 3, 5, 6, 7, 8, 9, 10, 11, 8,
+	12, 0, 0, 13, 14, 15, 16, 17, 18, 6, 19, 20, 21, 0, 0, 0, 0, 0, 0, 0,
+	22, 0, 23, 24, 0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 14, 34, 14, 35,
+	36, 0, 37, 38, 39, 0, 39, 0, 38, 0, 40, 41, 0, 0, 0, 42, 43, 44, 45,
+	0, 0, 0, 0, 0, 0, 0, 0, 46, 47, 48, 49, 50, 0, 0, 0, 0, 51, 52, 0, 53,
+	54, 0, 55, 0, 0, 0, 0, 56, 57, 58, 0, 0, 59, 0, 60, 61, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 62, 63, 0, 64, 65, 0, 0, 66, 0, 0, 0, 67, 0, 0, 68, 69,
+	70, 71, 0, 0, 39, 72, 73, 74, 0, 0, 0, 0, 0, 75, 76, 77, 0, 78, 0, 0,
+	0, 79, 73, 80, 0, 0, 0, 0, 0, 81, 73, 0, 0, 0, 0, 0, 0, 75, 82, 83, 0,
+	0, 0, 84, 0, 85, 86, 87, 0, 0, 0, 0, 0, 81, 88, 89, 0, 0, 0, 0, 0, 81,
+	90, 91, 0, 0, 0, 0, 0, 92, 86, 87, 0, 0, 0, 0, 0, 0, 93, 94, 0, 0, 0,
+	0, 0, 95, 96, 0, 0, 0, 0, 0, 0, 97, 98, 99, 0, 0, 100, 101, 0, 102,
+	103, 104, 105, 106, 107, 103, 104, 105, 108, 0, 0, 0, 0, 0, 109, 110,
+	0, 0, 0, 0, 111, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0, 0, 0, 0, 112, 113, 0,
+	0, 114, 115, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 0,
+	119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 121, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 123, 0, 0, 0, 0, 124, 125, 0, 0, 0, 126, 127, 0, 0, 0, 128, 129,
+	0, 130, 131, 0, 132, 133, 0, 0, 134, 0, 0, 0, 135, 136, 0, 0, 0, 137,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 139, 140, 0, 0, 141, 142, 143, 144,
+	145, 146, 0, 147, 144, 144, 148, 149, 150, 151, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 152, 6, 6, 6, 6, 6, 153, 6, 154, 6, 6, 154, 155, 6, 156, 6, 6,
+	6, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 0, 168, 169,
+	170, 146, 0, 0, 171, 172, 173, 174, 175, 176, 177, 178, 144, 144, 144,
+	179, 180, 181, 0, 182, 0, 0, 0, 183, 0, 184, 185, 186, 0, 187, 188,
+	188, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 144, 144, 144, 144, 144, 144, 144,
+	145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0, 0, 0, 0, 192, 0,
+	0, 0, 0, 0, 193, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 194, 195, 0, 0, 0, 0, 0, 0,
+	196, 197, 0, 0, 0, 0, 0, 0, 150, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196,
+	0, 0, 0, 0, 0, 198, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	144, 144, 144, 199, 0, 0, 185, 0, 200, 201, 202, 203, 204, 205, 0,
+	206, 202, 203, 204, 205, 0, 207, 0, 0, 0, 208, 144, 144, 144, 144,
+	169, 209, 0, 0, 0, 0, 0, 0, 144, 169, 144, 144, 210, 144, 144, 169,
+	144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 194, 211, 0, 212, 0, 0, 0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0,
+	185, 0, 0, 0, 0, 0, 0, 0, 213, 214, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	119, 0, 150, 195, 0, 0, 216, 0, 0, 217, 0, 0, 0, 0, 0, 218, 124, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 220, 0, 0, 214, 0, 0, 0, 0,
+	0, 221, 179, 0, 0, 0, 0, 0, 0, 0, 73, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 21, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 222,
+	222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+	223, 224, 225, 222, 222, 222, 223, 222, 222, 222, 222, 222, 222, 226,
+	0, 0, 227, 228, 229, 230, 231, 144, 144, 144, 144, 144, 144, 232, 0,
+	233, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	144, 144, 144, 144, 144, 144, 144, 144, 234, 0, 144, 144, 144, 144,
+	209, 144, 144, 210, 0, 0, 170, 0, 235, 236, 144, 237, 238, 239, 240,
+	144, 144, 144, 144, 144, 144, 144, 170, 208, 144, 144, 144, 144, 144,
+	144, 144, 144, 144, 144, 169, 241, 242, 243, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 244, 0, 0, 0, 0, 0,
+	0, 0, 0, 245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 246,
+	144, 144, 247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 0, 249,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	251, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 244, 0, 0, 254, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 214, 0, 0, 255, 0, 256, 257, 258, 0, 0, 0, 0, 259,
+	0, 260, 261, 0, 0, 0, 218, 0, 0, 0, 0, 262, 0, 0, 0, 0, 0, 0, 263, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 265, 76, 87, 266, 267, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 268, 78, 0, 0, 0, 0, 0, 269, 270, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271, 272, 273, 0, 0, 0, 0, 0, 0,
+	197, 0, 0, 0, 0, 0, 0, 0, 274, 0, 0, 0, 0, 0, 0, 275, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 277, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 119,
+	278, 0, 0, 0, 0, 279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 280, 0, 0, 0, 0, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 281, 0, 0, 0, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 285, 286, 287, 288, 0, 289, 290, 291, 0, 0,
+	0, 0, 0, 0, 0, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 144, 144, 144, 144, 293, 144, 144,
+	144, 294, 295, 296, 297, 144, 144, 144, 298, 299, 144, 300, 301, 302,
+	144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	144, 144, 144, 144, 144, 144, 303, 144, 144, 144, 144, 144, 144, 144,
+	144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 304, 144, 144, 144,
+	305, 306, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0,
+	0, 0, 308, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 309, 0, 0, 0, 0, 0, 0, 310, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 297, 144, 311, 312, 313, 314, 315, 316, 317, 318, 319, 318, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 144, 169, 144, 144, 0, 320,
+	0, 0, 185, 0, 0, 0, 0, 0, 0, 321, 144, 144, 318, 22, 232, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 222, 222, 222,
+	222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+	222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+	222, 222, 223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const uint8_t normprop_blk[5152] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 1,
+	1, 0, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2,
+	2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0, 1, 1, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 1, 1,
+	0, 0, 2, 2, 2, 2, 2, 2, 1, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	1, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+	0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 0, 0, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4,
+	4, 3, 4, 3, 4, 3, 3, 5, 6, 6, 6, 6, 5, 7, 6, 6, 6, 6, 6, 8, 8, 9, 9,
+	9, 9, 10, 10, 6, 6, 6, 6, 9, 9, 6, 9, 9, 6, 6, 11, 11, 11, 11, 12, 6,
+	6, 6, 6, 4, 4, 4, 13, 13, 3, 13, 13, 14, 4, 6, 6, 6, 4, 4, 4, 6, 6, 0,
+	4, 4, 4, 6, 6, 6, 6, 4, 5, 6, 6, 4, 15, 16, 16, 15, 16, 16, 15, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 1, 0,
+	0, 0, 17, 0, 0, 0, 0, 0, 1, 18, 2, 17, 2, 2, 2, 0, 2, 0, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 0, 1, 1, 1, 18, 18, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 0,
+	2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+	4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+	2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6, 4, 4, 4, 4, 6, 4, 4, 4, 19, 6, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6,
+	4, 4, 6, 4, 4, 19, 20, 4, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 30,
+	31, 32, 33, 0, 34, 0, 35, 36, 0, 4, 6, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 4, 4, 4, 4, 4, 4, 37, 38, 39, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41,
+	42, 37, 38, 39, 43, 44, 3, 3, 9, 6, 4, 4, 4, 4, 4, 6, 4, 4, 6, 45, 0,
+	0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+	4, 4, 4, 6, 4, 0, 0, 4, 4, 0, 6, 4, 4, 6, 0, 0, 0, 46, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 4, 4, 6, 4, 4, 6, 6, 6, 4, 6, 6, 4,
+	6, 4, 4, 4, 6, 4, 6, 4, 6, 4, 6, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+	6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 6, 6, 4, 4, 4, 4, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 6, 4, 4, 6, 4, 4, 6, 4, 4, 4, 6, 6,
+	6, 40, 41, 42, 4, 4, 4, 6, 4, 4, 6, 6, 4, 4, 4, 4, 4, 0, 2, 0, 0, 2,
+	0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 48, 0, 0, 0, 4, 6, 4, 4, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 17,
+	17, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+	17, 0, 0, 17, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	17, 17, 17, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+	50, 50, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 0, 0, 0,
+	0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 50, 0, 0, 0, 0,
+	2, 2, 0, 2, 2, 0, 48, 0, 0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 50, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 2, 2, 2, 50, 0, 0, 0, 1, 0, 0, 0, 0, 54, 54, 48, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 56, 56, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57,
+	57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+	6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 6, 0, 58, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+	0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+	0, 0, 0, 0, 0, 59, 60, 17, 61, 17, 17, 1, 17, 1, 60, 60, 60, 60, 0, 0,
+	60, 17, 4, 4, 48, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+	0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 6, 4, 4,
+	4, 4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 0, 6, 6, 4, 4, 6, 6, 4, 4, 4, 4,
+	4, 6, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+	0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0,
+	0, 0, 0, 0, 2, 0, 2, 0, 0, 2, 2, 0, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 4, 4, 4, 4, 4, 4, 4, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+	48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 11, 6, 6, 6, 6, 6, 4, 4, 6, 6, 6, 6, 4,
+	0, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 4, 0,
+	0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 1, 1, 1, 1, 4, 4, 6, 4, 4, 4, 4, 4, 4, 4, 6, 4, 4, 16, 62, 6,
+	8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 20, 20, 6, 63, 4, 15,
+	6, 4, 6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 18, 0, 0, 0, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2,
+	2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2, 2, 17,
+	2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 0, 0, 2, 2, 2, 2, 2, 0, 2,
+	2, 2, 2, 2, 17, 2, 1, 17, 1, 1, 18, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2,
+	18, 18, 18, 2, 2, 2, 17, 0, 0, 2, 2, 2, 2, 2, 17, 0, 18, 18, 18, 2, 2,
+	2, 17, 2, 2, 2, 2, 2, 2, 2, 17, 2, 18, 17, 17, 0, 0, 2, 2, 2, 0, 2, 2,
+	2, 17, 2, 17, 2, 17, 1, 0, 17, 17, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0,
+	1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 4, 4, 11, 11, 4, 4, 4, 4,
+	11, 11, 11, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0, 11, 11, 4, 6, 4, 11, 11, 6,
+	6, 6, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+	0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1,
+	1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 0, 17, 0, 1, 0, 17, 17, 1, 1, 0, 1, 1,
+	1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1,
+	1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0,
+	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2,
+	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 20, 5, 19, 64, 64, 0, 0, 0, 0, 0, 0, 1,
+	0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 0,
+	2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0,
+	2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 65, 65, 1, 1, 0, 2, 1, 0, 0, 0,
+	0, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 2, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 4,
+	4, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0, 0, 48,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4, 0, 4, 4, 6, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 0, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 0, 0, 17, 0, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+	17, 0, 17, 0, 0, 17, 17, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 17, 66,
+	17, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 0, 17, 0, 17, 17, 0, 17, 17, 0,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 4,
+	4, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0,
+	0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+	1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+	1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 6, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+	4, 4, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 6, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 11, 6, 0, 0, 0,
+	0, 48, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+	4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+	4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 4, 4, 4, 6, 4, 6, 6, 6, 0, 0, 4,
+	6, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 48, 47, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 48, 48,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 49, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 49, 49, 0, 50, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+	4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 2, 2,
+	50, 2, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0,
+	0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0,
+	0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0,
+	0, 0, 0, 0, 0, 0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11,
+	11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 58, 58, 11, 11,
+	11, 0, 0, 0, 68, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6,
+	6, 6, 6, 6, 6, 0, 0, 4, 4, 4, 4, 4, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17,
+	17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+	0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 4,
+	4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6,
+	6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 49, 0, 0,
+	0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+	1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0,
+	1, 0, 1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+	1, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0,
+	1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1,
+	1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+	0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static inline uint8_t normprop_lookup(Rune c)
+{
+	size_t i = (size_t)normprop_idx1[c >> 10] << 6 | (c >> 4 & 0x3f);
+
+	return normprop_blk[(size_t)normprop_idx2[i] << 4 | (c & 0xf)];
+}
+
+#define NORMDECOMP_MAX 18
+
+static const uint32_t normdecomp_pool[6680] = {
+	32, 32, 776, 97, 32, 772, 50, 51, 32, 769, 956, 32, 807, 49, 111, 49,
+	8260, 52, 49, 8260, 50, 51, 8260, 52, 65, 768, 65, 769, 65, 770, 65,
+	771, 65, 776, 65, 778, 67, 807, 69, 768, 69, 769, 69, 770, 69, 776,
+	73, 768, 73, 769, 73, 770, 73, 776, 78, 771, 79, 768, 79, 769, 79,
+	770, 79, 771, 79, 776, 85, 768, 85, 769, 85, 770, 85, 776, 89, 769,
+	97, 768, 97, 769, 97, 770, 97, 771, 97, 776, 97, 778, 99, 807, 101,
+	768, 101, 769, 101, 770, 101, 776, 105, 768, 105, 769, 105, 770, 105,
+	776, 110, 771, 111, 768, 111, 769, 111, 770, 111, 771, 111, 776, 117,
+	768, 117, 769, 117, 770, 117, 776, 121, 769, 121, 776, 65, 772, 97,
+	772, 65, 774, 97, 774, 65, 808, 97, 808, 67, 769, 99, 769, 67, 770,
+	99, 770, 67, 775, 99, 775, 67, 780, 99, 780, 68, 780, 100, 780, 69,
+	772, 101, 772, 69, 774, 101, 774, 69, 775, 101, 775, 69, 808, 101,
+	808, 69, 780, 101, 780, 71, 770, 103, 770, 71, 774, 103, 774, 71, 775,
+	103, 775, 71, 807, 103, 807, 72, 770, 104, 770, 73, 771, 105, 771, 73,
+	772, 105, 772, 73, 774, 105, 774, 73, 808, 105, 808, 73, 775, 73, 74,
+	105, 106, 74, 770, 106, 770, 75, 807, 107, 807, 76, 769, 108, 769, 76,
+	807, 108, 807, 76, 780, 108, 780, 76, 183, 108, 183, 78, 769, 110,
+	769, 78, 807, 110, 807, 78, 780, 110, 780, 700, 110, 79, 772, 111,
+	772, 79, 774, 111, 774, 79, 779, 111, 779, 82, 769, 114, 769, 82, 807,
+	114, 807, 82, 780, 114, 780, 83, 769, 115, 769, 83, 770, 115, 770, 83,
+	807, 115, 807, 83, 780, 115, 780, 84, 807, 116, 807, 84, 780, 116,
+	780, 85, 771, 117, 771, 85, 772, 117, 772, 85, 774, 117, 774, 85, 778,
+	117, 778, 85, 779, 117, 779, 85, 808, 117, 808, 87, 770, 119, 770, 89,
+	770, 121, 770, 89, 776, 90, 769, 122, 769, 90, 775, 122, 775, 90, 780,
+	122, 780, 115, 79, 795, 111, 795, 85, 795, 117, 795, 68, 90, 780, 68,
+	122, 780, 100, 122, 780, 76, 74, 76, 106, 108, 106, 78, 74, 78, 106,
+	110, 106, 65, 780, 97, 780, 73, 780, 105, 780, 79, 780, 111, 780, 85,
+	780, 117, 780, 85, 776, 772, 117, 776, 772, 85, 776, 769, 117, 776,
+	769, 85, 776, 780, 117, 776, 780, 85, 776, 768, 117, 776, 768, 65,
+	776, 772, 97, 776, 772, 65, 775, 772, 97, 775, 772, 198, 772, 230,
+	772, 71, 780, 103, 780, 75, 780, 107, 780, 79, 808, 111, 808, 79, 808,
+	772, 111, 808, 772, 439, 780, 658, 780, 106, 780, 68, 90, 68, 122,
+	100, 122, 71, 769, 103, 769, 78, 768, 110, 768, 65, 778, 769, 97, 778,
+	769, 198, 769, 230, 769, 216, 769, 248, 769, 65, 783, 97, 783, 65,
+	785, 97, 785, 69, 783, 101, 783, 69, 785, 101, 785, 73, 783, 105, 783,
+	73, 785, 105, 785, 79, 783, 111, 783, 79, 785, 111, 785, 82, 783, 114,
+	783, 82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785, 83, 806,
+	115, 806, 84, 806, 116, 806, 72, 780, 104, 780, 65, 775, 97, 775, 69,
+	807, 101, 807, 79, 776, 772, 111, 776, 772, 79, 771, 772, 111, 771,
+	772, 79, 775, 111, 775, 79, 775, 772, 111, 775, 772, 89, 772, 121,
+	772, 104, 614, 106, 114, 633, 635, 641, 119, 121, 32, 774, 32, 775,
+	32, 778, 32, 808, 32, 771, 32, 779, 611, 108, 120, 661, 768, 769, 787,
+	776, 769, 697, 32, 837, 59, 168, 769, 32, 776, 769, 913, 769, 183,
+	917, 769, 919, 769, 921, 769, 927, 769, 933, 769, 937, 769, 953, 776,
+	769, 921, 776, 933, 776, 945, 769, 949, 769, 951, 769, 953, 769, 965,
+	776, 769, 953, 776, 965, 776, 959, 769, 965, 769, 969, 769, 946, 952,
+	933, 978, 769, 978, 776, 966, 960, 954, 961, 962, 920, 949, 931, 1045,
+	768, 1045, 776, 1043, 769, 1030, 776, 1050, 769, 1048, 768, 1059, 774,
+	1048, 774, 1080, 774, 1077, 768, 1077, 776, 1075, 769, 1110, 776,
+	1082, 769, 1080, 768, 1091, 774, 1140, 783, 1141, 783, 1046, 774,
+	1078, 774, 1040, 774, 1072, 774, 1040, 776, 1072, 776, 1045, 774,
+	1077, 774, 1240, 776, 1241, 776, 1046, 776, 1078, 776, 1047, 776,
+	1079, 776, 1048, 772, 1080, 772, 1048, 776, 1080, 776, 1054, 776,
+	1086, 776, 1256, 776, 1257, 776, 1069, 776, 1101, 776, 1059, 772,
+	1091, 772, 1059, 776, 1091, 776, 1059, 779, 1091, 779, 1063, 776,
+	1095, 776, 1067, 776, 1099, 776, 1381, 1410, 1575, 1619, 1575, 1620,
+	1608, 1620, 1575, 1621, 1610, 1620, 1575, 1652, 1608, 1652, 1735,
+	1652, 1610, 1652, 1749, 1620, 1729, 1620, 1746, 1620, 2344, 2364,
+	2352, 2364, 2355, 2364, 2325, 2364, 2326, 2364, 2327, 2364, 2332,
+	2364, 2337, 2364, 2338, 2364, 2347, 2364, 2351, 2364, 2503, 2494,
+	2503, 2519, 2465, 2492, 2466, 2492, 2479, 2492, 2610, 2620, 2616,
+	2620, 2582, 2620, 2583, 2620, 2588, 2620, 2603, 2620, 2887, 2902,
+	2887, 2878, 2887, 2903, 2849, 2876, 2850, 2876, 2962, 3031, 3014,
+	3006, 3015, 3006, 3014, 3031, 3142, 3158, 3263, 3285, 3270, 3285,
+	3270, 3286, 3270, 3266, 3270, 3266, 3285, 3398, 3390, 3399, 3390,
+	3398, 3415, 3545, 3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551,
+	3661, 3634, 3789, 3762, 3755, 3737, 3755, 3745, 3851, 3906, 4023,
+	3916, 4023, 3921, 4023, 3926, 4023, 3931, 4023, 3904, 4021, 3953,
+	3954, 3953, 3956, 4018, 3968, 4018, 3953, 3968, 4019, 3968, 4019,
+	3953, 3968, 3953, 3968, 3986, 4023, 3996, 4023, 4001, 4023, 4006,
+	4023, 4011, 4023, 3984, 4021, 4133, 4142, 4316, 6917, 6965, 6919,
+	6965, 6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965, 6970, 6965,
+	6972, 6965, 6974, 6965, 6975, 6965, 6978, 6965, 65, 198, 66, 68, 69,
+	398, 71, 72, 73, 74, 75, 76, 77, 78, 79, 546, 80, 82, 84, 85, 87, 592,
+	593, 7426, 98, 100, 101, 601, 603, 604, 103, 107, 109, 331, 596, 7446,
+	7447, 112, 116, 117, 7453, 623, 118, 7461, 947, 948, 967, 105, 1085,
+	594, 99, 597, 240, 102, 607, 609, 613, 616, 617, 618, 7547, 669, 621,
+	7557, 671, 625, 624, 626, 627, 628, 629, 632, 642, 643, 427, 649, 650,
+	7452, 651, 652, 122, 656, 657, 658, 65, 805, 97, 805, 66, 775, 98,
+	775, 66, 803, 98, 803, 66, 817, 98, 817, 67, 807, 769, 99, 807, 769,
+	68, 775, 100, 775, 68, 803, 100, 803, 68, 817, 100, 817, 68, 807, 100,
+	807, 68, 813, 100, 813, 69, 772, 768, 101, 772, 768, 69, 772, 769,
+	101, 772, 769, 69, 813, 101, 813, 69, 816, 101, 816, 69, 807, 774,
+	101, 807, 774, 70, 775, 102, 775, 71, 772, 103, 772, 72, 775, 104,
+	775, 72, 803, 104, 803, 72, 776, 104, 776, 72, 807, 104, 807, 72, 814,
+	104, 814, 73, 816, 105, 816, 73, 776, 769, 105, 776, 769, 75, 769,
+	107, 769, 75, 803, 107, 803, 75, 817, 107, 817, 76, 803, 108, 803, 76,
+	803, 772, 108, 803, 772, 76, 817, 108, 817, 76, 813, 108, 813, 77,
+	769, 109, 769, 77, 775, 109, 775, 77, 803, 109, 803, 78, 775, 110,
+	775, 78, 803, 110, 803, 78, 817, 110, 817, 78, 813, 110, 813, 79, 771,
+	769, 111, 771, 769, 79, 771, 776, 111, 771, 776, 79, 772, 768, 111,
+	772, 768, 79, 772, 769, 111, 772, 769, 80, 769, 112, 769, 80, 775,
+	112, 775, 82, 775, 114, 775, 82, 803, 114, 803, 82, 803, 772, 114,
+	803, 772, 82, 817, 114, 817, 83, 775, 115, 775, 83, 803, 115, 803, 83,
+	769, 775, 115, 769, 775, 83, 780, 775, 115, 780, 775, 83, 803, 775,
+	115, 803, 775, 84, 775, 116, 775, 84, 803, 116, 803, 84, 817, 116,
+	817, 84, 813, 116, 813, 85, 804, 117, 804, 85, 816, 117, 816, 85, 813,
+	117, 813, 85, 771, 769, 117, 771, 769, 85, 772, 776, 117, 772, 776,
+	86, 771, 118, 771, 86, 803, 118, 803, 87, 768, 119, 768, 87, 769, 119,
+	769, 87, 776, 119, 776, 87, 775, 119, 775, 87, 803, 119, 803, 88, 775,
+	120, 775, 88, 776, 120, 776, 89, 775, 121, 775, 90, 770, 122, 770, 90,
+	803, 122, 803, 90, 817, 122, 817, 104, 817, 116, 776, 119, 778, 121,
+	778, 97, 702, 383, 775, 65, 803, 97, 803, 65, 777, 97, 777, 65, 770,
+	769, 97, 770, 769, 65, 770, 768, 97, 770, 768, 65, 770, 777, 97, 770,
+	777, 65, 770, 771, 97, 770, 771, 65, 803, 770, 97, 803, 770, 65, 774,
+	769, 97, 774, 769, 65, 774, 768, 97, 774, 768, 65, 774, 777, 97, 774,
+	777, 65, 774, 771, 97, 774, 771, 65, 803, 774, 97, 803, 774, 69, 803,
+	101, 803, 69, 777, 101, 777, 69, 771, 101, 771, 69, 770, 769, 101,
+	770, 769, 69, 770, 768, 101, 770, 768, 69, 770, 777, 101, 770, 777,
+	69, 770, 771, 101, 770, 771, 69, 803, 770, 101, 803, 770, 73, 777,
+	105, 777, 73, 803, 105, 803, 79, 803, 111, 803, 79, 777, 111, 777, 79,
+	770, 769, 111, 770, 769, 79, 770, 768, 111, 770, 768, 79, 770, 777,
+	111, 770, 777, 79, 770, 771, 111, 770, 771, 79, 803, 770, 111, 803,
+	770, 79, 795, 769, 111, 795, 769, 79, 795, 768, 111, 795, 768, 79,
+	795, 777, 111, 795, 777, 79, 795, 771, 111, 795, 771, 79, 795, 803,
+	111, 795, 803, 85, 803, 117, 803, 85, 777, 117, 777, 85, 795, 769,
+	117, 795, 769, 85, 795, 768, 117, 795, 768, 85, 795, 777, 117, 795,
+	777, 85, 795, 771, 117, 795, 771, 85, 795, 803, 117, 795, 803, 89,
+	768, 121, 768, 89, 803, 121, 803, 89, 777, 121, 777, 89, 771, 121,
+	771, 945, 787, 945, 788, 945, 787, 768, 945, 788, 768, 945, 787, 769,
+	945, 788, 769, 945, 787, 834, 945, 788, 834, 913, 787, 913, 788, 913,
+	787, 768, 913, 788, 768, 913, 787, 769, 913, 788, 769, 913, 787, 834,
+	913, 788, 834, 949, 787, 949, 788, 949, 787, 768, 949, 788, 768, 949,
+	787, 769, 949, 788, 769, 917, 787, 917, 788, 917, 787, 768, 917, 788,
+	768, 917, 787, 769, 917, 788, 769, 951, 787, 951, 788, 951, 787, 768,
+	951, 788, 768, 951, 787, 769, 951, 788, 769, 951, 787, 834, 951, 788,
+	834, 919, 787, 919, 788, 919, 787, 768, 919, 788, 768, 919, 787, 769,
+	919, 788, 769, 919, 787, 834, 919, 788, 834, 953, 787, 953, 788, 953,
+	787, 768, 953, 788, 768, 953, 787, 769, 953, 788, 769, 953, 787, 834,
+	953, 788, 834, 921, 787, 921, 788, 921, 787, 768, 921, 788, 768, 921,
+	787, 769, 921, 788, 769, 921, 787, 834, 921, 788, 834, 959, 787, 959,
+	788, 959, 787, 768, 959, 788, 768, 959, 787, 769, 959, 788, 769, 927,
+	787, 927, 788, 927, 787, 768, 927, 788, 768, 927, 787, 769, 927, 788,
+	769, 965, 787, 965, 788, 965, 787, 768, 965, 788, 768, 965, 787, 769,
+	965, 788, 769, 965, 787, 834, 965, 788, 834, 933, 788, 933, 788, 768,
+	933, 788, 769, 933, 788, 834, 969, 787, 969, 788, 969, 787, 768, 969,
+	788, 768, 969, 787, 769, 969, 788, 769, 969, 787, 834, 969, 788, 834,
+	937, 787, 937, 788, 937, 787, 768, 937, 788, 768, 937, 787, 769, 937,
+	788, 769, 937, 787, 834, 937, 788, 834, 945, 768, 949, 768, 951, 768,
+	953, 768, 959, 768, 965, 768, 969, 768, 945, 787, 837, 945, 788, 837,
+	945, 787, 768, 837, 945, 788, 768, 837, 945, 787, 769, 837, 945, 788,
+	769, 837, 945, 787, 834, 837, 945, 788, 834, 837, 913, 787, 837, 913,
+	788, 837, 913, 787, 768, 837, 913, 788, 768, 837, 913, 787, 769, 837,
+	913, 788, 769, 837, 913, 787, 834, 837, 913, 788, 834, 837, 951, 787,
+	837, 951, 788, 837, 951, 787, 768, 837, 951, 788, 768, 837, 951, 787,
+	769, 837, 951, 788, 769, 837, 951, 787, 834, 837, 951, 788, 834, 837,
+	919, 787, 837, 919, 788, 837, 919, 787, 768, 837, 919, 788, 768, 837,
+	919, 787, 769, 837, 919, 788, 769, 837, 919, 787, 834, 837, 919, 788,
+	834, 837, 969, 787, 837, 969, 788, 837, 969, 787, 768, 837, 969, 788,
+	768, 837, 969, 787, 769, 837, 969, 788, 769, 837, 969, 787, 834, 837,
+	969, 788, 834, 837, 937, 787, 837, 937, 788, 837, 937, 787, 768, 837,
+	937, 788, 768, 837, 937, 787, 769, 837, 937, 788, 769, 837, 937, 787,
+	834, 837, 937, 788, 834, 837, 945, 774, 945, 772, 945, 768, 837, 945,
+	837, 945, 769, 837, 945, 834, 945, 834, 837, 913, 774, 913, 772, 913,
+	768, 913, 837, 32, 787, 953, 32, 834, 168, 834, 32, 776, 834, 951,
+	768, 837, 951, 837, 951, 769, 837, 951, 834, 951, 834, 837, 917, 768,
+	919, 768, 919, 837, 8127, 768, 32, 787, 768, 8127, 769, 32, 787, 769,
+	8127, 834, 32, 787, 834, 953, 774, 953, 772, 953, 776, 768, 953, 834,
+	953, 776, 834, 921, 774, 921, 772, 921, 768, 8190, 768, 32, 788, 768,
+	8190, 769, 32, 788, 769, 8190, 834, 32, 788, 834, 965, 774, 965, 772,
+	965, 776, 768, 961, 787, 961, 788, 965, 834, 965, 776, 834, 933, 774,
+	933, 772, 933, 768, 929, 788, 168, 768, 32, 776, 768, 96, 969, 768,
+	837, 969, 837, 969, 769, 837, 969, 834, 969, 834, 837, 927, 768, 937,
+	768, 937, 837, 180, 32, 788, 8194, 8195, 8208, 32, 819, 46, 46, 46,
+	46, 46, 46, 8242, 8242, 8242, 8242, 8242, 8245, 8245, 8245, 8245,
+	8245, 33, 33, 32, 773, 63, 63, 63, 33, 33, 63, 8242, 8242, 8242, 8242,
+	48, 52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 110, 82, 115, 97,
+	47, 99, 97, 47, 115, 67, 176, 67, 99, 47, 111, 99, 47, 117, 400, 176,
+	70, 295, 78, 111, 81, 83, 77, 84, 69, 76, 84, 77, 90, 937, 70, 1488,
+	1489, 1490, 1491, 70, 65, 88, 915, 928, 8721, 49, 8260, 55, 49, 8260,
+	57, 49, 8260, 49, 48, 49, 8260, 51, 50, 8260, 51, 49, 8260, 53, 50,
+	8260, 53, 51, 8260, 53, 52, 8260, 53, 49, 8260, 54, 53, 8260, 54, 49,
+	8260, 56, 51, 8260, 56, 53, 8260, 56, 55, 8260, 56, 49, 8260, 73, 73,
+	73, 73, 73, 73, 86, 86, 86, 73, 86, 73, 73, 86, 73, 73, 73, 73, 88,
+	88, 88, 73, 88, 73, 73, 105, 105, 105, 105, 105, 105, 118, 118, 105,
+	118, 105, 105, 118, 105, 105, 105, 105, 120, 120, 105, 120, 105, 105,
+	48, 8260, 51, 8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824,
+	8658, 824, 8707, 824, 8712, 824, 8715, 824, 8739, 824, 8741, 824,
+	8747, 8747, 8747, 8747, 8747, 8750, 8750, 8750, 8750, 8750, 8764, 824,
+	8771, 824, 8773, 824, 8776, 824, 61, 824, 8801, 824, 8781, 824, 60,
+	824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819, 824, 8822, 824,
+	8823, 824, 8826, 824, 8827, 824, 8834, 824, 8835, 824, 8838, 824,
+	8839, 824, 8866, 824, 8872, 824, 8873, 824, 8875, 824, 8828, 824,
+	8829, 824, 8849, 824, 8850, 824, 8882, 824, 8883, 824, 8884, 824,
+	8885, 824, 12296, 12297, 49, 48, 49, 49, 49, 50, 49, 51, 49, 52, 49,
+	53, 49, 54, 49, 55, 49, 56, 49, 57, 50, 48, 40, 49, 41, 40, 50, 41,
+	40, 51, 41, 40, 52, 41, 40, 53, 41, 40, 54, 41, 40, 55, 41, 40, 56,
+	41, 40, 57, 41, 40, 49, 48, 41, 40, 49, 49, 41, 40, 49, 50, 41, 40,
+	49, 51, 41, 40, 49, 52, 41, 40, 49, 53, 41, 40, 49, 54, 41, 40, 49,
+	55, 41, 40, 49, 56, 41, 40, 49, 57, 41, 40, 50, 48, 41, 49, 46, 50,
+	46, 51, 46, 52, 46, 53, 46, 54, 46, 55, 46, 56, 46, 57, 46, 49, 48,
+	46, 49, 49, 46, 49, 50, 46, 49, 51, 46, 49, 52, 46, 49, 53, 46, 49,
+	54, 46, 49, 55, 46, 49, 56, 46, 49, 57, 46, 50, 48, 46, 40, 97, 41,
+	40, 98, 41, 40, 99, 41, 40, 100, 41, 40, 101, 41, 40, 102, 41, 40,
+	103, 41, 40, 104, 41, 40, 105, 41, 40, 106, 41, 40, 107, 41, 40, 108,
+	41, 40, 109, 41, 40, 110, 41, 40, 111, 41, 40, 112, 41, 40, 113, 41,
+	40, 114, 41, 40, 115, 41, 40, 116, 41, 40, 117, 41, 40, 118, 41, 40,
+	119, 41, 40, 120, 41, 40, 121, 41, 40, 122, 41, 83, 89, 113, 8747,
+	8747, 8747, 8747, 58, 58, 61, 61, 61, 61, 61, 61, 10973, 824, 11617,
+	27597, 40863, 19968, 20008, 20022, 20031, 20057, 20101, 20108, 20128,
+	20154, 20799, 20837, 20843, 20866, 20886, 20907, 20960, 20981, 20992,
+	21147, 21241, 21269, 21274, 21304, 21313, 21340, 21353, 21378, 21430,
+	21448, 21475, 22231, 22303, 22763, 22786, 22794, 22805, 22823, 22899,
+	23376, 23424, 23544, 23567, 23586, 23608, 23662, 23665, 24027, 24037,
+	24049, 24062, 24178, 24186, 24191, 24308, 24318, 24331, 24339, 24400,
+	24417, 24435, 24515, 25096, 25142, 25163, 25903, 25908, 25991, 26007,
+	26020, 26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490, 27513,
+	27571, 27595, 27604, 27611, 27663, 27668, 27700, 28779, 29226, 29238,
+	29243, 29247, 29255, 29273, 29275, 29356, 29572, 29577, 29916, 29926,
+	29976, 29983, 29992, 30000, 30091, 30098, 30326, 30333, 30382, 30399,
+	30446, 30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435, 31481,
+	31859, 31992, 32566, 32593, 32650, 32701, 32769, 32780, 32786, 32819,
+	32895, 32905, 33251, 33258, 33267, 33276, 33292, 33307, 33311, 33390,
+	33394, 33400, 34381, 34411, 34880, 34892, 34915, 35198, 35211, 35282,
+	35328, 35895, 35910, 35925, 35960, 35997, 36196, 36208, 36275, 36523,
+	36554, 36763, 36784, 36789, 37009, 37193, 37318, 37324, 37329, 38263,
+	38272, 38428, 38582, 38585, 38632, 38737, 38750, 38754, 38761, 38859,
+	38893, 38899, 38913, 39080, 39131, 39135, 39318, 39321, 39340, 39592,
+	39640, 39647, 39717, 39727, 39730, 39740, 39770, 40165, 40565, 40575,
+	40613, 40635, 40643, 40653, 40657, 40697, 40701, 40718, 40723, 40736,
+	40763, 40778, 40786, 40845, 40860, 40864, 12306, 21316, 21317, 12363,
+	12441, 12365, 12441, 12367, 12441, 12369, 12441, 12371, 12441, 12373,
+	12441, 12375, 12441, 12377, 12441, 12379, 12441, 12381, 12441, 12383,
+	12441, 12385, 12441, 12388, 12441, 12390, 12441, 12392, 12441, 12399,
+	12441, 12399, 12442, 12402, 12441, 12402, 12442, 12405, 12441, 12405,
+	12442, 12408, 12441, 12408, 12442, 12411, 12441, 12411, 12442, 12358,
+	12441, 32, 12441, 32, 12442, 12445, 12441, 12424, 12426, 12459, 12441,
+	12461, 12441, 12463, 12441, 12465, 12441, 12467, 12441, 12469, 12441,
+	12471, 12441, 12473, 12441, 12475, 12441, 12477, 12441, 12479, 12441,
+	12481, 12441, 12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441,
+	12495, 12442, 12498, 12441, 12498, 12442, 12501, 12441, 12501, 12442,
+	12504, 12441, 12504, 12442, 12507, 12441, 12507, 12442, 12454, 12441,
+	12527, 12441, 12528, 12441, 12529, 12441, 12530, 12441, 12541, 12441,
+	12467, 12488, 4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356, 4357,
+	4528, 4529, 4530, 4531, 4532, 4533, 4378, 4358, 4359, 4360, 4385,
+	4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449,
+	4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460,
+	4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4448, 4372,
+	4373, 4551, 4552, 4556, 4558, 4563, 4567, 4569, 4380, 4573, 4575,
+	4381, 4382, 4384, 4386, 4387, 4391, 4393, 4395, 4396, 4397, 4398,
+	4399, 4402, 4406, 4416, 4423, 4428, 4593, 4594, 4439, 4440, 4441,
+	4484, 4485, 4488, 4497, 4498, 4500, 4510, 4513, 19977, 22235, 19978,
+	20013, 19979, 30002, 19993, 19969, 22825, 22320, 40, 4352, 41, 40,
+	4354, 41, 40, 4355, 41, 40, 4357, 41, 40, 4358, 41, 40, 4359, 41, 40,
+	4361, 41, 40, 4363, 41, 40, 4364, 41, 40, 4366, 41, 40, 4367, 41, 40,
+	4368, 41, 40, 4369, 41, 40, 4370, 41, 40, 4352, 4449, 41, 40, 4354,
+	4449, 41, 40, 4355, 4449, 41, 40, 4357, 4449, 41, 40, 4358, 4449, 41,
+	40, 4359, 4449, 41, 40, 4361, 4449, 41, 40, 4363, 4449, 41, 40, 4364,
+	4449, 41, 40, 4366, 4449, 41, 40, 4367, 4449, 41, 40, 4368, 4449, 41,
+	40, 4369, 4449, 41, 40, 4370, 4449, 41, 40, 4364, 4462, 41, 40, 4363,
+	4457, 4364, 4453, 4523, 41, 40, 4363, 4457, 4370, 4462, 41, 40, 19968,
+	41, 40, 20108, 41, 40, 19977, 41, 40, 22235, 41, 40, 20116, 41, 40,
+	20845, 41, 40, 19971, 41, 40, 20843, 41, 40, 20061, 41, 40, 21313, 41,
+	40, 26376, 41, 40, 28779, 41, 40, 27700, 41, 40, 26408, 41, 40, 37329,
+	41, 40, 22303, 41, 40, 26085, 41, 40, 26666, 41, 40, 26377, 41, 40,
+	31038, 41, 40, 21517, 41, 40, 29305, 41, 40, 36001, 41, 40, 31069, 41,
+	40, 21172, 41, 40, 20195, 41, 40, 21628, 41, 40, 23398, 41, 40, 30435,
+	41, 40, 20225, 41, 40, 36039, 41, 40, 21332, 41, 40, 31085, 41, 40,
+	20241, 41, 40, 33258, 41, 40, 33267, 41, 21839, 24188, 31631, 80, 84,
+	69, 50, 49, 50, 50, 50, 51, 50, 52, 50, 53, 50, 54, 50, 55, 50, 56,
+	50, 57, 51, 48, 51, 49, 51, 50, 51, 51, 51, 52, 51, 53, 4352, 4449,
+	4354, 4449, 4355, 4449, 4357, 4449, 4358, 4449, 4359, 4449, 4361,
+	4449, 4363, 4449, 4364, 4449, 4366, 4449, 4367, 4449, 4368, 4449,
+	4369, 4449, 4370, 4449, 4366, 4449, 4535, 4352, 4457, 4364, 4462,
+	4363, 4468, 4363, 4462, 20116, 20845, 19971, 20061, 26666, 26377,
+	31038, 21517, 29305, 36001, 31069, 21172, 31192, 30007, 36969, 20778,
+	21360, 27880, 38917, 20241, 20889, 27491, 24038, 21491, 21307, 23447,
+	23398, 30435, 20225, 36039, 21332, 22812, 51, 54, 51, 55, 51, 56, 51,
+	57, 52, 48, 52, 49, 52, 50, 52, 51, 52, 52, 52, 53, 52, 54, 52, 55,
+	52, 56, 52, 57, 53, 48, 49, 26376, 50, 26376, 51, 26376, 52, 26376,
+	53, 26376, 54, 26376, 55, 26376, 56, 26376, 57, 26376, 49, 48, 26376,
+	49, 49, 26376, 49, 50, 26376, 72, 103, 101, 114, 103, 101, 86, 76, 84,
+	68, 12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463, 12465,
+	12467, 12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486,
+	12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504,
+	12507, 12510, 12511, 12512, 12513, 12514, 12516, 12518, 12520, 12521,
+	12522, 12523, 12524, 12525, 12527, 12528, 12529, 12530, 20196, 21644,
+	12450, 12495, 12442, 12540, 12488, 12450, 12523, 12501, 12449, 12450,
+	12531, 12504, 12442, 12450, 12450, 12540, 12523, 12452, 12491, 12531,
+	12463, 12441, 12452, 12531, 12481, 12454, 12457, 12531, 12456, 12473,
+	12463, 12540, 12488, 12441, 12456, 12540, 12459, 12540, 12458, 12531,
+	12473, 12458, 12540, 12512, 12459, 12452, 12522, 12459, 12521, 12483,
+	12488, 12459, 12525, 12522, 12540, 12459, 12441, 12525, 12531, 12459,
+	12441, 12531, 12510, 12461, 12441, 12459, 12441, 12461, 12441, 12491,
+	12540, 12461, 12517, 12522, 12540, 12461, 12441, 12523, 12479, 12441,
+	12540, 12461, 12525, 12461, 12525, 12463, 12441, 12521, 12512, 12461,
+	12525, 12513, 12540, 12488, 12523, 12461, 12525, 12527, 12483, 12488,
+	12463, 12441, 12521, 12512, 12463, 12441, 12521, 12512, 12488, 12531,
+	12463, 12523, 12475, 12441, 12452, 12525, 12463, 12525, 12540, 12493,
+	12465, 12540, 12473, 12467, 12523, 12490, 12467, 12540, 12507, 12442,
+	12469, 12452, 12463, 12523, 12469, 12531, 12481, 12540, 12512, 12471,
+	12522, 12531, 12463, 12441, 12475, 12531, 12481, 12475, 12531, 12488,
+	12479, 12441, 12540, 12473, 12486, 12441, 12471, 12488, 12441, 12523,
+	12488, 12531, 12490, 12494, 12494, 12483, 12488, 12495, 12452, 12484,
+	12495, 12442, 12540, 12475, 12531, 12488, 12495, 12442, 12540, 12484,
+	12495, 12441, 12540, 12524, 12523, 12498, 12442, 12450, 12473, 12488,
+	12523, 12498, 12442, 12463, 12523, 12498, 12442, 12467, 12498, 12441,
+	12523, 12501, 12449, 12521, 12483, 12488, 12441, 12501, 12451, 12540,
+	12488, 12501, 12441, 12483, 12471, 12455, 12523, 12501, 12521, 12531,
+	12504, 12463, 12479, 12540, 12523, 12504, 12442, 12477, 12504, 12442,
+	12491, 12498, 12504, 12523, 12484, 12504, 12442, 12531, 12473, 12504,
+	12442, 12540, 12471, 12441, 12504, 12441, 12540, 12479, 12507, 12442,
+	12452, 12531, 12488, 12507, 12441, 12523, 12488, 12507, 12531, 12507,
+	12442, 12531, 12488, 12441, 12507, 12540, 12523, 12507, 12540, 12531,
+	12510, 12452, 12463, 12525, 12510, 12452, 12523, 12510, 12483, 12495,
+	12510, 12523, 12463, 12510, 12531, 12471, 12519, 12531, 12511, 12463,
+	12525, 12531, 12511, 12522, 12511, 12522, 12495, 12441, 12540, 12523,
+	12513, 12459, 12441, 12513, 12459, 12441, 12488, 12531, 12513, 12540,
+	12488, 12523, 12516, 12540, 12488, 12441, 12516, 12540, 12523, 12518,
+	12450, 12531, 12522, 12483, 12488, 12523, 12522, 12521, 12523, 12498,
+	12442, 12540, 12523, 12540, 12501, 12441, 12523, 12524, 12512, 12524,
+	12531, 12488, 12465, 12441, 12531, 12527, 12483, 12488, 48, 28857, 49,
+	28857, 50, 28857, 51, 28857, 52, 28857, 53, 28857, 54, 28857, 55,
+	28857, 56, 28857, 57, 28857, 49, 48, 28857, 49, 49, 28857, 49, 50,
+	28857, 49, 51, 28857, 49, 52, 28857, 49, 53, 28857, 49, 54, 28857, 49,
+	55, 28857, 49, 56, 28857, 49, 57, 28857, 50, 48, 28857, 50, 49, 28857,
+	50, 50, 28857, 50, 51, 28857, 50, 52, 28857, 104, 80, 97, 100, 97, 65,
+	85, 98, 97, 114, 111, 86, 112, 99, 100, 109, 100, 109, 50, 100, 109,
+	51, 73, 85, 24179, 25104, 26157, 21644, 22823, 27491, 26126, 27835,
+	26666, 24335, 20250, 31038, 112, 65, 110, 65, 956, 65, 109, 65, 107,
+	65, 75, 66, 77, 66, 71, 66, 99, 97, 108, 107, 99, 97, 108, 112, 70,
+	110, 70, 956, 70, 956, 103, 109, 103, 107, 103, 72, 122, 107, 72, 122,
+	77, 72, 122, 71, 72, 122, 84, 72, 122, 956, 108, 109, 108, 100, 108,
+	107, 108, 102, 109, 110, 109, 956, 109, 109, 109, 99, 109, 107, 109,
+	109, 109, 50, 99, 109, 50, 109, 50, 107, 109, 50, 109, 109, 51, 99,
+	109, 51, 109, 51, 107, 109, 51, 109, 8725, 115, 109, 8725, 115, 50,
+	80, 97, 107, 80, 97, 77, 80, 97, 71, 80, 97, 114, 97, 100, 114, 97,
+	100, 8725, 115, 114, 97, 100, 8725, 115, 50, 112, 115, 110, 115, 956,
+	115, 109, 115, 112, 86, 110, 86, 956, 86, 109, 86, 107, 86, 77, 86,
+	112, 87, 110, 87, 956, 87, 109, 87, 107, 87, 77, 87, 107, 937, 77,
+	937, 97, 46, 109, 46, 66, 113, 99, 99, 99, 100, 67, 8725, 107, 103,
+	67, 111, 46, 100, 66, 71, 121, 104, 97, 72, 80, 105, 110, 75, 75, 75,
+	77, 107, 116, 108, 109, 108, 110, 108, 111, 103, 108, 120, 109, 98,
+	109, 105, 108, 109, 111, 108, 80, 72, 112, 46, 109, 46, 80, 80, 77,
+	80, 82, 115, 114, 83, 118, 87, 98, 86, 8725, 109, 65, 8725, 109, 49,
+	26085, 50, 26085, 51, 26085, 52, 26085, 53, 26085, 54, 26085, 55,
+	26085, 56, 26085, 57, 26085, 49, 48, 26085, 49, 49, 26085, 49, 50,
+	26085, 49, 51, 26085, 49, 52, 26085, 49, 53, 26085, 49, 54, 26085, 49,
+	55, 26085, 49, 56, 26085, 49, 57, 26085, 50, 48, 26085, 50, 49, 26085,
+	50, 50, 26085, 50, 51, 26085, 50, 52, 26085, 50, 53, 26085, 50, 54,
+	26085, 50, 55, 26085, 50, 56, 26085, 50, 57, 26085, 51, 48, 26085, 51,
+	49, 26085, 103, 97, 108, 1098, 1100, 42863, 294, 339, 42791, 43831,
+	619, 43858, 653, 35912, 26356, 36040, 28369, 20018, 21477, 22865,
+	21895, 22856, 25078, 30313, 32645, 34367, 34746, 35064, 37007, 27138,
+	27931, 28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396, 29211,
+	34349, 40478, 23888, 28651, 34253, 35172, 25289, 33240, 34847, 24266,
+	26391, 28010, 29436, 37070, 20358, 20919, 21214, 25796, 27347, 29200,
+	30439, 34310, 34396, 36335, 38706, 39791, 40442, 30860, 31103, 32160,
+	33737, 37636, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034,
+	38647, 22744, 23650, 27155, 28122, 28431, 32047, 32311, 38475, 21202,
+	32907, 20956, 20940, 31260, 32190, 33777, 38517, 35712, 25295, 35582,
+	20025, 23527, 24594, 29575, 30064, 21271, 30971, 20415, 24489, 19981,
+	27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578, 27784,
+	25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391,
+	35538, 37327, 21237, 21570, 24300, 26053, 28670, 31018, 38317, 39530,
+	40599, 40654, 26310, 27511, 36706, 24180, 24976, 25088, 25754, 28451,
+	29001, 29833, 31178, 32244, 32879, 36646, 34030, 36899, 37706, 21015,
+	21155, 21693, 28872, 35010, 24265, 24565, 25467, 27566, 31806, 29557,
+	20196, 22265, 23994, 24604, 29618, 29801, 32666, 32838, 37428, 38646,
+	38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102, 20698, 23534,
+	23615, 26009, 29134, 30274, 34044, 36988, 26248, 38446, 21129, 26491,
+	26611, 27969, 28316, 29705, 30041, 30827, 32016, 39006, 25134, 38520,
+	20523, 23833, 28138, 36650, 24459, 24900, 26647, 38534, 21033, 21519,
+	23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633, 35023, 35041,
+	38626, 21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607,
+	26519, 28107, 33256, 31520, 31890, 29376, 28825, 35672, 20160, 33590,
+	21050, 20999, 24230, 25299, 31958, 23429, 27934, 26292, 36667, 38477,
+	24275, 20800, 21952, 22618, 26228, 20958, 29482, 30410, 31036, 31070,
+	31077, 31119, 38742, 31934, 34322, 35576, 36920, 37117, 39151, 39164,
+	39208, 40372, 37086, 38583, 20398, 20711, 20813, 21193, 21220, 21329,
+	21917, 22022, 22120, 22592, 22696, 23652, 24724, 24936, 24974, 25074,
+	25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730,
+	30865, 31049, 31048, 31056, 31062, 31117, 31118, 31296, 31361, 31680,
+	32265, 32321, 32626, 32773, 33261, 33401, 33879, 35088, 35222, 35585,
+	35641, 36051, 36104, 36790, 38627, 38911, 38971, 24693, 148206, 33304,
+	20006, 20917, 20840, 20352, 20805, 20864, 21191, 21242, 21845, 21913,
+	21986, 22707, 22852, 22868, 23138, 23336, 24274, 24281, 24425, 24493,
+	24792, 24910, 24840, 24928, 25140, 25540, 25628, 25682, 25942, 26395,
+	26454, 28379, 28363, 28702, 30631, 29237, 29359, 29809, 29958, 30011,
+	30237, 30239, 30427, 30452, 30538, 30528, 30924, 31409, 31867, 32091,
+	32574, 33618, 33775, 34681, 35137, 35206, 35519, 35531, 35565, 35722,
+	36664, 36978, 37273, 37494, 38524, 38875, 38923, 39698, 141386,
+	141380, 144341, 15261, 16408, 16441, 152137, 154832, 163539, 40771,
+	40846, 102, 102, 102, 105, 102, 108, 102, 102, 105, 102, 102, 108,
+	115, 116, 1396, 1398, 1396, 1381, 1396, 1387, 1406, 1398, 1396, 1389,
+	1497, 1460, 1522, 1463, 1506, 1492, 1499, 1500, 1501, 1512, 1514,
+	1513, 1473, 1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488,
+	1463, 1488, 1464, 1488, 1468, 1489, 1468, 1490, 1468, 1491, 1468,
+	1492, 1468, 1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498,
+	1468, 1499, 1468, 1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468,
+	1507, 1468, 1508, 1468, 1510, 1468, 1511, 1468, 1512, 1468, 1513,
+	1468, 1514, 1468, 1493, 1465, 1489, 1471, 1499, 1471, 1508, 1471,
+	1488, 1500, 1649, 1659, 1662, 1664, 1658, 1663, 1657, 1700, 1702,
+	1668, 1667, 1670, 1671, 1677, 1676, 1678, 1672, 1688, 1681, 1705,
+	1711, 1715, 1713, 1722, 1723, 1729, 1726, 1746, 1709, 1735, 1734,
+	1736, 1739, 1733, 1737, 1744, 1609, 1610, 1620, 1575, 1610, 1620,
+	1749, 1610, 1620, 1608, 1610, 1620, 1735, 1610, 1620, 1734, 1610,
+	1620, 1736, 1610, 1620, 1744, 1610, 1620, 1609, 1740, 1610, 1620,
+	1580, 1610, 1620, 1581, 1610, 1620, 1605, 1610, 1620, 1610, 1576,
+	1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1609, 1576, 1610,
+	1578, 1580, 1578, 1581, 1578, 1582, 1578, 1605, 1578, 1609, 1578,
+	1610, 1579, 1580, 1579, 1605, 1579, 1609, 1579, 1610, 1580, 1581,
+	1580, 1605, 1581, 1580, 1581, 1605, 1582, 1580, 1582, 1581, 1582,
+	1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587, 1605, 1589, 1581,
+	1589, 1605, 1590, 1580, 1590, 1581, 1590, 1582, 1590, 1605, 1591,
+	1581, 1591, 1605, 1592, 1605, 1593, 1580, 1593, 1605, 1594, 1580,
+	1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1601,
+	1609, 1601, 1610, 1602, 1581, 1602, 1605, 1602, 1609, 1602, 1610,
+	1603, 1575, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604, 1603,
+	1605, 1603, 1609, 1603, 1610, 1604, 1580, 1604, 1581, 1604, 1582,
+	1604, 1605, 1604, 1609, 1604, 1610, 1605, 1580, 1605, 1581, 1605,
+	1582, 1605, 1605, 1605, 1609, 1605, 1610, 1606, 1580, 1606, 1581,
+	1606, 1582, 1606, 1605, 1606, 1609, 1606, 1610, 1607, 1580, 1607,
+	1605, 1607, 1609, 1607, 1610, 1610, 1580, 1610, 1581, 1610, 1582,
+	1610, 1605, 1610, 1609, 1610, 1610, 1584, 1648, 1585, 1648, 1609,
+	1648, 32, 1612, 1617, 32, 1613, 1617, 32, 1614, 1617, 32, 1615, 1617,
+	32, 1616, 1617, 32, 1617, 1648, 1610, 1620, 1585, 1610, 1620, 1586,
+	1610, 1620, 1606, 1576, 1585, 1576, 1586, 1576, 1606, 1578, 1585,
+	1578, 1586, 1578, 1606, 1579, 1585, 1579, 1586, 1579, 1606, 1605,
+	1575, 1606, 1585, 1606, 1586, 1606, 1606, 1610, 1585, 1610, 1586,
+	1610, 1606, 1610, 1620, 1582, 1610, 1620, 1607, 1576, 1607, 1578,
+	1607, 1589, 1582, 1604, 1607, 1606, 1607, 1607, 1648, 1610, 1607,
+	1579, 1607, 1587, 1607, 1588, 1605, 1588, 1607, 1600, 1614, 1617,
+	1600, 1615, 1617, 1600, 1616, 1617, 1591, 1609, 1591, 1610, 1593,
+	1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610,
+	1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609, 1580,
+	1610, 1582, 1609, 1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609,
+	1590, 1610, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1585, 1587,
+	1585, 1589, 1585, 1590, 1585, 1575, 1611, 1578, 1580, 1605, 1578,
+	1581, 1580, 1578, 1581, 1605, 1578, 1582, 1605, 1578, 1605, 1580,
+	1578, 1605, 1581, 1578, 1605, 1582, 1580, 1605, 1581, 1581, 1605,
+	1610, 1581, 1605, 1609, 1587, 1581, 1580, 1587, 1580, 1581, 1587,
+	1580, 1609, 1587, 1605, 1581, 1587, 1605, 1580, 1587, 1605, 1605,
+	1589, 1581, 1581, 1589, 1605, 1605, 1588, 1581, 1605, 1588, 1580,
+	1610, 1588, 1605, 1582, 1588, 1605, 1605, 1590, 1581, 1609, 1590,
+	1582, 1605, 1591, 1605, 1581, 1591, 1605, 1605, 1591, 1605, 1610,
+	1593, 1580, 1605, 1593, 1605, 1605, 1593, 1605, 1609, 1594, 1605,
+	1605, 1594, 1605, 1610, 1594, 1605, 1609, 1601, 1582, 1605, 1602,
+	1605, 1581, 1602, 1605, 1605, 1604, 1581, 1605, 1604, 1581, 1610,
+	1604, 1581, 1609, 1604, 1580, 1580, 1604, 1582, 1605, 1604, 1605,
+	1581, 1605, 1581, 1580, 1605, 1581, 1605, 1605, 1581, 1610, 1605,
+	1580, 1581, 1605, 1580, 1605, 1605, 1582, 1580, 1605, 1582, 1605,
+	1605, 1580, 1582, 1607, 1605, 1580, 1607, 1605, 1605, 1606, 1581,
+	1605, 1606, 1581, 1609, 1606, 1580, 1605, 1606, 1580, 1609, 1606,
+	1605, 1610, 1606, 1605, 1609, 1610, 1605, 1605, 1576, 1582, 1610,
+	1578, 1580, 1610, 1578, 1580, 1609, 1578, 1582, 1610, 1578, 1582,
+	1609, 1578, 1605, 1610, 1578, 1605, 1609, 1580, 1605, 1610, 1580,
+	1581, 1609, 1580, 1605, 1609, 1587, 1582, 1609, 1589, 1581, 1610,
+	1588, 1581, 1610, 1590, 1581, 1610, 1604, 1580, 1610, 1604, 1605,
+	1610, 1610, 1581, 1610, 1610, 1580, 1610, 1610, 1605, 1610, 1605,
+	1605, 1610, 1602, 1605, 1610, 1606, 1581, 1610, 1593, 1605, 1610,
+	1603, 1605, 1610, 1606, 1580, 1581, 1605, 1582, 1610, 1604, 1580,
+	1605, 1603, 1605, 1605, 1580, 1581, 1610, 1581, 1580, 1610, 1605,
+	1580, 1610, 1601, 1605, 1610, 1576, 1581, 1610, 1587, 1582, 1610,
+	1606, 1580, 1610, 1589, 1604, 1746, 1602, 1604, 1746, 1575, 1604,
+	1604, 1607, 1575, 1603, 1576, 1585, 1605, 1581, 1605, 1583, 1589,
+	1604, 1593, 1605, 1585, 1587, 1608, 1604, 1593, 1604, 1610, 1607,
+	1608, 1587, 1604, 1605, 1589, 1604, 1609, 1589, 1604, 1609, 32, 1575,
+	1604, 1604, 1607, 32, 1593, 1604, 1610, 1607, 32, 1608, 1587, 1604,
+	1605, 1580, 1604, 32, 1580, 1604, 1575, 1604, 1607, 1585, 1740, 1575,
+	1604, 44, 12289, 12290, 58, 33, 63, 12310, 12311, 8212, 8211, 95, 123,
+	125, 12308, 12309, 12304, 12305, 12298, 12299, 12300, 12301, 12302,
+	12303, 91, 93, 35, 38, 42, 45, 60, 62, 92, 36, 37, 64, 32, 1611, 1600,
+	1611, 32, 1612, 32, 1613, 32, 1614, 1600, 1614, 32, 1615, 1600, 1615,
+	32, 1616, 1600, 1616, 32, 1617, 1600, 1617, 32, 1618, 1600, 1618,
+	1569, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584,
+	1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601,
+	1602, 1603, 1604, 1605, 1606, 1607, 1608, 1610, 1604, 1575, 1619,
+	1604, 1575, 1620, 1604, 1575, 1621, 1604, 1575, 34, 39, 47, 94, 124,
+	126, 10629, 10630, 12539, 12449, 12451, 12453, 12455, 12457, 12515,
+	12517, 12519, 12483, 12540, 12531, 12441, 12442, 162, 163, 172, 166,
+	165, 8361, 9474, 8592, 8593, 8594, 8595, 9632, 9675, 720, 721, 230,
+	665, 595, 675, 43878, 677, 676, 598, 599, 7569, 600, 606, 681, 612,
+	610, 608, 667, 668, 615, 644, 682, 683, 620, 122628, 42894, 622,
+	122629, 654, 122630, 248, 630, 631, 634, 122632, 637, 638, 640, 680,
+	678, 43879, 679, 648, 11377, 655, 673, 674, 664, 448, 449, 450,
+	122634, 122654, 69785, 69818, 69787, 69818, 69797, 69818, 69937,
+	69927, 69938, 69927, 70471, 70462, 70471, 70487, 70841, 70842, 70841,
+	70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984, 119127,
+	119141, 119128, 119141, 119128, 119141, 119150, 119128, 119141,
+	119151, 119128, 119141, 119152, 119128, 119141, 119153, 119128,
+	119141, 119154, 119225, 119141, 119226, 119141, 119225, 119141,
+	119150, 119226, 119141, 119150, 119225, 119141, 119151, 119226,
+	119141, 119151, 305, 567, 913, 914, 916, 917, 918, 919, 921, 922, 923,
+	924, 925, 926, 927, 929, 932, 934, 935, 936, 8711, 945, 950, 951, 955,
+	957, 958, 959, 963, 964, 965, 968, 969, 8706, 988, 989, 1646, 1697,
+	1647, 48, 46, 48, 44, 49, 44, 50, 44, 51, 44, 52, 44, 53, 44, 54, 44,
+	55, 44, 56, 44, 57, 44, 40, 65, 41, 40, 66, 41, 40, 67, 41, 40, 68,
+	41, 40, 69, 41, 40, 70, 41, 40, 71, 41, 40, 72, 41, 40, 73, 41, 40,
+	74, 41, 40, 75, 41, 40, 76, 41, 40, 77, 41, 40, 78, 41, 40, 79, 41,
+	40, 80, 41, 40, 81, 41, 40, 82, 41, 40, 83, 41, 40, 84, 41, 40, 85,
+	41, 40, 86, 41, 40, 87, 41, 40, 88, 41, 40, 89, 41, 40, 90, 41, 12308,
+	83, 12309, 67, 68, 87, 90, 72, 86, 83, 68, 83, 83, 80, 80, 86, 87, 67,
+	77, 67, 77, 68, 77, 82, 68, 74, 12411, 12363, 12467, 12467, 23383,
+	21452, 22810, 35299, 20132, 26144, 28961, 21069, 24460, 20877, 26032,
+	21021, 32066, 36009, 22768, 21561, 28436, 25237, 25429, 36938, 25351,
+	25171, 31105, 31354, 21512, 28288, 30003, 21106, 21942, 37197, 12308,
+	26412, 12309, 12308, 19977, 12309, 12308, 20108, 12309, 12308, 23433,
+	12309, 12308, 28857, 12309, 12308, 25171, 12309, 12308, 30423, 12309,
+	12308, 21213, 12309, 12308, 25943, 12309, 24471, 21487, 20029, 20024,
+	20033, 131362, 20320, 20411, 20482, 20602, 20633, 20687, 13470,
+	132666, 20820, 20836, 20855, 132380, 13497, 20839, 132427, 20887,
+	20900, 20172, 20908, 168415, 20995, 13535, 21051, 21062, 21111, 13589,
+	21253, 21254, 21321, 21338, 21363, 21373, 21375, 133676, 28784, 21450,
+	21471, 133987, 21483, 21489, 21510, 21662, 21560, 21576, 21608, 21666,
+	21750, 21776, 21843, 21859, 21892, 21931, 21939, 21954, 22294, 22295,
+	22097, 22132, 22766, 22478, 22516, 22541, 22411, 22578, 22577, 22700,
+	136420, 22770, 22775, 22790, 22818, 22882, 136872, 136938, 23020,
+	23067, 23079, 23000, 23142, 14062, 14076, 23304, 23358, 137672, 23491,
+	23512, 23539, 138008, 23551, 23558, 24403, 14209, 23648, 23744, 23693,
+	138724, 23875, 138726, 23918, 23915, 23932, 24033, 24034, 14383,
+	24061, 24104, 24125, 24169, 14434, 139651, 14460, 24240, 24243, 24246,
+	172946, 140081, 33281, 24354, 14535, 144056, 156122, 24418, 24427,
+	14563, 24474, 24525, 24535, 24569, 24705, 14650, 14620, 141012, 24775,
+	24904, 24908, 24954, 25010, 24996, 25007, 25054, 25104, 25115, 25181,
+	25265, 25300, 25424, 142092, 25405, 25340, 25448, 25475, 25572,
+	142321, 25634, 25541, 25513, 14894, 25705, 25726, 25757, 25719, 14956,
+	25964, 143370, 26083, 26360, 26185, 15129, 15112, 15076, 20882, 20885,
+	26368, 26268, 32941, 17369, 26401, 26462, 26451, 144323, 15177, 26618,
+	26501, 26706, 144493, 26766, 26655, 26900, 26946, 27043, 27114, 27304,
+	145059, 27355, 15384, 27425, 145575, 27476, 15438, 27506, 27551,
+	27579, 146061, 138507, 146170, 27726, 146620, 27839, 27853, 27751,
+	27926, 27966, 28009, 28024, 28037, 146718, 27956, 28207, 28270, 15667,
+	28359, 147153, 28153, 28526, 147294, 147342, 28614, 28729, 28699,
+	15766, 28746, 28797, 28791, 28845, 132389, 28997, 148067, 29084,
+	148395, 29224, 29264, 149000, 29312, 29333, 149301, 149524, 29562,
+	29579, 16044, 29605, 16056, 29767, 29788, 29829, 29898, 16155, 29988,
+	150582, 30014, 150674, 139679, 30224, 151457, 151480, 151620, 16380,
+	16392, 151795, 151794, 151833, 151859, 30494, 30495, 30603, 16454,
+	16534, 152605, 30798, 16611, 153126, 153242, 153285, 31211, 16687,
+	31306, 31311, 153980, 154279, 31470, 16898, 154539, 31686, 31689,
+	16935, 154752, 31954, 17056, 31976, 31971, 32000, 155526, 32099,
+	17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377,
+	32634, 156478, 32661, 32762, 156890, 156963, 32864, 157096, 32880,
+	144223, 17365, 32946, 33027, 17419, 33086, 23221, 157607, 157621,
+	144275, 144284, 33284, 36766, 17515, 33425, 33419, 33437, 21171,
+	33457, 33459, 33469, 33510, 158524, 33565, 33635, 33709, 33571, 33725,
+	33767, 33619, 33738, 33740, 33756, 158774, 159083, 158933, 17707,
+	34033, 34035, 34070, 160714, 34148, 159532, 17757, 17761, 159665,
+	159954, 17771, 34384, 34407, 34409, 34473, 34440, 34574, 34530, 34600,
+	34667, 34694, 17879, 34785, 34817, 17913, 34912, 161383, 35031, 35038,
+	17973, 35066, 13499, 161966, 162150, 18110, 18119, 35488, 162984,
+	36011, 36033, 36123, 36215, 163631, 133124, 36299, 36284, 36336,
+	133342, 36564, 165330, 165357, 37012, 37105, 37137, 165678, 37147,
+	37432, 37591, 37592, 37500, 37881, 37909, 166906, 38283, 18837, 38327,
+	167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062,
+	38880, 168970, 19122, 169110, 38953, 169398, 39138, 19251, 39209,
+	39335, 39362, 39422, 19406, 170800, 40000, 40189, 19662, 19693, 40295,
+	172238, 19704, 172293, 172558, 172689, 19798, 40702, 40709, 40719,
+	40726, 173568
+};
+
+static const uint32_t normdecomp_canon[3746] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 834, 898, 962, 1026,
+	1090, 1154, 1218, 1282, 1346, 1410, 1474, 1538, 1602, 1666, 1730,
+	1794, 1858, 1922, 1986, 2050, 2114, 2178, 2242, 2306, 2370, 2434,
+	2498, 2562, 2626, 2690, 2754, 2818, 2882, 2946, 3010, 3074, 3138,
+	3202, 3266, 3330, 3394, 3458, 3522, 3586, 3650, 3714, 3778, 3842,
+	3906, 3970, 4034, 4098, 4162, 4226, 4290, 4354, 4418, 4482, 4546,
+	4610, 4674, 4738, 4802, 4866, 4930, 4994, 5058, 5122, 5186, 5250,
+	5314, 5378, 5442, 5506, 5570, 5634, 5698, 5762, 5826, 5890, 5954,
+	6018, 6082, 6146, 6210, 6274, 6338, 6402, 6466, 6530, 6594, 6658,
+	6722, 6786, 6850, 6914, 6978, 0, 0, 7170, 7234, 7298, 7362, 7426,
+	7490, 7554, 7618, 7682, 7746, 0, 0, 7938, 8002, 8066, 8130, 8194,
+	8258, 0, 8386, 8450, 8514, 8578, 8642, 8706, 8770, 8834, 8898, 8962,
+	9026, 9090, 9154, 9218, 9282, 9346, 9410, 9474, 9538, 9602, 9666,
+	9730, 9794, 9858, 9922, 9986, 10050, 10114, 10178, 10242, 10306,
+	10370, 10434, 10498, 10562, 10626, 10690, 10754, 10818, 10882, 10946,
+	11010, 11074, 11138, 11202, 11266, 11330, 0, 11426, 11490, 11554,
+	11618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12354, 12418, 12482, 12546, 12610,
+	12674, 12738, 12802, 12867, 12963, 13059, 13155, 13251, 13347, 13443,
+	13539, 13635, 13731, 13827, 13923, 14018, 14082, 14146, 14210, 14274,
+	14338, 14402, 14466, 14531, 14627, 14722, 14786, 14850, 0, 0, 0,
+	15106, 15170, 15234, 15298, 15363, 15459, 15554, 15618, 15682, 15746,
+	15810, 15874, 15938, 16002, 16066, 16130, 16194, 16258, 16322, 16386,
+	16450, 16514, 16578, 16642, 16706, 16770, 16834, 16898, 16962, 17026,
+	17090, 17154, 17218, 17282, 17346, 17410, 17474, 17538, 17602, 17666,
+	17730, 17794, 17858, 17922, 17987, 18083, 18179, 18275, 18370, 18434,
+	18499, 18595, 18690, 18754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 19617, 19649, 19681, 19714, 19777, 0, 19873, 19906,
+	20066, 20129, 20162, 20226, 20290, 20354, 20418, 20482, 20547, 20642,
+	20706, 20770, 20834, 20898, 20962, 21027, 21122, 21186, 21250, 21314,
+	21378, 0, 0, 0, 21538, 21602, 0, 0, 0, 0, 0, 0, 0, 0, 21922, 21986,
+	22050, 22114, 22178, 22242, 22306, 22370, 22434, 22498, 22562, 22626,
+	22690, 22754, 22818, 22882, 22946, 23010, 23074, 23138, 23202, 23266,
+	23330, 23394, 23458, 23522, 23586, 23650, 23714, 23778, 23842, 23906,
+	23970, 24034, 24098, 24162, 24226, 24290, 24354, 24418, 24482, 24546,
+	24610, 24674, 24738, 24802, 24866, 24930, 24994, 25058, 25122, 25186,
+	0, 25314, 25378, 25442, 25506, 25570, 0, 0, 0, 0, 25890, 25954, 26018,
+	26082, 26146, 26210, 26274, 26338, 26402, 26466, 26530, 26594, 26658,
+	26722, 26786, 26850, 26914, 26978, 27042, 27106, 27170, 27234, 27298,
+	27362, 27426, 27490, 27554, 27618, 27682, 27746, 27810, 27874, 27938,
+	28002, 28066, 28130, 28194, 28258, 28322, 28387, 28482, 28546, 28610,
+	28674, 28738, 28803, 28898, 0, 0, 0, 0, 0, 29250, 29314, 29378, 29442,
+	29506, 29570, 29634, 29698, 29762, 0, 29922, 0, 30082, 30146, 30210,
+	30274, 30338, 30402, 30466, 30530, 0, 30626, 30690, 30754, 30818,
+	30882, 30946, 31010, 31074, 31138, 31202, 31266, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 34018, 34082, 34146, 34210, 34274, 34338,
+	34402, 34466, 34531, 34627, 34722, 34786, 34850, 34914, 34978, 35042,
+	35106, 35170, 35234, 35298, 35363, 35459, 35555, 35651, 35746, 35810,
+	35874, 35938, 36003, 36099, 36194, 36258, 36322, 36386, 36450, 36514,
+	36578, 36642, 36706, 36770, 36834, 36898, 36962, 37026, 37090, 37154,
+	37219, 37315, 37410, 37474, 37538, 37602, 37666, 37730, 37794, 37858,
+	37923, 38019, 38114, 38178, 38242, 38306, 38370, 38434, 38498, 38562,
+	38626, 38690, 38754, 38818, 38882, 38946, 39010, 39074, 39138, 39202,
+	39267, 39363, 39459, 39555, 39651, 39747, 39843, 39939, 40034, 40098,
+	40162, 40226, 40290, 40354, 40418, 40482, 40547, 40643, 40738, 40802,
+	40866, 40930, 40994, 41058, 41123, 41219, 41315, 41411, 41507, 41603,
+	41698, 41762, 41826, 41890, 41954, 42018, 42082, 42146, 42210, 42274,
+	42338, 42402, 42466, 42530, 42595, 42691, 42787, 42883, 42978, 43042,
+	43106, 43170, 43234, 43298, 43362, 43426, 43490, 43554, 43618, 43682,
+	43746, 43810, 43874, 43938, 44002, 44066, 44130, 44194, 44258, 44322,
+	44386, 44450, 44514, 44578, 44642, 44706, 44770, 44834, 0, 44962,
+	45026, 45090, 45154, 45218, 45283, 45379, 45475, 45571, 45667, 45763,
+	45859, 45955, 46051, 46147, 46243, 46339, 46435, 46531, 46627, 46723,
+	46819, 46915, 47011, 47107, 47202, 47266, 47330, 47394, 47458, 47522,
+	47587, 47683, 47779, 47875, 47971, 48067, 48163, 48259, 48355, 48451,
+	48546, 48610, 48674, 48738, 48802, 48866, 48930, 48994, 49059, 49155,
+	49251, 49347, 49443, 49539, 49635, 49731, 49827, 49923, 50019, 50115,
+	50211, 50307, 50403, 50499, 50595, 50691, 50787, 50883, 50978, 51042,
+	51106, 51170, 51235, 51331, 51427, 51523, 51619, 51715, 51811, 51907,
+	52003, 52099, 52194, 52258, 52322, 52386, 52450, 52514, 52578, 52642,
+	52706, 52770, 52835, 52931, 53027, 53123, 53219, 53315, 53410, 53474,
+	53539, 53635, 53731, 53827, 53923, 54019, 54114, 54178, 54243, 54339,
+	54435, 54531, 54626, 54690, 54755, 54851, 54947, 55043, 55138, 55202,
+	55267, 55363, 55459, 55555, 55651, 55747, 55842, 55906, 55971, 56067,
+	56163, 56259, 56355, 56451, 56546, 56610, 56675, 56771, 56867, 56963,
+	57059, 57155, 57250, 57314, 57379, 57475, 57571, 57667, 57763, 57859,
+	57954, 58018, 58083, 58179, 58275, 58371, 58466, 58530, 58595, 58691,
+	58787, 58883, 58978, 59042, 59107, 59203, 59299, 59395, 59491, 59587,
+	59682, 59747, 59843, 59939, 60034, 60098, 60163, 60259, 60355, 60451,
+	60547, 60643, 60738, 60802, 60867, 60963, 61059, 61155, 61251, 61347,
+	61442, 61506, 61570, 61634, 61698, 61762, 61826, 61891, 61987, 62084,
+	62212, 62340, 62468, 62596, 62724, 62851, 62947, 63044, 63172, 63300,
+	63428, 63556, 63684, 63811, 63907, 64004, 64132, 64260, 64388, 64516,
+	64644, 64771, 64867, 64964, 65092, 65220, 65348, 65476, 65604, 65731,
+	65827, 65924, 66052, 66180, 66308, 66436, 66564, 66691, 66787, 66884,
+	67012, 67140, 67268, 67396, 67524, 67650, 67714, 67779, 67874, 67939,
+	68034, 68099, 68194, 68258, 68322, 68386, 0, 68513, 0, 68610, 68771,
+	68866, 68931, 69026, 69091, 69186, 69250, 69314, 69378, 69538, 69698,
+	69858, 69922, 69987, 70082, 70147, 70242, 70306, 70370, 70434, 70594,
+	70754, 70914, 70978, 71043, 71138, 71202, 71266, 71331, 71426, 71490,
+	71554, 71618, 71682, 71841, 71875, 71970, 72035, 72130, 72195, 72290,
+	72354, 72418, 72481, 0, 72577, 72609, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75137, 31649, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78690, 78754, 78818, 78882,
+	78946, 79010, 79074, 79138, 79202, 79266, 79330, 0, 0, 0, 0, 79714,
+	79778, 79842, 79906, 79970, 80034, 80098, 80162, 80226, 80290, 80354,
+	80418, 80482, 80546, 80610, 80674, 80738, 80802, 80866, 80930, 80994,
+	81058, 81122, 81186, 81250, 81314, 81378, 81442, 81506, 81570, 81634,
+	81698, 81762, 81825, 81857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 89474, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96578, 96642, 96706,
+	96770, 96834, 96898, 96962, 97026, 97090, 97154, 97218, 97282, 97346,
+	97410, 97474, 97538, 97602, 97666, 97730, 97794, 97858, 97922, 97986,
+	98050, 98114, 98178, 0, 0, 98370, 0, 98498, 98562, 98626, 98690,
+	98754, 98818, 98882, 98946, 99010, 99074, 99138, 99202, 99266, 99330,
+	99394, 99458, 99522, 99586, 99650, 99714, 99778, 99842, 99906, 99970,
+	100034, 100098, 100162, 100226, 100290, 100354, 100418, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 143041, 143073, 94689, 143105, 143137, 143169, 143201,
+	96417, 143233, 94945, 143265, 143297, 143329, 143361, 143393, 143425,
+	143457, 143489, 143521, 143553, 143585, 143617, 143649, 143681,
+	143713, 143745, 143777, 143809, 143841, 143873, 143905, 143937,
+	143969, 144001, 144033, 144065, 144097, 144129, 144161, 144193,
+	144225, 144257, 144289, 144321, 144353, 144385, 144417, 144449,
+	144481, 144513, 144545, 93601, 144577, 144609, 144641, 144673, 144705,
+	144737, 144769, 144801, 144833, 144865, 144897, 95937, 144929, 144961,
+	144993, 145025, 145057, 145089, 145121, 145153, 145185, 145217,
+	145249, 145281, 145313, 145345, 145377, 145409, 145441, 145473,
+	145505, 145537, 145569, 145601, 145633, 145665, 145697, 145729,
+	145761, 145793, 145825, 145857, 145889, 145921, 145953, 145985,
+	146017, 146049, 146081, 146113, 146145, 146177, 146209, 146241,
+	146273, 146305, 146337, 146369, 146401, 94753, 146433, 146465, 146497,
+	146529, 146561, 146593, 146625, 146657, 146689, 146721, 146753,
+	146785, 146817, 146849, 146881, 90817, 146913, 146945, 146977, 147009,
+	147041, 147073, 147105, 147137, 90209, 147169, 147201, 147233, 147265,
+	147297, 147329, 147361, 147393, 147425, 147457, 147489, 147521,
+	147553, 147585, 147617, 147649, 147681, 147713, 147745, 147777,
+	147809, 147841, 147873, 147905, 147937, 147969, 148001, 148033,
+	148065, 148097, 148129, 148161, 148193, 148225, 148257, 148289,
+	148321, 148353, 148385, 148417, 148449, 148481, 148513, 148545,
+	148577, 148609, 148641, 148673, 148705, 148737, 148769, 148801,
+	148833, 148865, 96385, 148897, 148929, 148961, 148993, 149025, 149057,
+	149089, 149121, 149153, 149185, 149217, 149249, 113441, 149281,
+	149313, 149345, 149377, 149409, 149441, 149473, 149505, 149537,
+	149569, 149601, 149633, 149665, 149697, 149729, 149761, 149793,
+	149825, 149857, 149889, 149921, 149953, 94913, 149985, 150017, 150049,
+	150081, 150113, 150145, 150177, 150209, 150241, 150273, 150305,
+	150337, 150369, 93345, 150401, 150433, 150465, 150497, 150529, 150561,
+	150593, 150625, 150657, 150689, 150721, 150753, 150785, 150817,
+	150849, 150881, 94209, 150913, 94305, 150945, 150977, 151009, 151041,
+	151073, 151105, 151137, 151169, 151201, 151233, 151265, 151297,
+	151329, 151361, 93569, 151393, 151425, 151457, 151489, 151521, 151553,
+	151585, 151617, 151649, 151681, 151713, 151745, 151777, 151809,
+	151841, 151873, 151905, 151937, 151969, 152001, 152033, 152065, 91041,
+	152097, 152129, 152161, 152193, 152225, 152257, 152289, 152321,
+	152353, 152385, 152417, 152449, 152481, 152513, 152545, 113601,
+	152577, 152609, 152641, 152673, 113729, 152705, 152737, 152769,
+	152801, 152833, 152865, 152897, 152929, 152961, 152993, 153025,
+	153057, 153089, 153121, 153153, 153185, 153217, 153249, 153281,
+	153313, 153345, 153377, 153409, 153441, 153473, 153505, 153537,
+	153569, 153601, 153633, 153665, 153697, 153729, 153761, 153793,
+	153825, 153857, 153889, 153921, 153953, 153985, 154017, 154049,
+	154081, 154113, 154145, 154177, 154209, 154241, 154273, 154305,
+	154337, 154369, 154401, 154433, 154465, 92097, 154497, 154529, 154561,
+	154593, 154625, 154657, 154689, 154721, 154753, 154785, 154817,
+	154849, 154881, 154913, 154945, 154977, 155009, 155041, 155073,
+	155105, 155137, 155169, 155201, 155233, 155265, 155297, 155329,
+	155361, 155393, 155425, 155457, 155489, 155521, 155553, 155585,
+	155617, 155649, 155681, 155713, 155745, 155777, 155809, 155841,
+	155873, 155905, 155937, 155969, 156001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 156802, 156866, 0, 0, 0, 0, 0, 0, 0, 157154, 157218, 157283,
+	157379, 157474, 157538, 157602, 157666, 157730, 157794, 157858,
+	157922, 157986, 158050, 158114, 158178, 158242, 158306, 158370,
+	158434, 158498, 158562, 158626, 158690, 158754, 158818, 158882,
+	158946, 159010, 159074, 159138, 159202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 189602, 189666, 189730, 189794, 189858, 189922,
+	189986, 190050, 190114, 190178, 190242, 190306, 190370, 190434,
+	190498, 190563, 190659, 190755, 190851, 190947, 191042, 191106,
+	191171, 191267, 191363, 191459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 198849, 198881, 198913, 198945, 198977, 199009,
+	199041, 199073, 199105, 199137, 199169, 199201, 199233, 199265,
+	199297, 199329, 199361, 199393, 197249, 199425, 199457, 199489,
+	199521, 199553, 199585, 90145, 199617, 199649, 199681, 199713, 197825,
+	199745, 199777, 199809, 199841, 199873, 199905, 199937, 199969,
+	200001, 200033, 200065, 200097, 200129, 200161, 200193, 200225,
+	200257, 200289, 200321, 200353, 200385, 200417, 200449, 200481,
+	200513, 200545, 200577, 200609, 200641, 200673, 200705, 200737,
+	200769, 200801, 200833, 200865, 200897, 200929, 200961, 200993,
+	201025, 201057, 201089, 201121, 201153, 201185, 197025, 201217,
+	201249, 201281, 201313, 201345, 201377, 201409, 201441, 201473,
+	201505, 201537, 201569, 201601, 201633, 201665, 201697, 201729,
+	201761, 201793, 201825, 201857, 90977, 201889, 201921, 201953, 201985,
+	202017, 202049, 202081, 202113, 202145, 202177, 202209, 202241,
+	202273, 202305, 202337, 202369, 202401, 202433, 202465, 202497,
+	202529, 202561, 202593, 202625, 91361, 202657, 202689, 202721, 202753,
+	202785, 202817, 202849, 202881, 202913, 202945, 202977, 203009,
+	203041, 203073, 203105, 203137, 203169, 203201, 203233, 203265,
+	203297, 203329, 203361, 203393, 203425, 203457, 203489, 203521,
+	203553, 203585, 203617, 203649, 203681, 203713, 203745, 203777,
+	203809, 203841, 203873, 203905, 203937, 203969, 204001, 204033,
+	204065, 204097, 204129, 204161, 204193, 204225, 204257, 204289,
+	204321, 204353, 204385, 204417, 204449, 204481, 204513, 204545,
+	204577, 204609, 204641, 204673, 204705, 204737, 204769, 204801,
+	204833, 204865, 204897, 204929, 204961, 204993, 205025, 205057,
+	205089, 205121, 205153, 205185, 205217, 205249, 205281, 205313,
+	205345, 205377, 205409, 205441, 205473, 205505, 205537, 205569,
+	205601, 205633, 205665, 205697, 205729, 205761, 205793, 205825,
+	205857, 205889, 205921, 205953, 205985, 206017, 206049, 206081,
+	206113, 206145, 206177, 206209, 206241, 206273, 206305, 206337,
+	206369, 206401, 206433, 206465, 206497, 206529, 206561, 206593,
+	206625, 206657, 206689, 206721, 206753, 206785, 206817, 206849,
+	206881, 206913, 206945, 206977, 207009, 207041, 207073, 207105,
+	207137, 207169, 207201, 207233, 207265, 207297, 207329, 207361,
+	207393, 207425, 207457, 207489, 207521, 207553, 207585, 207617,
+	207649, 207681, 207713, 207745, 207777, 207809, 207841, 207873,
+	207905, 207937, 207969, 208001, 208033, 208065, 208097, 208129,
+	208161, 208193, 208225, 208257, 208289, 208321, 208353, 208385,
+	208417, 208449, 208481, 208513, 208545, 208577, 208609, 208641,
+	208673, 208705, 208737, 208769, 208801, 208833, 208865, 208897,
+	208929, 208961, 208993, 209025, 209057, 209089, 209121, 209153,
+	209185, 209217, 209249, 209281, 209313, 209345, 209377, 209409,
+	209441, 209473, 209505, 209537, 209569, 209601, 209633, 209665,
+	209697, 209729, 209761, 209793, 209825, 209857, 209889, 209921,
+	209953, 209985, 210017, 210049, 210081, 210113, 210145, 210177,
+	210209, 210241, 210273, 210305, 210337, 210369, 210401, 210433,
+	210465, 210497, 210529, 210561, 210593, 210625, 210657, 210689,
+	210721, 210753, 210785, 210817, 210849, 210881, 210913, 210945,
+	210977, 211009, 211041, 211073, 211105, 211137, 211169, 211201, 94241,
+	211233, 211265, 211297, 211329, 211361, 211393, 211425, 211457,
+	211489, 211521, 211553, 94465, 211585, 211617, 211649, 211681, 211713,
+	211745, 211777, 211809, 211841, 211873, 211905, 211937, 211969,
+	212001, 212033, 212065, 212097, 212129, 212161, 212193, 212225,
+	212257, 212289, 212321, 212353, 212385, 212417, 212449, 212481,
+	212513, 212545, 212577, 212609, 212641, 212673, 212705, 212737,
+	212769, 212801, 212833, 212865, 212897, 212929, 212961, 212993,
+	213025, 213057, 213089, 213121, 213153, 213185, 213217, 213249,
+	213281, 213313, 213345, 213377, 213409, 213441, 213473, 213505,
+	213537, 96001, 213569, 96129, 213601, 213633, 213665, 213697, 96289,
+	213729
+};
+
+static const uint32_t normdecomp_compat[3746] = {
+	0, 1, 34, 97, 130, 193, 225, 258, 321, 354, 417, 449, 483, 579, 675,
+	770, 834, 898, 962, 1026, 1090, 1154, 1218, 1282, 1346, 1410, 1474,
+	1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986, 2050, 2114, 2178,
+	2242, 2306, 2370, 2434, 2498, 2562, 2626, 2690, 2754, 2818, 2882,
+	2946, 3010, 3074, 3138, 3202, 3266, 3330, 3394, 3458, 3522, 3586,
+	3650, 3714, 3778, 3842, 3906, 3970, 4034, 4098, 4162, 4226, 4290,
+	4354, 4418, 4482, 4546, 4610, 4674, 4738, 4802, 4866, 4930, 4994,
+	5058, 5122, 5186, 5250, 5314, 5378, 5442, 5506, 5570, 5634, 5698,
+	5762, 5826, 5890, 5954, 6018, 6082, 6146, 6210, 6274, 6338, 6402,
+	6466, 6530, 6594, 6658, 6722, 6786, 6850, 6914, 6978, 7042, 7106,
+	7170, 7234, 7298, 7362, 7426, 7490, 7554, 7618, 7682, 7746, 7810,
+	7874, 7938, 8002, 8066, 8130, 8194, 8258, 8322, 8386, 8450, 8514,
+	8578, 8642, 8706, 8770, 8834, 8898, 8962, 9026, 9090, 9154, 9218,
+	9282, 9346, 9410, 9474, 9538, 9602, 9666, 9730, 9794, 9858, 9922,
+	9986, 10050, 10114, 10178, 10242, 10306, 10370, 10434, 10498, 10562,
+	10626, 10690, 10754, 10818, 10882, 10946, 11010, 11074, 11138, 11202,
+	11266, 11330, 11393, 11426, 11490, 11554, 11618, 11683, 11779, 11875,
+	11970, 12034, 12098, 12162, 12226, 12290, 12354, 12418, 12482, 12546,
+	12610, 12674, 12738, 12802, 12867, 12963, 13059, 13155, 13251, 13347,
+	13443, 13539, 13635, 13731, 13827, 13923, 14018, 14082, 14146, 14210,
+	14274, 14338, 14402, 14466, 14531, 14627, 14722, 14786, 14850, 14914,
+	14978, 15042, 15106, 15170, 15234, 15298, 15363, 15459, 15554, 15618,
+	15682, 15746, 15810, 15874, 15938, 16002, 16066, 16130, 16194, 16258,
+	16322, 16386, 16450, 16514, 16578, 16642, 16706, 16770, 16834, 16898,
+	16962, 17026, 17090, 17154, 17218, 17282, 17346, 17410, 17474, 17538,
+	17602, 17666, 17730, 17794, 17858, 17922, 17987, 18083, 18179, 18275,
+	18370, 18434, 18499, 18595, 18690, 18754, 18817, 18849, 18881, 18913,
+	18945, 18977, 19009, 19041, 19073, 19106, 19170, 19234, 19298, 19362,
+	19426, 19489, 19521, 19553, 19585, 19617, 19649, 19681, 19714, 19777,
+	19810, 19873, 19971, 20066, 20129, 20162, 20226, 20290, 20354, 20418,
+	20482, 20547, 20642, 20706, 20770, 20834, 20898, 20962, 21027, 21122,
+	21186, 21250, 21314, 21378, 21441, 21473, 21505, 20418, 20706, 21665,
+	21697, 21729, 21761, 21793, 21825, 21857, 21889, 21922, 21986, 22050,
+	22114, 22178, 22242, 22306, 22370, 22434, 22498, 22562, 22626, 22690,
+	22754, 22818, 22882, 22946, 23010, 23074, 23138, 23202, 23266, 23330,
+	23394, 23458, 23522, 23586, 23650, 23714, 23778, 23842, 23906, 23970,
+	24034, 24098, 24162, 24226, 24290, 24354, 24418, 24482, 24546, 24610,
+	24674, 24738, 24802, 24866, 24930, 24994, 25058, 25122, 25186, 25250,
+	25314, 25378, 25442, 25506, 25570, 25634, 25698, 25762, 25826, 25890,
+	25954, 26018, 26082, 26146, 26210, 26274, 26338, 26402, 26466, 26530,
+	26594, 26658, 26722, 26786, 26850, 26914, 26978, 27042, 27106, 27170,
+	27234, 27298, 27362, 27426, 27490, 27554, 27618, 27682, 27746, 27810,
+	27874, 27938, 28002, 28066, 28130, 28194, 28258, 28322, 28387, 28482,
+	28546, 28610, 28674, 28738, 28803, 28898, 28962, 29026, 29090, 29154,
+	29217, 29250, 29314, 29378, 29442, 29506, 29570, 29634, 29698, 29762,
+	29827, 29922, 29987, 30082, 30146, 30210, 30274, 30338, 30402, 30466,
+	30530, 30593, 30626, 30690, 30754, 30818, 30882, 30946, 31010, 31074,
+	31138, 31202, 31266, 31329, 31361, 31393, 31425, 31457, 31489, 31521,
+	31553, 31585, 31617, 31649, 31681, 31713, 31745, 31777, 31809, 31841,
+	31873, 31905, 31937, 31969, 32001, 32033, 32065, 32097, 32129, 32161,
+	32193, 32225, 32257, 32289, 32321, 32353, 32385, 32417, 32449, 32481,
+	32513, 32545, 32577, 32609, 32641, 32673, 32705, 32737, 32769, 32801,
+	32833, 32865, 32897, 32929, 32961, 32993, 33025, 33057, 33089, 33121,
+	33153, 33185, 33217, 33249, 33281, 33313, 33345, 33377, 33409, 33441,
+	33473, 33505, 33537, 33569, 33601, 33633, 33665, 33697, 33729, 33761,
+	33793, 33825, 33857, 33889, 33921, 33953, 33985, 34018, 34082, 34146,
+	34210, 34274, 34338, 34402, 34466, 34531, 34627, 34722, 34786, 34850,
+	34914, 34978, 35042, 35106, 35170, 35234, 35298, 35363, 35459, 35555,
+	35651, 35746, 35810, 35874, 35938, 36003, 36099, 36194, 36258, 36322,
+	36386, 36450, 36514, 36578, 36642, 36706, 36770, 36834, 36898, 36962,
+	37026, 37090, 37154, 37219, 37315, 37410, 37474, 37538, 37602, 37666,
+	37730, 37794, 37858, 37923, 38019, 38114, 38178, 38242, 38306, 38370,
+	38434, 38498, 38562, 38626, 38690, 38754, 38818, 38882, 38946, 39010,
+	39074, 39138, 39202, 39267, 39363, 39459, 39555, 39651, 39747, 39843,
+	39939, 40034, 40098, 40162, 40226, 40290, 40354, 40418, 40482, 40547,
+	40643, 40738, 40802, 40866, 40930, 40994, 41058, 41123, 41219, 41315,
+	41411, 41507, 41603, 41698, 41762, 41826, 41890, 41954, 42018, 42082,
+	42146, 42210, 42274, 42338, 42402, 42466, 42530, 42595, 42691, 42787,
+	42883, 42978, 43042, 43106, 43170, 43234, 43298, 43362, 43426, 43490,
+	43554, 43618, 43682, 43746, 43810, 43874, 43938, 44002, 44066, 44130,
+	44194, 44258, 44322, 44386, 44450, 44514, 44578, 44642, 44706, 44770,
+	44834, 44898, 40930, 45026, 45090, 45154, 45218, 45283, 45379, 45475,
+	45571, 45667, 45763, 45859, 45955, 46051, 46147, 46243, 46339, 46435,
+	46531, 46627, 46723, 46819, 46915, 47011, 47107, 47202, 47266, 47330,
+	47394, 47458, 47522, 47587, 47683, 47779, 47875, 47971, 48067, 48163,
+	48259, 48355, 48451, 48546, 48610, 48674, 48738, 48802, 48866, 48930,
+	48994, 49059, 49155, 49251, 49347, 49443, 49539, 49635, 49731, 49827,
+	49923, 50019, 50115, 50211, 50307, 50403, 50499, 50595, 50691, 50787,
+	50883, 50978, 51042, 51106, 51170, 51235, 51331, 51427, 51523, 51619,
+	51715, 51811, 51907, 52003, 52099, 52194, 52258, 52322, 52386, 52450,
+	52514, 52578, 52642, 52706, 52770, 52835, 52931, 53027, 53123, 53219,
+	53315, 53410, 53474, 53539, 53635, 53731, 53827, 53923, 54019, 54114,
+	54178, 54243, 54339, 54435, 54531, 54626, 54690, 54755, 54851, 54947,
+	55043, 55138, 55202, 55267, 55363, 55459, 55555, 55651, 55747, 55842,
+	55906, 55971, 56067, 56163, 56259, 56355, 56451, 56546, 56610, 56675,
+	56771, 56867, 56963, 57059, 57155, 57250, 57314, 57379, 57475, 57571,
+	57667, 57763, 57859, 57954, 58018, 58083, 58179, 58275, 58371, 58466,
+	58530, 58595, 58691, 58787, 58883, 58978, 59042, 59107, 59203, 59299,
+	59395, 59491, 59587, 59682, 59747, 59843, 59939, 60034, 60098, 60163,
+	60259, 60355, 60451, 60547, 60643, 60738, 60802, 60867, 60963, 61059,
+	61155, 61251, 61347, 61442, 61506, 61570, 61634, 61698, 61762, 61826,
+	61891, 61987, 62084, 62212, 62340, 62468, 62596, 62724, 62851, 62947,
+	63044, 63172, 63300, 63428, 63556, 63684, 63811, 63907, 64004, 64132,
+	64260, 64388, 64516, 64644, 64771, 64867, 64964, 65092, 65220, 65348,
+	65476, 65604, 65731, 65827, 65924, 66052, 66180, 66308, 66436, 66564,
+	66691, 66787, 66884, 67012, 67140, 67268, 67396, 67524, 67650, 67714,
+	67779, 67874, 67939, 68034, 68099, 68194, 68258, 68322, 68386, 68450,
+	68513, 68546, 68675, 68771, 68866, 68931, 69026, 69091, 69186, 69250,
+	69314, 69443, 69603, 69763, 69858, 69922, 69987, 70082, 70147, 70242,
+	70306, 70370, 70499, 70659, 70819, 70914, 70978, 71043, 71138, 71202,
+	71266, 71331, 71426, 71490, 71554, 71618, 71747, 71841, 71875, 71970,
+	72035, 72130, 72195, 72290, 72354, 72418, 258, 72514, 1, 1, 72641,
+	72674, 72737, 72770, 72835, 72930, 72995, 73090, 73155, 73250, 73314,
+	73378, 73442, 73506, 73572, 73697, 73729, 73761, 73793, 73825, 73857,
+	73889, 73921, 73953, 73985, 74017, 74049, 74081, 74114, 74179, 74275,
+	74369, 74402, 74467, 74563, 74657, 74690, 74753, 74786, 74849, 74882,
+	74947, 75042, 75105, 75137, 31649, 75169, 75201, 75233, 75265, 75297,
+	75331, 75425, 75457, 75489, 75523, 75619, 75716, 75843, 75939, 76035,
+	76131, 76227, 76323, 76419, 76515, 76611, 76707, 76803, 76899, 76994,
+	77058, 77123, 77218, 77281, 77314, 77379, 77476, 77602, 77665, 77698,
+	77763, 77858, 77923, 78018, 78082, 78147, 78244, 78370, 78434, 78499,
+	78595, 78690, 78754, 78818, 78882, 78946, 79010, 79074, 79138, 79202,
+	79266, 79330, 79394, 79459, 79554, 79619, 79714, 79778, 79842, 79906,
+	79970, 80034, 80098, 80162, 80226, 80290, 80354, 80418, 80482, 80546,
+	80610, 80674, 80738, 80802, 80866, 80930, 80994, 81058, 81122, 81186,
+	81250, 81314, 81378, 81442, 81506, 81570, 81634, 81698, 81762, 81825,
+	81857, 81890, 81954, 82018, 82082, 82146, 82210, 82274, 82338, 82402,
+	82466, 82530, 82595, 82691, 82787, 82883, 82979, 83075, 83171, 83267,
+	83363, 83460, 83588, 83716, 83844, 83972, 84100, 84228, 84356, 84484,
+	84612, 84740, 84866, 84930, 84994, 85058, 85122, 85186, 85250, 85314,
+	85378, 85443, 85539, 85635, 85731, 85827, 85923, 86019, 86115, 86211,
+	86307, 86403, 86499, 86595, 86691, 86787, 86883, 86979, 87075, 87171,
+	87267, 87363, 87459, 87555, 87651, 87747, 87843, 87939, 88035, 88131,
+	88227, 88323, 88419, 88515, 88611, 88707, 88803, 88899, 88993, 89025,
+	89057, 89092, 89219, 89314, 89379, 89474, 89537, 89569, 89601, 89633,
+	89665, 89697, 89729, 89761, 89793, 89825, 89857, 89889, 89921, 89953,
+	89985, 90017, 90049, 90081, 90113, 90145, 90177, 90209, 90241, 90273,
+	90305, 90337, 90369, 90401, 90433, 90465, 90497, 90529, 90561, 90593,
+	90625, 90657, 90689, 90721, 90753, 90785, 90817, 90849, 90881, 90913,
+	90945, 90977, 91009, 91041, 91073, 91105, 91137, 91169, 91201, 91233,
+	91265, 91297, 91329, 91361, 91393, 91425, 91457, 91489, 91521, 91553,
+	91585, 91617, 91649, 91681, 91713, 91745, 91777, 91809, 91841, 91873,
+	91905, 91937, 91969, 92001, 92033, 92065, 92097, 92129, 92161, 92193,
+	92225, 92257, 92289, 92321, 92353, 92385, 92417, 92449, 92481, 92513,
+	92545, 92577, 92609, 92641, 92673, 92705, 92737, 92769, 92801, 92833,
+	92865, 92897, 92929, 92961, 92993, 93025, 93057, 93089, 93121, 93153,
+	93185, 93217, 93249, 93281, 93313, 93345, 93377, 93409, 93441, 93473,
+	93505, 93537, 93569, 93601, 93633, 93665, 93697, 93729, 93761, 93793,
+	93825, 93857, 93889, 93921, 93953, 93985, 94017, 94049, 94081, 94113,
+	94145, 94177, 94209, 94241, 94273, 94305, 94337, 94369, 94401, 94433,
+	94465, 94497, 94529, 94561, 94593, 94625, 94657, 94689, 94721, 94753,
+	94785, 94817, 94849, 94881, 94913, 94945, 94977, 95009, 95041, 95073,
+	95105, 95137, 95169, 95201, 95233, 95265, 95297, 95329, 95361, 95393,
+	95425, 95457, 95489, 95521, 95553, 95585, 95617, 95649, 95681, 95713,
+	95745, 95777, 95809, 95841, 95873, 95905, 95937, 95969, 96001, 96033,
+	96065, 96097, 96129, 96161, 96193, 96225, 96257, 96289, 96321, 96353,
+	96385, 96417, 96449, 96481, 96513, 96545, 96578, 96642, 96706, 96770,
+	96834, 96898, 96962, 97026, 97090, 97154, 97218, 97282, 97346, 97410,
+	97474, 97538, 97602, 97666, 97730, 97794, 97858, 97922, 97986, 98050,
+	98114, 98178, 98242, 98306, 98370, 98434, 98498, 98562, 98626, 98690,
+	98754, 98818, 98882, 98946, 99010, 99074, 99138, 99202, 99266, 99330,
+	99394, 99458, 99522, 99586, 99650, 99714, 99778, 99842, 99906, 99970,
+	100034, 100098, 100162, 100226, 100290, 100354, 100418, 100482,
+	100545, 100577, 100609, 100641, 100673, 100705, 100737, 100769,
+	100801, 100833, 100865, 100897, 100929, 100961, 100993, 101025,
+	101057, 101089, 101121, 101153, 101185, 101217, 101249, 101281,
+	101313, 101345, 101377, 101409, 101441, 101473, 101505, 101537,
+	101569, 101601, 101633, 101665, 101697, 101729, 101761, 101793,
+	101825, 101857, 101889, 101921, 101953, 101985, 102017, 102049,
+	102081, 102113, 102145, 102177, 102209, 102241, 102273, 102305,
+	102337, 102369, 102401, 102433, 102465, 102497, 102529, 102561,
+	102593, 102625, 102657, 102689, 102721, 102753, 102785, 102817,
+	102849, 102881, 102913, 102945, 102977, 103009, 103041, 103073,
+	103105, 103137, 103169, 103201, 103233, 103265, 103297, 103329,
+	103361, 103393, 103425, 103457, 103489, 103521, 103553, 103585,
+	103617, 103649, 103681, 103713, 103745, 103777, 103809, 103841,
+	103875, 103971, 104067, 104163, 104259, 104355, 104451, 104547,
+	104643, 104739, 104835, 104931, 105027, 105123, 105220, 105348,
+	105476, 105604, 105732, 105860, 105988, 106116, 106244, 106372,
+	106500, 106628, 106756, 106884, 107012, 107143, 107366, 107555,
+	107651, 107747, 107843, 107939, 108035, 108131, 108227, 108323,
+	108419, 108515, 108611, 108707, 108803, 108899, 108995, 109091,
+	109187, 109283, 109379, 109475, 109571, 109667, 109763, 109859,
+	109955, 110051, 110147, 110243, 110339, 110435, 110531, 110627,
+	110723, 110819, 110915, 111009, 111041, 111073, 111107, 111202,
+	111266, 111330, 111394, 111458, 111522, 111586, 111650, 111714,
+	111778, 111842, 111906, 111970, 112034, 112098, 112162, 112226,
+	112290, 112354, 112418, 112482, 112546, 112610, 112674, 112738,
+	112802, 112866, 112930, 112994, 113061, 113220, 113346, 113409,
+	113441, 113473, 113505, 113537, 113569, 113601, 113633, 113665,
+	113697, 113729, 113761, 113793, 113825, 113857, 113889, 113921,
+	113953, 113985, 114017, 114049, 114081, 114113, 114145, 114177,
+	114209, 114241, 114273, 114305, 114337, 114369, 114401, 114434,
+	114498, 114562, 114626, 114690, 114754, 114818, 114882, 114946,
+	115010, 115074, 115138, 115202, 115266, 115330, 115394, 115458,
+	115522, 115586, 115650, 115714, 115778, 115842, 115906, 115971,
+	116067, 116163, 116258, 116323, 116418, 116483, 116577, 116609,
+	116641, 116673, 116705, 116737, 116769, 116801, 116833, 116865,
+	116897, 116929, 116961, 116993, 117025, 117057, 117089, 117121,
+	117153, 117185, 117217, 117249, 117281, 117313, 117345, 117377,
+	117409, 117441, 117473, 117505, 117537, 117569, 117601, 117633,
+	117665, 117697, 117729, 117761, 117793, 117825, 117857, 117889,
+	117921, 117953, 117985, 118017, 118049, 118082, 118149, 118308,
+	118437, 118595, 118693, 118851, 118947, 119046, 119236, 119363,
+	119459, 119555, 119652, 119780, 119908, 120036, 120164, 120292,
+	120420, 120550, 120738, 120806, 120998, 121189, 121348, 121478,
+	121670, 121860, 121987, 122083, 122180, 122308, 122437, 122597,
+	122755, 122851, 122948, 123075, 123171, 123266, 123330, 123395,
+	123491, 123590, 123780, 123909, 124070, 124260, 124387, 124483,
+	124582, 124772, 124902, 125091, 125189, 125347, 125444, 125571,
+	125668, 125797, 125956, 126085, 126244, 126370, 126437, 126595,
+	126691, 126788, 126915, 127011, 127107, 127205, 127364, 127490,
+	127558, 127747, 127845, 128004, 128132, 128259, 128355, 128452,
+	128578, 128644, 128773, 128930, 128998, 129187, 129282, 129346,
+	129410, 129474, 129538, 129602, 129666, 129730, 129794, 129858,
+	129923, 130019, 130115, 130211, 130307, 130403, 130499, 130595,
+	130691, 130787, 130883, 130979, 131075, 131171, 131267, 131363,
+	131458, 131522, 131587, 131682, 131746, 131810, 131875, 131971,
+	132066, 132130, 132194, 132258, 132322, 132388, 132514, 132578,
+	132642, 132706, 132770, 132834, 132898, 132962, 133027, 133124,
+	133250, 133314, 133378, 133442, 133506, 133570, 133634, 133699,
+	133795, 133891, 133987, 134082, 134146, 134210, 134274, 134338,
+	134402, 134466, 134530, 134594, 134658, 134723, 134819, 134914,
+	134979, 135075, 135171, 135266, 135331, 135427, 135524, 135650,
+	135715, 135811, 135907, 136003, 136101, 136262, 136450, 136514,
+	136578, 136642, 136706, 136770, 136834, 136898, 136962, 137026,
+	137090, 137154, 137218, 137282, 137346, 137410, 137474, 137538,
+	137604, 137730, 137794, 137858, 137924, 138051, 138146, 138210,
+	138274, 138338, 138402, 138466, 138530, 138594, 138658, 138722,
+	138787, 138882, 138946, 139011, 139107, 139202, 139268, 139395,
+	139490, 139554, 139618, 139682, 139747, 139843, 139938, 140002,
+	140066, 140130, 140194, 140258, 140322, 140386, 140450, 140515,
+	140611, 140707, 140803, 140899, 140995, 141091, 141187, 141283,
+	141379, 141475, 141571, 141667, 141763, 141859, 141955, 142051,
+	142147, 142243, 142339, 142435, 142531, 142627, 142721, 142753,
+	142785, 142817, 142849, 142881, 142913, 142945, 142977, 143009,
+	143041, 143073, 94689, 143105, 143137, 143169, 143201, 96417, 143233,
+	94945, 143265, 143297, 143329, 143361, 143393, 143425, 143457, 143489,
+	143521, 143553, 143585, 143617, 143649, 143681, 143713, 143745,
+	143777, 143809, 143841, 143873, 143905, 143937, 143969, 144001,
+	144033, 144065, 144097, 144129, 144161, 144193, 144225, 144257,
+	144289, 144321, 144353, 144385, 144417, 144449, 144481, 144513,
+	144545, 93601, 144577, 144609, 144641, 144673, 144705, 144737, 144769,
+	144801, 144833, 144865, 144897, 95937, 144929, 144961, 144993, 145025,
+	145057, 145089, 145121, 145153, 145185, 145217, 145249, 145281,
+	145313, 145345, 145377, 145409, 145441, 145473, 145505, 145537,
+	145569, 145601, 145633, 145665, 145697, 145729, 145761, 145793,
+	145825, 145857, 145889, 145921, 145953, 145985, 146017, 146049,
+	146081, 146113, 146145, 146177, 146209, 146241, 146273, 146305,
+	146337, 146369, 146401, 94753, 146433, 146465, 146497, 146529, 146561,
+	146593, 146625, 146657, 146689, 146721, 146753, 146785, 146817,
+	146849, 146881, 90817, 146913, 146945, 146977, 147009, 147041, 147073,
+	147105, 147137, 90209, 147169, 147201, 147233, 147265, 147297, 147329,
+	147361, 147393, 147425, 147457, 147489, 147521, 147553, 147585,
+	147617, 147649, 147681, 147713, 147745, 147777, 147809, 147841,
+	147873, 147905, 147937, 147969, 148001, 148033, 148065, 148097,
+	148129, 148161, 148193, 148225, 148257, 148289, 148321, 148353,
+	148385, 148417, 148449, 148481, 148513, 148545, 148577, 148609,
+	148641, 148673, 148705, 148737, 148769, 148801, 148833, 148865, 96385,
+	148897, 148929, 148961, 148993, 149025, 149057, 149089, 149121,
+	149153, 149185, 149217, 149249, 113441, 149281, 149313, 149345,
+	149377, 149409, 149441, 149473, 149505, 149537, 149569, 149601,
+	149633, 149665, 149697, 149729, 149761, 149793, 149825, 149857,
+	149889, 149921, 149953, 94913, 149985, 150017, 150049, 150081, 150113,
+	150145, 150177, 150209, 150241, 150273, 150305, 150337, 150369, 93345,
+	150401, 150433, 150465, 150497, 150529, 150561, 150593, 150625,
+	150657, 150689, 150721, 150753, 150785, 150817, 150849, 150881, 94209,
+	150913, 94305, 150945, 150977, 151009, 151041, 151073, 151105, 151137,
+	151169, 151201, 151233, 151265, 151297, 151329, 151361, 93569, 151393,
+	151425, 151457, 151489, 151521, 151553, 151585, 151617, 151649,
+	151681, 151713, 151745, 151777, 151809, 151841, 151873, 151905,
+	151937, 151969, 152001, 152033, 152065, 91041, 152097, 152129, 152161,
+	152193, 152225, 152257, 152289, 152321, 152353, 152385, 152417,
+	152449, 152481, 152513, 152545, 113601, 152577, 152609, 152641,
+	152673, 113729, 152705, 152737, 152769, 152801, 152833, 152865,
+	152897, 152929, 152961, 152993, 153025, 153057, 153089, 153121,
+	153153, 153185, 153217, 153249, 153281, 153313, 153345, 153377,
+	153409, 153441, 153473, 153505, 153537, 153569, 153601, 153633,
+	153665, 153697, 153729, 153761, 153793, 153825, 153857, 153889,
+	153921, 153953, 153985, 154017, 154049, 154081, 154113, 154145,
+	154177, 154209, 154241, 154273, 154305, 154337, 154369, 154401,
+	154433, 154465, 92097, 154497, 154529, 154561, 154593, 154625, 154657,
+	154689, 154721, 154753, 154785, 154817, 154849, 154881, 154913,
+	154945, 154977, 155009, 155041, 155073, 155105, 155137, 155169,
+	155201, 155233, 155265, 155297, 155329, 155361, 155393, 155425,
+	155457, 155489, 155521, 155553, 155585, 155617, 155649, 155681,
+	155713, 155745, 155777, 155809, 155841, 155873, 155905, 155937,
+	155969, 156001, 156034, 156098, 156162, 156227, 156323, 156418,
+	156482, 156546, 156610, 156674, 156738, 156802, 156866, 156929,
+	156961, 156993, 157025, 157057, 157089, 157121, 157154, 157218,
+	157283, 157379, 157474, 157538, 157602, 157666, 157730, 157794,
+	157858, 157922, 157986, 158050, 158114, 158178, 158242, 158306,
+	158370, 158434, 158498, 158562, 158626, 158690, 158754, 158818,
+	158882, 158946, 159010, 159074, 159138, 159202, 159266, 159329,
+	159361, 159393, 159425, 159457, 159489, 159521, 159553, 159585,
+	159617, 159649, 159681, 159713, 159745, 159777, 159809, 159841,
+	159873, 159905, 159937, 159969, 160001, 160033, 160065, 160097, 25890,
+	160129, 160161, 160193, 26018, 160225, 160257, 160289, 160321, 160353,
+	160385, 160417, 160449, 160481, 160515, 160611, 160707, 160803,
+	160899, 160995, 161091, 161187, 161281, 161315, 161411, 161507,
+	161603, 161698, 161762, 161826, 161890, 161954, 162018, 162082,
+	162146, 162210, 162274, 162338, 162402, 162466, 162530, 162594,
+	162658, 162722, 162786, 162850, 162914, 162978, 163042, 163106,
+	163170, 163234, 163298, 163362, 163426, 163490, 163554, 163618,
+	163682, 163746, 163810, 163874, 163938, 164002, 164066, 164130,
+	164194, 164258, 164322, 164386, 164450, 164514, 164578, 164642,
+	164706, 164770, 164834, 164898, 164962, 165026, 165090, 165154,
+	165218, 165282, 165346, 165410, 165474, 165538, 165602, 165666,
+	165730, 165794, 165858, 165922, 165986, 166050, 166114, 166178,
+	166242, 166306, 166370, 166434, 166498, 166562, 166626, 166690,
+	166754, 166818, 166882, 166946, 167010, 167074, 167138, 167202,
+	167266, 167330, 167395, 167491, 167587, 167683, 167779, 167875,
+	167971, 168067, 168163, 168258, 168322, 168386, 168450, 168514,
+	168578, 168642, 168706, 168770, 168834, 168898, 168962, 169026,
+	169090, 169154, 169218, 169283, 169379, 169474, 169538, 169602,
+	169666, 169730, 169794, 169858, 169922, 169986, 170050, 170114,
+	170179, 170275, 170371, 170466, 170530, 170594, 170658, 170722,
+	170786, 170850, 170914, 170978, 171042, 171106, 171170, 171234,
+	171298, 171362, 171426, 171490, 171554, 171618, 171682, 171746,
+	171810, 171874, 171938, 172002, 172066, 172130, 172194, 172259,
+	172355, 172451, 172547, 172643, 172739, 172835, 172931, 173027,
+	173123, 173219, 173315, 173411, 173507, 173603, 173699, 173795,
+	173891, 173987, 174083, 174179, 174275, 174371, 174467, 174563,
+	174659, 174755, 174851, 174947, 175043, 175139, 175235, 175331,
+	175427, 175523, 175619, 175715, 175811, 175907, 176003, 176099,
+	176195, 176291, 176387, 176483, 176579, 176675, 176771, 176867,
+	176963, 177059, 177155, 177251, 177347, 177443, 177539, 177635,
+	177731, 177827, 177923, 178019, 178115, 178211, 178307, 178403,
+	178499, 178595, 178691, 178787, 178883, 178979, 179075, 179171,
+	179267, 179363, 179459, 179555, 179651, 179747, 179843, 179939,
+	180035, 180131, 180227, 180323, 180419, 180515, 180611, 180707,
+	180803, 180899, 180995, 181091, 181187, 181283, 181379, 181476,
+	181604, 181732, 181860, 181988, 182116, 182244, 182371, 182482,
+	183048, 183300, 183425, 183457, 183489, 183521, 19873, 183553, 183585,
+	183617, 183649, 183681, 183713, 183745, 183777, 183809, 183841,
+	183873, 183905, 183937, 183969, 184001, 81825, 81857, 184033, 184065,
+	184097, 184129, 184161, 184193, 184225, 184257, 184289, 184321,
+	184353, 184385, 184417, 184449, 184481, 184513, 184546, 184610,
+	184674, 184738, 184802, 184866, 184930, 184994, 185058, 185122,
+	185186, 185250, 185314, 185378, 185441, 25314, 25378, 25442, 25506,
+	25570, 185473, 185505, 185537, 185569, 185601, 185633, 185665, 185697,
+	185729, 185761, 185793, 185825, 185857, 185889, 185921, 185953,
+	185985, 186017, 186049, 186081, 186113, 186145, 186177, 186209,
+	186241, 186273, 186305, 186337, 186369, 186403, 186499, 186595,
+	186690, 186753, 186785, 186817, 186849, 71841, 186881, 186913, 186945,
+	186977, 187009, 187041, 187073, 187105, 187137, 187169, 187201,
+	187233, 187265, 187297, 187329, 187361, 187393, 187425, 187457,
+	187489, 187521, 187553, 187585, 187617, 187649, 187681, 187713,
+	187745, 187777, 187809, 187841, 187873, 187905, 187937, 187969,
+	188001, 188033, 188065, 188097, 188129, 188161, 188193, 188225,
+	188257, 188289, 188321, 188353, 188385, 188417, 188449, 188481,
+	188513, 188545, 188577, 188609, 188641, 188673, 188705, 188737,
+	188769, 188801, 188833, 188865, 188897, 188929, 188961, 188993,
+	189025, 189057, 189089, 189121, 189153, 189185, 189217, 189249,
+	189281, 189313, 189345, 189377, 189409, 189441, 189473, 189505,
+	189537, 189569, 189602, 189666, 189730, 189794, 189858, 189922,
+	189986, 190050, 190114, 190178, 190242, 190306, 190370, 190434,
+	190498, 190563, 190659, 190755, 190851, 190947, 191042, 191106,
+	191171, 191267, 191363, 191459, 191553, 191585, 191617, 191649,
+	191681, 191713, 191745, 191777, 191809, 191841, 191873, 191905,
+	191937, 191969, 192001, 192033, 192065, 192097, 192129, 192161, 75137,
+	192193, 192225, 192257, 192289, 68513, 192321, 192353, 192385, 192417,
+	192449, 192481, 192513, 192545, 192577, 192609, 192641, 192673,
+	192705, 192737, 192769, 192802, 192866, 192930, 192994, 193058,
+	193122, 193186, 193250, 193314, 193378, 193442, 193507, 193603,
+	193699, 193795, 193891, 193987, 194083, 194179, 194275, 194371,
+	194467, 194563, 194659, 194755, 194851, 194947, 195043, 195139,
+	195235, 195331, 195427, 195523, 195619, 195715, 195811, 195907,
+	196003, 196098, 196162, 196226, 196290, 196354, 196419, 196514,
+	196578, 196642, 196706, 196770, 196834, 196898, 196961, 196993, 99330,
+	197025, 197057, 197089, 197121, 197153, 148737, 197185, 197217,
+	197249, 197281, 197313, 197345, 197377, 197409, 197441, 197473,
+	197505, 197537, 197569, 197601, 197633, 197665, 197697, 197729,
+	197761, 197793, 197825, 197857, 197889, 197923, 198019, 198115,
+	198211, 198307, 198403, 198499, 198595, 198691, 198785, 198817,
+	198849, 198881, 198913, 198945, 198977, 199009, 199041, 199073,
+	199105, 199137, 199169, 199201, 199233, 199265, 199297, 199329,
+	199361, 199393, 197249, 199425, 199457, 199489, 199521, 199553,
+	199585, 90145, 199617, 199649, 199681, 199713, 197825, 199745, 199777,
+	199809, 199841, 199873, 199905, 199937, 199969, 200001, 200033,
+	200065, 200097, 200129, 200161, 200193, 200225, 200257, 200289,
+	200321, 200353, 200385, 200417, 200449, 200481, 200513, 200545,
+	200577, 200609, 200641, 200673, 200705, 200737, 200769, 200801,
+	200833, 200865, 200897, 200929, 200961, 200993, 201025, 201057,
+	201089, 201121, 201153, 201185, 197025, 201217, 201249, 201281,
+	201313, 201345, 201377, 201409, 201441, 201473, 201505, 201537,
+	201569, 201601, 201633, 201665, 201697, 201729, 201761, 201793,
+	201825, 201857, 90977, 201889, 201921, 201953, 201985, 202017, 202049,
+	202081, 202113, 202145, 202177, 202209, 202241, 202273, 202305,
+	202337, 202369, 202401, 202433, 202465, 202497, 202529, 202561,
+	202593, 202625, 91361, 202657, 202689, 202721, 202753, 202785, 202817,
+	202849, 202881, 202913, 202945, 202977, 203009, 203041, 203073,
+	203105, 203137, 203169, 203201, 203233, 203265, 203297, 203329,
+	203361, 203393, 203425, 203457, 203489, 203521, 203553, 203585,
+	203617, 203649, 203681, 203713, 203745, 203777, 203809, 203841,
+	203873, 203905, 203937, 203969, 204001, 204033, 204065, 204097,
+	204129, 204161, 204193, 204225, 204257, 204289, 204321, 204353,
+	204385, 204417, 204449, 204481, 204513, 204545, 204577, 204609,
+	204641, 204673, 204705, 204737, 204769, 204801, 204833, 204865,
+	204897, 204929, 204961, 204993, 205025, 205057, 205089, 205121,
+	205153, 205185, 205217, 205249, 205281, 205313, 205345, 205377,
+	205409, 205441, 205473, 205505, 205537, 205569, 205601, 205633,
+	205665, 205697, 205729, 205761, 205793, 205825, 205857, 205889,
+	205921, 205953, 205985, 206017, 206049, 206081, 206113, 206145,
+	206177, 206209, 206241, 206273, 206305, 206337, 206369, 206401,
+	206433, 206465, 206497, 206529, 206561, 206593, 206625, 206657,
+	206689, 206721, 206753, 206785, 206817, 206849, 206881, 206913,
+	206945, 206977, 207009, 207041, 207073, 207105, 207137, 207169,
+	207201, 207233, 207265, 207297, 207329, 207361, 207393, 207425,
+	207457, 207489, 207521, 207553, 207585, 207617, 207649, 207681,
+	207713, 207745, 207777, 207809, 207841, 207873, 207905, 207937,
+	207969, 208001, 208033, 208065, 208097, 208129, 208161, 208193,
+	208225, 208257, 208289, 208321, 208353, 208385, 208417, 208449,
+	208481, 208513, 208545, 208577, 208609, 208641, 208673, 208705,
+	208737, 208769, 208801, 208833, 208865, 208897, 208929, 208961,
+	208993, 209025, 209057, 209089, 209121, 209153, 209185, 209217,
+	209249, 209281, 209313, 209345, 209377, 209409, 209441, 209473,
+	209505, 209537, 209569, 209601, 209633, 209665, 209697, 209729,
+	209761, 209793, 209825, 209857, 209889, 209921, 209953, 209985,
+	210017, 210049, 210081, 210113, 210145, 210177, 210209, 210241,
+	210273, 210305, 210337, 210369, 210401, 210433, 210465, 210497,
+	210529, 210561, 210593, 210625, 210657, 210689, 210721, 210753,
+	210785, 210817, 210849, 210881, 210913, 210945, 210977, 211009,
+	211041, 211073, 211105, 211137, 211169, 211201, 94241, 211233, 211265,
+	211297, 211329, 211361, 211393, 211425, 211457, 211489, 211521,
+	211553, 94465, 211585, 211617, 211649, 211681, 211713, 211745, 211777,
+	211809, 211841, 211873, 211905, 211937, 211969, 212001, 212033,
+	212065, 212097, 212129, 212161, 212193, 212225, 212257, 212289,
+	212321, 212353, 212385, 212417, 212449, 212481, 212513, 212545,
+	212577, 212609, 212641, 212673, 212705, 212737, 212769, 212801,
+	212833, 212865, 212897, 212929, 212961, 212993, 213025, 213057,
+	213089, 213121, 213153, 213185, 213217, 213249, 213281, 213313,
+	213345, 213377, 213409, 213441, 213473, 213505, 213537, 96001, 213569,
+	96129, 213601, 213633, 213665, 213697, 96289, 213729
+};
+
+/* normdecomp: 19392 bytes */
+static const uint8_t normdecomp_idx1[1088] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 14, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 15, 16, 5, 17, 5,
+	5, 18, 19, 20, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 21, 22, 5, 5, 5, 5, 5, 23, 24, 5, 25, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 26, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5
+};
+
+static const uint16_t normdecomp_idx2[1728] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+	13, 14, 0, 0, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 0, 0, 0, 0, 0,
+	0, 0, 25, 0, 26, 27, 0, 0, 0, 0, 0, 28, 0, 0, 29, 30, 31, 32, 33, 34,
+	35, 0, 36, 37, 38, 0, 39, 0, 40, 0, 41, 0, 0, 0, 0, 42, 43, 44, 45, 0,
+	0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0,
+	48, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52,
+	0, 53, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0, 56, 0, 57, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 59, 0, 0, 0, 60, 0, 0, 61, 0, 0, 0,
+	0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 64, 0,
+	0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 67,
+	0, 68, 0, 0, 69, 0, 0, 0, 70, 71, 72, 73, 74, 75, 76, 77, 0, 0, 0, 0,
+	0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 81, 0, 82, 83, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 84, 85, 86, 87, 88, 89, 0, 90, 91, 92, 0, 0, 0, 0, 93, 94,
+	95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+	110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
+	124, 125, 126, 127, 128, 129, 130, 0, 131, 132, 133, 134, 0, 0, 0, 0,
+	0, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 0, 146, 0,
+	0, 0, 147, 0, 148, 149, 150, 0, 151, 152, 153, 0, 154, 0, 0, 0, 155,
+	0, 0, 0, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	157, 158, 159, 160, 161, 162, 163, 164, 165, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 166, 0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 0, 0, 168, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 0, 0, 0, 0, 0, 172, 173, 174, 175,
+	176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 0, 0, 187, 0,
+	0, 188, 189, 190, 191, 192, 0, 193, 194, 195, 196, 197, 0, 198, 0, 0,
+	0, 199, 200, 201, 202, 203, 204, 205, 0, 0, 0, 0, 0, 0, 206, 207, 208,
+	209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+	223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236,
+	237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 0, 0, 240, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 241, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 243, 244, 245, 246, 247, 248, 249, 250,
+	251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264,
+	265, 266, 267, 268, 269, 270, 271, 272, 0, 0, 273, 274, 275, 276, 277,
+	278, 279, 280, 281, 282, 283, 284, 0, 285, 286, 287, 288, 289, 290,
+	291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304,
+	305, 306, 307, 0, 308, 309, 310, 311, 312, 313, 314, 315, 0, 0, 316,
+	0, 317, 0, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329,
+	330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
+	344, 345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 346, 347, 348, 349, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 350, 351, 0, 0, 0, 0, 0, 0, 0, 352, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 355, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 357, 358, 0, 0, 0, 0, 359, 360, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 361, 362, 363, 364, 365, 366, 367, 368, 369,
+	370, 371, 372, 373, 361, 362, 363, 374, 375, 376, 377, 378, 379, 380,
+	381, 382, 383, 361, 362, 363, 364, 365, 376, 367, 368, 369, 380, 381,
+	382, 383, 361, 362, 363, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+	393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+	416, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 417, 418, 419, 361,
+	420, 0, 421, 0, 0, 422, 0, 0, 0, 0, 0, 0, 423, 424, 425, 426, 427,
+	428, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 429,
+	430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+	444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457,
+	458, 459, 460, 461, 462, 463, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const uint16_t normdecomp_blk[7424] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 2, 0, 3, 0, 0, 0, 0, 4, 0, 0, 5, 6, 7, 8, 0, 0, 9, 10, 11, 0, 12,
+	13, 14, 0, 15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 26, 27, 28,
+	29, 0, 30, 31, 32, 33, 34, 35, 0, 0, 36, 37, 38, 39, 40, 0, 0, 41, 42,
+	43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55, 0, 56, 57, 58,
+	59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 0, 67, 68, 69, 70, 71, 72, 73,
+	74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 0, 0, 84, 85, 86, 87, 88, 89,
+	90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 0, 0, 104,
+	105, 106, 107, 108, 109, 110, 111, 112, 0, 113, 114, 115, 116, 117,
+	118, 0, 119, 120, 121, 122, 123, 124, 125, 126, 0, 0, 127, 128, 129,
+	130, 131, 132, 133, 0, 0, 134, 135, 136, 137, 138, 139, 0, 0, 140,
+	141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+	155, 156, 157, 0, 0, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+	168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+	182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 185, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 187, 188, 189, 190,
+	191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
+	205, 206, 207, 208, 209, 210, 0, 211, 212, 213, 214, 215, 216, 0, 0,
+	217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230,
+	231, 232, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243,
+	244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257,
+	258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270,
+	0, 0, 0, 0, 0, 0, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+	281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 285, 286, 287,
+	288, 289, 290, 291, 292, 293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 294, 295, 296, 297, 298, 299, 0, 0, 300, 301, 181, 302, 303, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 305, 0, 306, 307, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 308, 0, 0, 0, 0, 0, 309, 0, 0, 0, 310, 0,
+	0, 0, 0, 0, 7, 311, 312, 313, 314, 315, 316, 0, 317, 0, 318, 319, 320,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 321, 322, 323, 324, 325, 326, 327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 329, 330, 331, 332,
+	0, 333, 334, 335, 336, 337, 338, 339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 340,
+	341, 342, 0, 343, 344, 0, 0, 0, 345, 0, 0, 0, 0, 0, 0, 346, 347, 0,
+	348, 0, 0, 0, 349, 0, 0, 0, 0, 350, 351, 352, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0, 0,
+	0, 0, 0, 355, 356, 0, 357, 0, 0, 0, 358, 0, 0, 0, 0, 359, 360, 361, 0,
+	0, 0, 0, 0, 0, 0, 362, 363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 364, 365, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 366, 367, 368, 369, 0, 0, 370, 371,
+	0, 0, 372, 373, 374, 375, 376, 377, 0, 0, 378, 379, 380, 381, 382,
+	383, 0, 0, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395,
+	0, 0, 396, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 399, 400, 401, 402, 403, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 404, 405, 406, 407, 0, 0, 0, 0, 0, 0, 0, 408, 0,
+	409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 410, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 411, 0, 0, 0, 0, 0,
+	0, 0, 412, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 414, 415, 416, 417, 418, 419, 420, 421, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 422, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	424, 425, 0, 426, 0, 0, 0, 427, 0, 0, 428, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 429, 430, 431, 0, 0, 432, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 433, 0, 0, 434, 435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 436, 437, 0, 0, 0, 0, 0, 0, 438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 439, 440, 441, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 442, 0, 0, 0, 0, 0, 0, 0, 443, 0, 0, 0, 0, 0, 0, 444, 445,
+	0, 446, 447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 448, 449, 450,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 452, 453, 454, 0, 0, 0,
+	0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 457, 458,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 0, 0, 0, 0, 0, 0, 460,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 461, 0, 0, 0, 0, 462, 0, 0, 0, 0, 463, 0,
+	0, 0, 0, 464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 466, 0, 467, 468, 469, 470, 471, 0, 0, 0, 0, 0, 0, 0, 472,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 473, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 474, 0, 0, 0, 0, 475, 0, 0, 0, 0, 476, 0, 0, 0, 0, 477, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	480, 0, 0, 0, 0, 0, 0, 0, 0, 0, 481, 0, 482, 0, 483, 0, 484, 0, 485,
+	0, 0, 0, 486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 487, 0, 488, 0, 0, 489, 490, 0, 491, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 492, 493, 494,
+	0, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 0, 506, 507,
+	508, 509, 510, 511, 512, 3, 513, 514, 515, 516, 517, 518, 519, 520,
+	521, 522, 0, 523, 524, 525, 11, 526, 527, 528, 529, 530, 531, 532,
+	533, 534, 535, 333, 536, 537, 338, 538, 539, 288, 531, 534, 333, 536,
+	341, 338, 538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 540, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541, 542, 543, 544, 521,
+	545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558,
+	559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572,
+	573, 574, 575, 334, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585,
+	586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599,
+	600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613,
+	614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627,
+	628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+	642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+	656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669,
+	670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683,
+	684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697,
+	698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+	712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725,
+	726, 727, 728, 729, 730, 731, 0, 0, 0, 0, 732, 733, 734, 735, 736,
+	737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750,
+	751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764,
+	765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778,
+	779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792,
+	793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806,
+	807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820,
+	821, 0, 0, 0, 0, 0, 0, 822, 823, 824, 825, 826, 827, 828, 829, 830,
+	831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 0, 0,
+	844, 845, 846, 847, 848, 849, 0, 0, 850, 851, 852, 853, 854, 855, 856,
+	857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870,
+	871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884,
+	885, 886, 887, 0, 0, 888, 889, 890, 891, 892, 893, 0, 0, 894, 895,
+	896, 897, 898, 899, 900, 901, 0, 902, 0, 903, 0, 904, 0, 905, 906,
+	907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920,
+	921, 922, 323, 923, 324, 924, 325, 925, 326, 926, 330, 927, 331, 928,
+	332, 0, 0, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940,
+	941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954,
+	955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968,
+	969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 0,
+	982, 983, 984, 985, 986, 312, 987, 988, 989, 988, 990, 991, 992, 993,
+	994, 0, 995, 996, 997, 314, 998, 315, 999, 1000, 1001, 1002, 1003,
+	1004, 1005, 320, 0, 0, 1006, 1007, 1008, 1009, 1010, 316, 0, 1011,
+	1012, 1013, 1014, 1015, 1016, 327, 1017, 1018, 1019, 1020, 1021, 1022,
+	1023, 318, 1024, 1025, 311, 1026, 0, 0, 1027, 1028, 1029, 0, 1030,
+	1031, 1032, 317, 1033, 319, 1034, 1035, 1036, 0, 1037, 1038, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1039, 0, 0, 0, 0, 0, 1040, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1041, 1042, 1043, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 0, 0, 1044, 1045, 0, 1046, 1047, 0, 0, 0, 0, 1048, 0, 1049,
+	0, 0, 0, 0, 0, 0, 0, 0, 1050, 1051, 1052, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1053, 0, 0, 0, 0, 0, 0, 0, 1, 1054, 539, 0, 0, 1055, 1056,
+	1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1054, 10,
+	5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+	1065, 0, 3, 518, 11, 302, 519, 285, 523, 301, 524, 1066, 529, 181,
+	530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1067, 0, 0, 0, 0, 0, 0, 0, 1068,
+	1069, 1070, 1071, 0, 1072, 1073, 1074, 0, 1075, 522, 499, 499, 499,
+	285, 1076, 500, 500, 503, 301, 0, 505, 1077, 0, 0, 508, 1078, 509,
+	509, 509, 0, 0, 1079, 1080, 1081, 0, 1082, 0, 1083, 0, 1082, 0, 1084,
+	20, 494, 1070, 0, 518, 496, 1085, 0, 504, 11, 1086, 1087, 1088, 1089,
+	539, 0, 1090, 339, 536, 1091, 1092, 1093, 0, 0, 0, 0, 495, 517, 518,
+	539, 287, 0, 0, 0, 0, 0, 0, 1094, 1095, 1096, 1097, 1098, 1099, 1100,
+	1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 500, 1110, 1111,
+	1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 503, 1070, 495,
+	504, 539, 1121, 1122, 1123, 534, 1124, 1125, 1126, 1127, 302, 1128,
+	1129, 301, 542, 517, 524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1130, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1131, 1132, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1134, 1135, 1136, 0, 0, 0, 0, 1137, 0, 0, 0, 0, 1138, 0,
+	0, 1139, 0, 0, 0, 0, 0, 0, 0, 1140, 0, 1141, 0, 0, 0, 0, 0, 1142,
+	1143, 0, 1144, 1145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1146, 0, 0, 1147, 0, 0, 1148, 0, 1149, 0, 0, 0, 0, 0, 0, 1150, 0,
+	1151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1152, 1153, 1154, 1155, 1156, 0,
+	0, 1157, 1158, 0, 0, 1159, 1160, 0, 0, 0, 0, 0, 0, 1161, 1162, 0, 0,
+	1163, 1164, 0, 0, 1165, 1166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 0, 0,
+	0, 0, 0, 0, 1175, 1176, 1177, 1178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1179, 1180, 0, 0, 0, 0, 0, 10, 5, 6, 1055, 1056, 1057, 1058, 1059,
+	1060, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190,
+	1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
+	1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
+	1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+	1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+	1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
+	1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256,
+	1257, 492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503,
+	504, 505, 506, 508, 1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259,
+	1082, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524,
+	1066, 11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572,
+	1054, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1261, 0, 0,
+	0, 0, 0, 0, 0, 1262, 1263, 1264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 287, 1113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1267, 0, 0, 0,
+	1268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1269, 1270, 1271, 1272,
+	1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+	1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+	1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,
+	1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
+	1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+	1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
+	1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+	1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+	1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
+	1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382,
+	1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+	1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404,
+	1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415,
+	1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
+	1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
+	1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
+	1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459,
+	1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470,
+	1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481,
+	1482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1483, 0, 1292, 1484, 1485, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1486, 0, 1487, 0, 1488, 0,
+	1489, 0, 1490, 0, 1491, 0, 1492, 0, 1493, 0, 1494, 0, 1495, 0, 1496,
+	0, 1497, 0, 0, 1498, 0, 1499, 0, 1500, 0, 0, 0, 0, 0, 0, 1501, 1502,
+	0, 1503, 1504, 0, 1505, 1506, 0, 1507, 1508, 0, 1509, 1510, 0, 0, 0,
+	0, 0, 0, 1511, 0, 0, 0, 0, 0, 0, 1512, 1513, 0, 1514, 1515, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1516, 0, 1517, 0, 1518, 0, 1519, 0, 1520,
+	0, 1521, 0, 1522, 0, 1523, 0, 1524, 0, 1525, 0, 1526, 0, 1527, 0, 0,
+	1528, 0, 1529, 0, 1530, 0, 0, 0, 0, 0, 0, 1531, 1532, 0, 1533, 1534,
+	0, 1535, 1536, 0, 1537, 1538, 0, 1539, 1540, 0, 0, 0, 0, 0, 0, 1541,
+	0, 0, 1542, 1543, 1544, 1545, 0, 0, 0, 1546, 1547, 0, 1548, 1549,
+	1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560,
+	1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571,
+	1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582,
+	1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593,
+	1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+	1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+	1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626,
+	1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637,
+	1638, 1639, 1640, 1641, 0, 0, 0, 1269, 1275, 1642, 1643, 1644, 1645,
+	1646, 1647, 1273, 1648, 1649, 1650, 1651, 1277, 1652, 1653, 1654,
+	1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665,
+	1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676,
+	1677, 1678, 1679, 1680, 1681, 1682, 0, 1683, 1684, 1685, 1686, 1687,
+	1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698,
+	1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709,
+	1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720,
+	1335, 1721, 0, 0, 0, 0, 0, 0, 0, 0, 1722, 1723, 1724, 1725, 1726,
+	1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+	1548, 1551, 1554, 1556, 1564, 1565, 1568, 1570, 1571, 1573, 1574,
+	1575, 1576, 1577, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+	1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 0, 1269, 1275,
+	1642, 1643, 1755, 1756, 1757, 1280, 1758, 1292, 1342, 1354, 1353,
+	1343, 1435, 1300, 1340, 1759, 1760, 1761, 1762, 1763, 1764, 1765,
+	1766, 1767, 1768, 1306, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+	1776, 1644, 1645, 1646, 1777, 1778, 1779, 1780, 1781, 1782, 1783,
+	1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
+	1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805,
+	1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816,
+	1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827,
+	1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838,
+	1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849,
+	1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860,
+	1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
+	1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882,
+	1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
+	1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904,
+	1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915,
+	1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926,
+	1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937,
+	1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948,
+	1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
+	1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970,
+	1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981,
+	1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992,
+	1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003,
+	2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014,
+	2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
+	2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036,
+	2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
+	2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058,
+	2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069,
+	2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+	2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091,
+	2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102,
+	2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113,
+	2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2122, 2123, 0, 0, 2124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1070, 1085, 1078, 0, 0, 0, 2125, 2126, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2127, 2128, 2129, 2130,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2131, 0, 0, 0, 0, 0, 0, 2132, 2133, 2134,
+	2135, 2136, 2137, 2138, 2139, 2139, 2140, 2141, 2142, 2143, 2144,
+	2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155,
+	2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166,
+	2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177,
+	2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188,
+	2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199,
+	2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210,
+	2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221,
+	2222, 2151, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231,
+	2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242,
+	2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253,
+	2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264,
+	2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275,
+	2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286,
+	2287, 2288, 2289, 2290, 2241, 2291, 2292, 2293, 2294, 2295, 2296,
+	2297, 2298, 2225, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306,
+	2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317,
+	2318, 2151, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327,
+	2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338,
+	2339, 2340, 2341, 2342, 2343, 2344, 2345, 2227, 2346, 2347, 2348,
+	2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359,
+	2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370,
+	2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381,
+	2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392,
+	2393, 2394, 2395, 0, 0, 2396, 0, 2397, 0, 0, 2398, 2399, 2400, 2401,
+	2402, 2403, 2404, 2405, 2406, 2407, 0, 2408, 0, 2409, 0, 0, 2410,
+	2411, 0, 0, 0, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420,
+	2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431,
+	2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442,
+	2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453,
+	2454, 2455, 2456, 2280, 2457, 2458, 2459, 2460, 2461, 2462, 2462,
+	2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2410, 2471, 2472,
+	2473, 2474, 2475, 2476, 0, 0, 2477, 2478, 2479, 2480, 2481, 2482,
+	2483, 2484, 2424, 2485, 2486, 2487, 2396, 2488, 2489, 2490, 2491,
+	2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2433, 2500, 2434,
+	2501, 2502, 2503, 2504, 2505, 2397, 2172, 2506, 2507, 2508, 2242,
+	2329, 2509, 2510, 2441, 2511, 2442, 2512, 2513, 2514, 2399, 2515,
+	2516, 2517, 2518, 2519, 2400, 2520, 2521, 2522, 2523, 2524, 2525,
+	2456, 2526, 2527, 2280, 2528, 2460, 2529, 2530, 2531, 2532, 2533,
+	2465, 2534, 2409, 2535, 2466, 2223, 2536, 2467, 2537, 2469, 2538,
+	2539, 2540, 2541, 2542, 2471, 2405, 2543, 2472, 2544, 2473, 2545,
+	2139, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555,
+	2556, 0, 0, 0, 0, 0, 0, 2557, 2558, 2559, 2560, 2561, 2562, 2562, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2563, 2564, 2565, 2566, 2567, 0, 0,
+	0, 0, 0, 2568, 0, 2569, 2570, 1086, 1089, 2571, 2572, 2573, 2574,
+	2575, 2576, 1061, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584,
+	2585, 2586, 2587, 2588, 2589, 0, 2590, 2591, 2592, 2593, 2594, 0,
+	2595, 0, 2596, 2597, 0, 2598, 2599, 0, 2600, 2601, 2602, 2603, 2604,
+	2605, 2606, 2607, 2608, 2609, 2610, 2610, 2611, 2611, 2611, 2611,
+	2612, 2612, 2612, 2612, 2613, 2613, 2613, 2613, 2614, 2614, 2614,
+	2614, 2615, 2615, 2615, 2615, 2616, 2616, 2616, 2616, 2617, 2617,
+	2617, 2617, 2618, 2618, 2618, 2618, 2619, 2619, 2619, 2619, 2620,
+	2620, 2620, 2620, 2621, 2621, 2621, 2621, 2622, 2622, 2622, 2622,
+	2623, 2623, 2624, 2624, 2625, 2625, 2626, 2626, 2627, 2627, 2628,
+	2628, 2629, 2629, 2629, 2629, 2630, 2630, 2630, 2630, 2631, 2631,
+	2631, 2631, 2632, 2632, 2632, 2632, 2633, 2633, 2634, 2634, 2634,
+	2634, 2635, 2635, 2636, 2636, 2636, 2636, 2637, 2637, 2637, 2637,
+	2638, 2638, 2639, 2639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2640, 2640, 2640, 2640, 2641, 2641, 2642, 2642, 2643, 2643, 406,
+	2644, 2644, 2645, 2645, 2646, 2646, 2647, 2647, 2647, 2647, 2648,
+	2648, 2649, 2649, 2650, 2650, 2651, 2651, 2652, 2652, 2653, 2653,
+	2654, 2654, 2655, 2655, 2655, 2656, 2656, 2656, 2657, 2657, 2657,
+	2657, 2658, 2659, 2660, 2656, 2661, 2662, 2663, 2664, 2665, 2666,
+	2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677,
+	2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688,
+	2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699,
+	2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710,
+	2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+	2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732,
+	2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743,
+	2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754,
+	2755, 2756, 2757, 2758, 2660, 2759, 2656, 2661, 2760, 2761, 2665,
+	2762, 2666, 2667, 2763, 2764, 2671, 2765, 2672, 2673, 2766, 2767,
+	2675, 2768, 2676, 2677, 2706, 2707, 2710, 2711, 2712, 2716, 2717,
+	2718, 2719, 2723, 2724, 2725, 2769, 2729, 2770, 2771, 2735, 2772,
+	2736, 2737, 2750, 2773, 2774, 2745, 2775, 2746, 2747, 2658, 2659,
+	2776, 2660, 2777, 2662, 2663, 2664, 2665, 2778, 2668, 2669, 2670,
+	2671, 2779, 2675, 2678, 2679, 2680, 2681, 2682, 2684, 2685, 2686,
+	2687, 2688, 2689, 2780, 2690, 2691, 2692, 2693, 2694, 2695, 2697,
+	2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2708, 2709, 2713,
+	2714, 2715, 2716, 2717, 2720, 2721, 2722, 2723, 2781, 2726, 2727,
+	2728, 2729, 2732, 2733, 2734, 2735, 2782, 2738, 2739, 2783, 2742,
+	2743, 2744, 2745, 2784, 2660, 2777, 2665, 2778, 2671, 2779, 2675,
+	2785, 2688, 2786, 2787, 2788, 2716, 2717, 2723, 2735, 2782, 2745,
+	2784, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798,
+	2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809,
+	2810, 2811, 2812, 2813, 2814, 2787, 2815, 2816, 2817, 2818, 2792,
+	2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803,
+	2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814,
+	2787, 2815, 2816, 2817, 2818, 2812, 2813, 2814, 2787, 2786, 2788,
+	2696, 2685, 2686, 2687, 2812, 2813, 2814, 2696, 2697, 2819, 2819, 0,
+	0, 2820, 2821, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2827, 2828,
+	2829, 2830, 2831, 2832, 2833, 2833, 2834, 2835, 2835, 2836, 2836,
+	2837, 2838, 2838, 2839, 2840, 2840, 2841, 2841, 2842, 2843, 2843,
+	2844, 2844, 2845, 2846, 2847, 2848, 2848, 2849, 2850, 2851, 2852,
+	2853, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2859, 2860, 2860,
+	2861, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 0, 0, 2869,
+	2870, 2871, 2872, 2873, 2874, 2874, 2875, 2876, 2877, 2878, 2878,
+	2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889,
+	2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900,
+	2854, 2856, 2901, 2902, 2903, 2904, 2905, 2906, 2905, 2903, 2907,
+	2908, 2909, 2910, 2911, 2906, 2847, 2837, 2912, 2913, 0, 0, 0, 0, 0,
+	0, 0, 0, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923,
+	2924, 2925, 2926, 0, 0, 0, 2927, 2928, 2929, 2930, 2931, 2932, 2933,
+	2934, 2935, 1043, 0, 0, 0, 0, 0, 0, 1042, 2936, 2937, 2938, 2938,
+	1064, 1065, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947,
+	2948, 2949, 2950, 2951, 2952, 0, 0, 2953, 2954, 1049, 1049, 1049,
+	1049, 2938, 2938, 2938, 2927, 2928, 1041, 0, 2931, 2930, 2933, 2932,
+	2936, 1064, 1065, 2939, 2940, 2941, 2942, 2955, 2956, 2957, 1061,
+	2958, 2959, 2960, 1063, 0, 2961, 2962, 2963, 2964, 0, 0, 0, 0, 2965,
+	2966, 2967, 0, 2968, 0, 2969, 2970, 2971, 2972, 2973, 2974, 2975,
+	2976, 2977, 2978, 2979, 2980, 2980, 2981, 2981, 2982, 2982, 2983,
+	2983, 2984, 2984, 2984, 2984, 2985, 2985, 2986, 2986, 2986, 2986,
+	2987, 2987, 2988, 2988, 2988, 2988, 2989, 2989, 2989, 2989, 2990,
+	2990, 2990, 2990, 2991, 2991, 2991, 2991, 2992, 2992, 2992, 2992,
+	2993, 2993, 2994, 2994, 2995, 2995, 2996, 2996, 2997, 2997, 2997,
+	2997, 2998, 2998, 2998, 2998, 2999, 2999, 2999, 2999, 3000, 3000,
+	3000, 3000, 3001, 3001, 3001, 3001, 3002, 3002, 3002, 3002, 3003,
+	3003, 3003, 3003, 3004, 3004, 3004, 3004, 3005, 3005, 3005, 3005,
+	3006, 3006, 3006, 3006, 3007, 3007, 3007, 3007, 3008, 3008, 3008,
+	3008, 3009, 3009, 3009, 3009, 3010, 3010, 3010, 3010, 3011, 3011,
+	3011, 3011, 3012, 3012, 2648, 2648, 3013, 3013, 3013, 3013, 3014,
+	3014, 3015, 3015, 3016, 3016, 3017, 3017, 0, 0, 0, 0, 2932, 3018,
+	2955, 2962, 2963, 2956, 3019, 1064, 1065, 2957, 1061, 2927, 2958,
+	1041, 3020, 1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 2930,
+	2931, 2959, 1063, 2960, 2933, 2964, 492, 494, 1070, 495, 496, 1085,
+	498, 499, 500, 501, 502, 503, 504, 505, 506, 508, 1078, 509, 1258,
+	510, 511, 1113, 512, 1118, 1259, 1082, 2953, 2961, 2954, 3021, 2938,
+	3022, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524,
+	1066, 11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572,
+	2939, 3023, 2940, 3024, 3025, 3026, 2929, 2949, 2950, 2928, 3027,
+	1864, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037,
+	1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828,
+	1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839,
+	1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850,
+	1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861,
+	3038, 3039, 3040, 1599, 1548, 1549, 1550, 1551, 1552, 1553, 1554,
+	1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565,
+	1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576,
+	1577, 0, 0, 0, 1578, 1579, 1580, 1581, 1582, 1583, 0, 0, 1584, 1585,
+	1586, 1587, 1588, 1589, 0, 0, 1590, 1591, 1592, 1593, 1594, 1595, 0,
+	0, 1596, 1597, 1598, 0, 0, 0, 3041, 3042, 3043, 4, 3044, 3045, 3046,
+	0, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 0, 0, 3054, 3055, 3056,
+	3057, 3058, 0, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067,
+	3068, 3069, 3070, 3071, 3072, 1076, 3073, 3074, 3075, 3076, 3077,
+	3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 1260,
+	3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 0,
+	3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3108, 0, 3109, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3111, 3112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3113, 3114, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3115, 3116, 0, 3117, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3118, 3119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3128, 3129, 3130, 3131,
+	3132, 3133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 492, 494,
+	1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+	508, 1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516,
+	542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066, 11, 529,
+	1260, 288, 181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 1070,
+	495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508,
+	1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516, 542,
+	517, 518, 545, 522, 0, 539, 287, 523, 301, 524, 1066, 11, 529, 1260,
+	288, 181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 1070, 495, 496,
+	1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508, 1078, 509,
+	1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518,
+	545, 522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288, 181,
+	530, 531, 534, 292, 302, 293, 572, 492, 0, 1070, 495, 0, 0, 498, 0, 0,
+	501, 502, 0, 0, 505, 506, 508, 1078, 0, 1258, 510, 511, 1113, 512,
+	1118, 1259, 1082, 3, 516, 542, 517, 0, 545, 0, 285, 539, 287, 523,
+	301, 524, 1066, 0, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293,
+	572, 292, 302, 293, 572, 492, 494, 0, 495, 496, 1085, 498, 0, 0, 501,
+	502, 503, 504, 505, 506, 508, 1078, 0, 1258, 510, 511, 1113, 512,
+	1118, 1259, 0, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523,
+	301, 524, 1066, 11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293,
+	572, 492, 494, 0, 495, 496, 1085, 498, 0, 500, 501, 502, 503, 504, 0,
+	506, 0, 0, 0, 1258, 510, 511, 1113, 512, 1118, 1259, 0, 3, 516, 542,
+	517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260,
+	288, 181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 1070, 495, 496,
+	1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508, 1078, 509,
+	1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518,
+	545, 522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288, 181,
+	530, 531, 534, 292, 302, 293, 572, 292, 302, 293, 572, 3134, 3135, 0,
+	0, 3136, 3137, 1091, 3138, 3139, 3140, 3141, 343, 3142, 3143, 3144,
+	3145, 3146, 3147, 3148, 1092, 3149, 343, 345, 3150, 335, 3151, 3152,
+	3153, 3154, 3155, 3156, 333, 536, 537, 344, 3157, 3158, 334, 3159,
+	340, 3160, 8, 3161, 3162, 3163, 339, 341, 342, 3164, 3165, 3166, 338,
+	538, 3167, 3168, 3169, 344, 334, 340, 338, 341, 339, 3136, 3137, 1091,
+	3138, 3139, 3140, 3141, 343, 3142, 3143, 3144, 3145, 3146, 3147, 3148,
+	1092, 3149, 343, 345, 3150, 335, 3151, 3152, 3153, 3154, 3155, 3156,
+	333, 536, 537, 344, 3157, 3158, 334, 3159, 340, 3160, 8, 3161, 3162,
+	3163, 339, 341, 342, 3164, 3165, 3166, 338, 538, 3167, 3168, 3169,
+	344, 334, 340, 338, 341, 339, 3136, 3137, 1091, 3138, 3139, 3140,
+	3141, 343, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 1092, 3149, 343,
+	345, 3150, 335, 3151, 3152, 3153, 3154, 3155, 3156, 333, 536, 537,
+	344, 3157, 3158, 334, 3159, 340, 3160, 8, 3161, 3162, 3163, 339, 341,
+	342, 3164, 3165, 3166, 338, 538, 3167, 3168, 3169, 344, 334, 340, 338,
+	341, 339, 3136, 3137, 1091, 3138, 3139, 3140, 3141, 343, 3142, 3143,
+	3144, 3145, 3146, 3147, 3148, 1092, 3149, 343, 345, 3150, 335, 3151,
+	3152, 3153, 3154, 3155, 3156, 333, 536, 537, 344, 3157, 3158, 334,
+	3159, 340, 3160, 8, 3161, 3162, 3163, 339, 341, 342, 3164, 3165, 3166,
+	338, 538, 3167, 3168, 3169, 344, 334, 340, 338, 341, 339, 3136, 3137,
+	1091, 3138, 3139, 3140, 3141, 343, 3142, 3143, 3144, 3145, 3146, 3147,
+	3148, 1092, 3149, 343, 345, 3150, 335, 3151, 3152, 3153, 3154, 3155,
+	3156, 333, 536, 537, 344, 3157, 3158, 334, 3159, 340, 3160, 8, 3161,
+	3162, 3163, 339, 341, 342, 3164, 3165, 3166, 338, 538, 3167, 3168,
+	3169, 344, 334, 340, 338, 341, 339, 3170, 3171, 0, 0, 1054, 10, 5, 6,
+	1055, 1056, 1057, 1058, 1059, 1060, 1054, 10, 5, 6, 1055, 1056, 1057,
+	1058, 1059, 1060, 1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060,
+	1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 1054, 10, 5, 6,
+	1055, 1056, 1057, 1058, 1059, 1060, 2985, 2986, 2990, 2993, 0, 3012,
+	2996, 2991, 3001, 3013, 3007, 3008, 3009, 3010, 2997, 3003, 3005,
+	2999, 3006, 2995, 2998, 2988, 2989, 2992, 2994, 3000, 3002, 3004,
+	3172, 2633, 3173, 3174, 0, 2986, 2990, 0, 3011, 0, 0, 2991, 0, 3013,
+	3007, 3008, 3009, 3010, 2997, 3003, 3005, 2999, 3006, 0, 2998, 2988,
+	2989, 2992, 0, 3000, 0, 3004, 0, 0, 0, 0, 0, 0, 2990, 0, 0, 0, 0,
+	2991, 0, 3013, 0, 3008, 0, 3010, 2997, 3003, 0, 2999, 3006, 0, 2998,
+	0, 0, 2992, 0, 3000, 0, 3004, 0, 2633, 0, 3174, 0, 2986, 2990, 0,
+	3011, 0, 0, 2991, 3001, 3013, 3007, 0, 3009, 3010, 2997, 3003, 3005,
+	2999, 3006, 0, 2998, 2988, 2989, 2992, 0, 3000, 3002, 3004, 3172, 0,
+	3173, 0, 2985, 2986, 2990, 2993, 3011, 3012, 2996, 2991, 3001, 3013,
+	0, 3008, 3009, 3010, 2997, 3003, 3005, 2999, 3006, 2995, 2998, 2988,
+	2989, 2992, 2994, 3000, 3002, 3004, 0, 0, 0, 0, 0, 2986, 2990, 2993,
+	0, 3012, 2996, 2991, 3001, 3013, 0, 3008, 3009, 3010, 2997, 3003,
+	3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 0,
+	0, 0, 0, 0, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194,
+	3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205,
+	3206, 3207, 3208, 3209, 3210, 3211, 3212, 1070, 509, 3213, 3214, 0,
+	1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3215, 2051,
+	3216, 3217, 3218, 3219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3220, 3221,
+	3222, 0, 0, 0, 3223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3224, 3225, 1828, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1332, 3226,
+	3227, 3228, 1275, 3229, 3230, 1650, 3231, 3232, 3233, 3234, 3235,
+	3236, 3237, 3238, 3239, 3240, 1368, 3241, 3242, 3243, 3244, 3245,
+	3246, 1269, 1642, 3247, 1777, 1645, 1778, 3248, 1424, 3249, 3250,
+	3251, 3252, 3253, 1760, 1342, 3254, 3255, 3256, 3257, 0, 0, 0, 0,
+	3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 0, 0, 0, 0, 0,
+	0, 0, 3267, 3268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1054, 10,
+	5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 0, 0, 0, 0, 0, 0, 3269,
+	3270, 3271, 3272, 3273, 2418, 3274, 3275, 3276, 3277, 2419, 3278,
+	3279, 3280, 2420, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288,
+	3289, 3290, 3291, 3292, 2478, 3293, 3294, 3295, 3296, 3297, 3298,
+	3299, 3300, 3301, 2483, 2421, 2422, 2484, 3302, 3303, 2229, 3304,
+	2423, 3305, 3306, 3307, 3308, 3308, 3308, 3309, 3310, 3311, 3312,
+	3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323,
+	3324, 3325, 3326, 3326, 2486, 3327, 3328, 3329, 3330, 2425, 3331,
+	3332, 3333, 2382, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341,
+	3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352,
+	3353, 3354, 3355, 3356, 3357, 3358, 3359, 3359, 3360, 3361, 3362,
+	2225, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 2430, 3371,
+	3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382,
+	3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 2171, 3392,
+	3393, 3394, 3394, 3395, 3396, 3396, 3397, 3398, 3399, 3400, 3401,
+	3402, 3403, 3404, 3405, 3406, 3407, 3408, 3409, 2431, 3410, 3411,
+	3412, 3413, 2498, 3413, 3414, 2433, 3415, 3416, 3417, 3418, 2434,
+	2144, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428,
+	3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439,
+	3440, 2435, 3441, 3442, 3443, 3444, 3445, 3446, 2437, 3447, 3448,
+	3449, 3450, 3451, 3452, 3453, 3454, 2172, 2506, 3455, 3456, 3457,
+	3458, 3459, 3460, 3461, 3462, 2438, 3463, 3464, 3465, 3466, 2549,
+	3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477,
+	3478, 3479, 2242, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487,
+	3488, 3489, 3490, 2439, 2329, 3491, 3492, 3493, 3494, 3495, 3496,
+	3497, 3498, 2510, 3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506,
+	2511, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516,
+	3517, 3518, 2513, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526,
+	3527, 3528, 3529, 3529, 3530, 3531, 2515, 3532, 3533, 3534, 3535,
+	3536, 3537, 3538, 2228, 3539, 3540, 3541, 3542, 3543, 3544, 3545,
+	2521, 3546, 3547, 3548, 3549, 3550, 3551, 3551, 2522, 2551, 3552,
+	3553, 3554, 3555, 3556, 2190, 2524, 3557, 3558, 2450, 3559, 3560,
+	2404, 3561, 3562, 2454, 3563, 3564, 3565, 3566, 3566, 3567, 3568,
+	3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579,
+	3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590,
+	3591, 3592, 3593, 2460, 3594, 3595, 3596, 3597, 3598, 3599, 3600,
+	3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3395, 3610,
+	3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621,
+	2246, 3622, 3623, 3624, 3625, 3626, 3627, 2463, 3628, 3629, 3630,
+	3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641,
+	3642, 3643, 3644, 3645, 3646, 3647, 2185, 3648, 3649, 3650, 3651,
+	3652, 3653, 2531, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661,
+	3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672,
+	3673, 2536, 2537, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681,
+	3682, 3683, 3684, 3685, 3686, 2538, 3687, 3688, 3689, 3690, 3691,
+	3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702,
+	3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713,
+	3714, 3715, 3716, 2544, 2544, 3717, 3718, 3719, 3720, 3721, 3722,
+	3723, 3724, 3725, 3726, 2545, 3727, 3728, 3729, 3730, 3731, 3732,
+	3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743,
+	3744, 3745, 0, 0
+};
+
+static inline uint16_t normdecomp_lookup(Rune c)
+{
+	size_t i = (size_t)normdecomp_idx1[c >> 10] << 6 | (c >> 4 & 0x3f);
+
+	return normdecomp_blk[(size_t)normdecomp_idx2[i] << 4 | (c & 0xf)];
+}
+
+static const uint64_t normcomp_key[941] = {
+	125829944, 127927096, 130024248, 136315648, 136315649, 136315650,
+	136315651, 136315652, 136315654, 136315655, 136315656, 136315657,
+	136315658, 136315660, 136315663, 136315665, 136315683, 136315685,
+	136315688, 138412807, 138412835, 138412849, 140509953, 140509954,
+	140509959, 140509964, 140509991, 142607111, 142607116, 142607139,
+	142607143, 142607149, 142607153, 144704256, 144704257, 144704258,
+	144704259, 144704260, 144704262, 144704263, 144704264, 144704265,
+	144704268, 144704271, 144704273, 144704291, 144704295, 144704296,
+	144704301, 144704304, 146801415, 148898561, 148898562, 148898564,
+	148898566, 148898567, 148898572, 148898599, 150995714, 150995719,
+	150995720, 150995724, 150995747, 150995751, 150995758, 153092864,
+	153092865, 153092866, 153092867, 153092868, 153092870, 153092871,
+	153092872, 153092873, 153092876, 153092879, 153092881, 153092899,
+	153092904, 153092912, 155190018, 157287169, 157287180, 157287203,
+	157287207, 157287217, 159384321, 159384332, 159384355, 159384359,
+	159384365, 159384369, 161481473, 161481479, 161481507, 163578624,
+	163578625, 163578627, 163578631, 163578636, 163578659, 163578663,
+	163578669, 163578673, 165675776, 165675777, 165675778, 165675779,
+	165675780, 165675782, 165675783, 165675784, 165675785, 165675787,
+	165675788, 165675791, 165675793, 165675803, 165675811, 165675816,
+	167772929, 167772935, 171967233, 171967239, 171967244, 171967247,
+	171967249, 171967267, 171967271, 171967281, 174064385, 174064386,
+	174064391, 174064396, 174064419, 174064422, 174064423, 176161543,
+	176161548, 176161571, 176161574, 176161575, 176161581, 176161585,
+	178258688, 178258689, 178258690, 178258691, 178258692, 178258694,
+	178258696, 178258697, 178258698, 178258699, 178258700, 178258703,
+	178258705, 178258715, 178258723, 178258724, 178258728, 178258733,
+	178258736, 180355843, 180355875, 182452992, 182452993, 182452994,
+	182452999, 182453000, 182453027, 184550151, 184550152, 186647296,
+	186647297, 186647298, 186647299, 186647300, 186647303, 186647304,
+	186647305, 186647331, 188744449, 188744450, 188744455, 188744460,
+	188744483, 188744497, 203424512, 203424513, 203424514, 203424515,
+	203424516, 203424518, 203424519, 203424520, 203424521, 203424522,
+	203424524, 203424527, 203424529, 203424547, 203424549, 203424552,
+	205521671, 205521699, 205521713, 207618817, 207618818, 207618823,
+	207618828, 207618855, 209715975, 209715980, 209716003, 209716007,
+	209716013, 209716017, 211813120, 211813121, 211813122, 211813123,
+	211813124, 211813126, 211813127, 211813128, 211813129, 211813132,
+	211813135, 211813137, 211813155, 211813159, 211813160, 211813165,
+	211813168, 213910279, 216007425, 216007426, 216007428, 216007430,
+	216007431, 216007436, 216007463, 218104578, 218104583, 218104584,
+	218104588, 218104611, 218104615, 218104622, 218104625, 220201728,
+	220201729, 220201730, 220201731, 220201732, 220201734, 220201736,
+	220201737, 220201740, 220201743, 220201745, 220201763, 220201768,
+	220201776, 222298882, 222298892, 224396033, 224396044, 224396067,
+	224396071, 224396081, 226493185, 226493196, 226493219, 226493223,
+	226493229, 226493233, 228590337, 228590343, 228590371, 230687488,
+	230687489, 230687491, 230687495, 230687500, 230687523, 230687527,
+	230687533, 230687537, 232784640, 232784641, 232784642, 232784643,
+	232784644, 232784646, 232784647, 232784648, 232784649, 232784651,
+	232784652, 232784655, 232784657, 232784667, 232784675, 232784680,
+	234881793, 234881799, 239076097, 239076103, 239076108, 239076111,
+	239076113, 239076131, 239076135, 239076145, 241173249, 241173250,
+	241173255, 241173260, 241173283, 241173286, 241173287, 243270407,
+	243270408, 243270412, 243270435, 243270438, 243270439, 243270445,
+	243270449, 245367552, 245367553, 245367554, 245367555, 245367556,
+	245367558, 245367560, 245367561, 245367562, 245367563, 245367564,
+	245367567, 245367569, 245367579, 245367587, 245367588, 245367592,
+	245367597, 245367600, 247464707, 247464739, 249561856, 249561857,
+	249561858, 249561863, 249561864, 249561866, 249561891, 251659015,
+	251659016, 253756160, 253756161, 253756162, 253756163, 253756164,
+	253756167, 253756168, 253756169, 253756170, 253756195, 255853313,
+	255853314, 255853319, 255853324, 255853347, 255853361, 352322304,
+	352322305, 352322370, 406848256, 406848257, 406848259, 406848265,
+	411042564, 413139713, 415236865, 415236868, 417334017, 423625472,
+	423625473, 423625475, 423625481, 434111233, 444596992, 444596993,
+	444596995, 444597001, 446694145, 446694148, 446694152, 448791300,
+	452985601, 461374208, 461374209, 461374212, 461374220, 473957120,
+	473957121, 473957123, 473957129, 478151428, 480248577, 482345729,
+	482345732, 484442881, 490734336, 490734337, 490734339, 490734345,
+	501220097, 511705856, 511705857, 511705859, 511705865, 513803009,
+	513803012, 513803016, 515900164, 520094465, 528483072, 528483073,
+	528483076, 528483084, 541065984, 541065985, 541065987, 541065993,
+	543163136, 543163137, 543163139, 543163145, 574620416, 574620417,
+	576717568, 576717569, 696255232, 696255233, 698352384, 698352385,
+	725615367, 727712519, 738198279, 740295431, 754975489, 757072641,
+	759169800, 761266952, 803209991, 872416000, 872416001, 872416003,
+	872416009, 872416035, 874513152, 874513153, 874513155, 874513161,
+	874513187, 903873280, 903873281, 903873283, 903873289, 903873315,
+	905970432, 905970433, 905970435, 905970441, 905970467, 920650508,
+	1027605252, 1029702404, 1153434372, 1155531524, 1157628678,
+	1159725830, 1170211588, 1172308740, 1379926796, 1914700544,
+	1914700545, 1914700548, 1914700550, 1914700563, 1914700564,
+	1914700613, 1923089152, 1923089153, 1923089171, 1923089172,
+	1927283456, 1927283457, 1927283475, 1927283476, 1927283525,
+	1931477760, 1931477761, 1931477764, 1931477766, 1931477768,
+	1931477779, 1931477780, 1944060672, 1944060673, 1944060691,
+	1944060692, 1948254996, 1956643584, 1956643585, 1956643588,
+	1956643590, 1956643592, 1956643604, 1965032192, 1965032193,
+	1965032211, 1965032212, 1965032261, 1971323717, 1975518021,
+	1981809408, 1981809409, 1981809412, 1981809414, 1981809427,
+	1981809428, 1981809474, 1981809477, 1990198016, 1990198017,
+	1990198035, 1990198036, 1994392320, 1994392321, 1994392339,
+	1994392340, 1994392386, 1994392389, 1998586624, 1998586625,
+	1998586628, 1998586630, 1998586632, 1998586643, 1998586644,
+	1998586690, 2011169536, 2011169537, 2011169555, 2011169556,
+	2015363859, 2015363860, 2023752448, 2023752449, 2023752452,
+	2023752454, 2023752456, 2023752467, 2023752468, 2023752514,
+	2032141056, 2032141057, 2032141075, 2032141076, 2032141122,
+	2032141125, 2034238208, 2034238209, 2034238274, 2036335360,
+	2036335361, 2036335426, 2042626885, 2051015425, 2051015432,
+	2160067336, 2181038854, 2181038856, 2187330305, 2191524608,
+	2191524614, 2191524616, 2193621766, 2193621768, 2195718920,
+	2197816064, 2197816068, 2197816070, 2197816072, 2202010369,
+	2210398984, 2220884740, 2220884742, 2220884744, 2220884747,
+	2229273352, 2237661960, 2241856264, 2248147718, 2248147720,
+	2254439169, 2258633472, 2258633478, 2258633480, 2260730630,
+	2260730632, 2262827784, 2264924928, 2264924932, 2264924934,
+	2264924936, 2269119233, 2277507848, 2287993604, 2287993606,
+	2287993608, 2287993611, 2296382216, 2304770824, 2308965128,
+	2327839496, 2390754063, 2392851215, 2600469256, 2602566408,
+	2634023688, 2636120840, 3303016019, 3303016020, 3303016021,
+	3372222036, 3376416340, 3625977428, 3661629012, 3667920468,
+	4915726652, 4932503868, 4938795324, 5249173950, 5249173975,
+	6054480702, 6054480726, 6054480727, 6211767255, 6320819134,
+	6320819159, 6322916286, 6589254742, 6843010261, 6857690306,
+	6857690325, 6857690326, 6866078933, 7126125886, 7126125911,
+	7128223038, 7434407370, 7434407375, 7434407391, 7440698826,
+	8667533358, 14506007349, 14510201653, 14514395957, 14518590261,
+	14522784565, 14531173173, 14617156405, 14621350709, 14625545013,
+	14627642165, 14633933621, 16219374340, 16221471492, 16294871812,
+	16296968964, 16311649031, 16313746183, 16441672450, 16441672454,
+	16443769602, 16443769606, 16492004098, 16494101250, 16533947138,
+	16536044290, 16642999040, 16642999041, 16642999106, 16642999109,
+	16645096192, 16645096193, 16645096258, 16645096261, 16647193413,
+	16649290565, 16651387717, 16653484869, 16655582021, 16657679173,
+	16659776256, 16659776257, 16659776322, 16659776325, 16661873408,
+	16661873409, 16661873474, 16661873477, 16663970629, 16666067781,
+	16668164933, 16670262085, 16672359237, 16674456389, 16676553472,
+	16676553473, 16678650624, 16678650625, 16693330688, 16693330689,
+	16695427840, 16695427841, 16710107904, 16710107905, 16710107970,
+	16710107973, 16712205056, 16712205057, 16712205122, 16712205125,
+	16714302277, 16716399429, 16718496581, 16720593733, 16722690885,
+	16724788037, 16726885120, 16726885121, 16726885186, 16726885189,
+	16728982272, 16728982273, 16728982338, 16728982341, 16731079493,
+	16733176645, 16735273797, 16737370949, 16739468101, 16741565253,
+	16743662336, 16743662337, 16743662402, 16745759488, 16745759489,
+	16745759554, 16760439552, 16760439553, 16760439618, 16762536704,
+	16762536705, 16762536770, 16777216768, 16777216769, 16779313920,
+	16779313921, 16793993984, 16793993985, 16796091136, 16796091137,
+	16810771200, 16810771201, 16810771266, 16812868352, 16812868353,
+	16812868418, 16829645568, 16829645569, 16829645634, 16844325632,
+	16844325633, 16844325698, 16844325701, 16846422784, 16846422785,
+	16846422850, 16846422853, 16848520005, 16850617157, 16852714309,
+	16854811461, 16856908613, 16859005765, 16861102848, 16861102849,
+	16861102914, 16861102917, 16863200000, 16863200001, 16863200066,
+	16863200069, 16865297221, 16867394373, 16869491525, 16871588677,
+	16873685829, 16875782981, 16877880133, 16886268741, 16903045957,
+	17024680773, 17043555072, 17043555073, 17043555138, 17058235205,
+	17158898501, 17175675648, 17175675649, 17175675714, 18018730808,
+	18022925112, 18027119416, 18152948536, 18157142840, 18161337144,
+	18259903288, 18270389048, 18276680504, 18327012152, 18331206456,
+	18379440952, 18394121016, 18398315320, 18404606776, 18415092536,
+	18457035576, 18463327032, 18465424184, 18492687160, 18494784312,
+	18501075768, 18503172920, 18509464376, 18511561528, 18513658680,
+	18515755832, 18526241592, 18528338744, 18534630200, 18536727352,
+	18557698872, 18559796024, 18593350456, 18605933368, 18608030520,
+	18612224824, 18626904888, 18629002040, 18631099192, 18633196344,
+	25916616857, 25927102617, 25931296921, 25935491225, 25939685529,
+	25943879833, 25948074137, 25952268441, 25956462745, 25960657049,
+	25964851353, 25969045657, 25973239961, 25979531417, 25983725721,
+	25987920025, 26002600089, 26002600090, 26008891545, 26008891546,
+	26015183001, 26015183002, 26021474457, 26021474458, 26027765913,
+	26027765914, 26099069081, 26117943449, 26128429209, 26132623513,
+	26136817817, 26141012121, 26145206425, 26149400729, 26153595033,
+	26157789337, 26161983641, 26166177945, 26170372249, 26174566553,
+	26180858009, 26185052313, 26189246617, 26203926681, 26203926682,
+	26210218137, 26210218138, 26216509593, 26216509594, 26222801049,
+	26222801050, 26229092505, 26229092506, 26271035545, 26273132697,
+	26275229849, 26277327001, 26300395673, 146349822138, 146354016442,
+	146374987962, 146668589351, 146670686503, 147788469054, 147788469079,
+	148564415664, 148564415674, 148564415677, 149099189679, 149101286831,
+	150971947312
+};
+
+static const uint32_t normcomp_val[941] = {
+	8814, 8800, 8815, 192, 193, 194, 195, 256, 258, 550, 196, 7842, 197,
+	461, 512, 514, 7840, 7680, 260, 7682, 7684, 7686, 262, 264, 266, 268,
+	199, 7690, 270, 7692, 7696, 7698, 7694, 200, 201, 202, 7868, 274, 276,
+	278, 203, 7866, 282, 516, 518, 7864, 552, 280, 7704, 7706, 7710, 500,
+	284, 7712, 286, 288, 486, 290, 292, 7714, 7718, 542, 7716, 7720, 7722,
+	204, 205, 206, 296, 298, 300, 304, 207, 7880, 463, 520, 522, 7882,
+	302, 7724, 308, 7728, 488, 7730, 310, 7732, 313, 317, 7734, 315, 7740,
+	7738, 7742, 7744, 7746, 504, 323, 209, 7748, 327, 7750, 325, 7754,
+	7752, 210, 211, 212, 213, 332, 334, 558, 214, 7886, 336, 465, 524,
+	526, 416, 7884, 490, 7764, 7766, 340, 7768, 344, 528, 530, 7770, 342,
+	7774, 346, 348, 7776, 352, 7778, 536, 350, 7786, 356, 7788, 538, 354,
+	7792, 7790, 217, 218, 219, 360, 362, 364, 220, 7910, 366, 368, 467,
+	532, 534, 431, 7908, 7794, 370, 7798, 7796, 7804, 7806, 7808, 7810,
+	372, 7814, 7812, 7816, 7818, 7820, 7922, 221, 374, 7928, 562, 7822,
+	376, 7926, 7924, 377, 7824, 379, 381, 7826, 7828, 224, 225, 226, 227,
+	257, 259, 551, 228, 7843, 229, 462, 513, 515, 7841, 7681, 261, 7683,
+	7685, 7687, 263, 265, 267, 269, 231, 7691, 271, 7693, 7697, 7699,
+	7695, 232, 233, 234, 7869, 275, 277, 279, 235, 7867, 283, 517, 519,
+	7865, 553, 281, 7705, 7707, 7711, 501, 285, 7713, 287, 289, 487, 291,
+	293, 7715, 7719, 543, 7717, 7721, 7723, 7830, 236, 237, 238, 297, 299,
+	301, 239, 7881, 464, 521, 523, 7883, 303, 7725, 309, 496, 7729, 489,
+	7731, 311, 7733, 314, 318, 7735, 316, 7741, 7739, 7743, 7745, 7747,
+	505, 324, 241, 7749, 328, 7751, 326, 7755, 7753, 242, 243, 244, 245,
+	333, 335, 559, 246, 7887, 337, 466, 525, 527, 417, 7885, 491, 7765,
+	7767, 341, 7769, 345, 529, 531, 7771, 343, 7775, 347, 349, 7777, 353,
+	7779, 537, 351, 7787, 7831, 357, 7789, 539, 355, 7793, 7791, 249, 250,
+	251, 361, 363, 365, 252, 7911, 367, 369, 468, 533, 535, 432, 7909,
+	7795, 371, 7799, 7797, 7805, 7807, 7809, 7811, 373, 7815, 7813, 7832,
+	7817, 7819, 7821, 7923, 253, 375, 7929, 563, 7823, 255, 7927, 7833,
+	7925, 378, 7825, 380, 382, 7827, 7829, 8173, 901, 8129, 7846, 7844,
+	7850, 7848, 478, 506, 508, 482, 7688, 7872, 7870, 7876, 7874, 7726,
+	7890, 7888, 7894, 7892, 7756, 556, 7758, 554, 510, 475, 471, 469, 473,
+	7847, 7845, 7851, 7849, 479, 507, 509, 483, 7689, 7873, 7871, 7877,
+	7875, 7727, 7891, 7889, 7895, 7893, 7757, 557, 7759, 555, 511, 476,
+	472, 470, 474, 7856, 7854, 7860, 7858, 7857, 7855, 7861, 7859, 7700,
+	7702, 7701, 7703, 7760, 7762, 7761, 7763, 7780, 7781, 7782, 7783,
+	7800, 7801, 7802, 7803, 7835, 7900, 7898, 7904, 7902, 7906, 7901,
+	7899, 7905, 7903, 7907, 7914, 7912, 7918, 7916, 7920, 7915, 7913,
+	7919, 7917, 7921, 494, 492, 493, 480, 481, 7708, 7709, 560, 561, 495,
+	8122, 902, 8121, 8120, 7944, 7945, 8124, 8136, 904, 7960, 7961, 8138,
+	905, 7976, 7977, 8140, 8154, 906, 8153, 8152, 938, 7992, 7993, 8184,
+	908, 8008, 8009, 8172, 8170, 910, 8169, 8168, 939, 8025, 8186, 911,
+	8040, 8041, 8188, 8116, 8132, 8048, 940, 8113, 8112, 7936, 7937, 8118,
+	8115, 8050, 941, 7952, 7953, 8052, 942, 7968, 7969, 8134, 8131, 8054,
+	943, 8145, 8144, 970, 7984, 7985, 8150, 8056, 972, 8000, 8001, 8164,
+	8165, 8058, 973, 8161, 8160, 971, 8016, 8017, 8166, 8060, 974, 8032,
+	8033, 8182, 8179, 8146, 912, 8151, 8162, 944, 8167, 8180, 979, 980,
+	1031, 1232, 1234, 1027, 1024, 1238, 1025, 1217, 1244, 1246, 1037,
+	1250, 1049, 1252, 1036, 1254, 1262, 1038, 1264, 1266, 1268, 1272,
+	1260, 1233, 1235, 1107, 1104, 1239, 1105, 1218, 1245, 1247, 1117,
+	1251, 1081, 1253, 1116, 1255, 1263, 1118, 1265, 1267, 1269, 1273,
+	1261, 1111, 1142, 1143, 1242, 1243, 1258, 1259, 1570, 1571, 1573,
+	1572, 1574, 1730, 1747, 1728, 2345, 2353, 2356, 2507, 2508, 2891,
+	2888, 2892, 2964, 3018, 3020, 3019, 3144, 3264, 3274, 3271, 3272,
+	3275, 3402, 3404, 3403, 3546, 3548, 3550, 3549, 4134, 6918, 6920,
+	6922, 6924, 6926, 6930, 6971, 6973, 6976, 6977, 6979, 7736, 7737,
+	7772, 7773, 7784, 7785, 7852, 7862, 7853, 7863, 7878, 7879, 7896,
+	7897, 7938, 7940, 7942, 8064, 7939, 7941, 7943, 8065, 8066, 8067,
+	8068, 8069, 8070, 8071, 7946, 7948, 7950, 8072, 7947, 7949, 7951,
+	8073, 8074, 8075, 8076, 8077, 8078, 8079, 7954, 7956, 7955, 7957,
+	7962, 7964, 7963, 7965, 7970, 7972, 7974, 8080, 7971, 7973, 7975,
+	8081, 8082, 8083, 8084, 8085, 8086, 8087, 7978, 7980, 7982, 8088,
+	7979, 7981, 7983, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 7986,
+	7988, 7990, 7987, 7989, 7991, 7994, 7996, 7998, 7995, 7997, 7999,
+	8002, 8004, 8003, 8005, 8010, 8012, 8011, 8013, 8018, 8020, 8022,
+	8019, 8021, 8023, 8027, 8029, 8031, 8034, 8036, 8038, 8096, 8035,
+	8037, 8039, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8042, 8044,
+	8046, 8104, 8043, 8045, 8047, 8105, 8106, 8107, 8108, 8109, 8110,
+	8111, 8114, 8130, 8178, 8119, 8141, 8142, 8143, 8135, 8183, 8157,
+	8158, 8159, 8602, 8603, 8622, 8653, 8655, 8654, 8708, 8713, 8716,
+	8740, 8742, 8769, 8772, 8775, 8777, 8813, 8802, 8816, 8817, 8820,
+	8821, 8824, 8825, 8832, 8833, 8928, 8929, 8836, 8837, 8840, 8841,
+	8930, 8931, 8876, 8877, 8878, 8879, 8938, 8939, 8940, 8941, 12436,
+	12364, 12366, 12368, 12370, 12372, 12374, 12376, 12378, 12380, 12382,
+	12384, 12386, 12389, 12391, 12393, 12400, 12401, 12403, 12404, 12406,
+	12407, 12409, 12410, 12412, 12413, 12446, 12532, 12460, 12462, 12464,
+	12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485,
+	12487, 12489, 12496, 12497, 12499, 12500, 12502, 12503, 12505, 12506,
+	12508, 12509, 12535, 12536, 12537, 12538, 12542, 69786, 69788, 69803,
+	69934, 69935, 70475, 70476, 70844, 70843, 70846, 71098, 71099, 71992
+};
+
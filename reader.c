@@ -0,0 +1,175 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "utf.h"
+#include "utfint.h"
+
+/* size and alignment of a new buffer, read in one go */
+#define READER_SIZE 65536
+#define READER_ALIGN 4096
+
+/* allocate an aligned buffer */
+static char *reader_alloc(size_t size)
+{
+	void *buf;
+
+	if (posix_memalign(&buf, READER_ALIGN, size))
+		return NULL;
+	return buf;
+}
+
+static int reader_init(struct utfreader *rd, int fd, FILE *fp)
+{
+	memset(rd, 0, sizeof(*rd));
+	rd->fd = fd;
+	rd->fp = fp;
+	rd->buf = reader_alloc(READER_SIZE);
+	if (!rd->buf)
+		return -1;
+	rd->size = READER_SIZE;
+	return 0;
+}
+
+int utfreaderfd(struct utfreader *rd, int fd)
+{
+	return reader_init(rd, fd, NULL);
+}
+
+int utfreaderfile(struct utfreader *rd, FILE *fp)
+{
+	return reader_init(rd, -1, fp);
+}
+
+void utfreaderfree(struct utfreader *rd)
+{
+	free(rd->buf);
+	rd->buf = NULL;
+	rd->size = rd->pos = rd->end = rd->last = 0;
+}
+
+/* read until at least want bytes are buffered, return -1 on errors */
+static int reader_fill(struct utfreader *rd, size_t want)
+{
+	while (rd->end - rd->pos < want && !rd->eof) {
+		/* keep the last rune for utfungetrune() */
+		size_t from = rd->pos - rd->last, got;
+
+		if (rd->size - rd->end < want - (rd->end - rd->pos)) {
+			if (want + rd->last > rd->size) {
+				size_t size = rd->size * 2;
+				char *buf;
+
+				while (size < want + rd->last)
+					size *= 2;
+				buf = reader_alloc(size);
+				if (!buf)
+					return -1;
+				memcpy(buf, rd->buf + from, rd->end - from);
+				free(rd->buf);
+				rd->buf = buf;
+				rd->size = size;
+			} else {
+				memmove(rd->buf, rd->buf + from,
+				        rd->end - from);
+			}
+			rd->pos -= from;
+			rd->end -= from;
+		}
+		if (rd->fd >= 0) {
+			ssize_t r = read(rd->fd, rd->buf + rd->end,
+			                 rd->size - rd->end);
+
+			if (r < 0 && errno == EINTR)
+				continue;
+			if (r < 0) {
+				rd->err = 1;
+				return -1;
+			}
+			got = r;
+		} else {
+			got = fread(rd->buf + rd->end, 1, rd->size - rd->end,
+			            rd->fp);
+			if (!got && ferror(rd->fp)) {
+				rd->err = 1;
+				return -1;
+			}
+		}
+		if (!got)
+			rd->eof = 1;
+		rd->end += got;
+	}
+	return 0;
+}
+
+int utfgetrune(struct utfreader *rd, Rune *rune)
+{
+	size_t n = rd->end - rd->pos;
+	int w;
+
+	if (n && (unsigned char)rd->buf[rd->pos] < Runeself) {
+		*rune = (unsigned char)rd->buf[rd->pos++];
+		rd->last = 1;
+		return 1;
+	}
+	/* a sequence may be split between reads, read only what completes it */
+	while (!fullrune(rd->buf + rd->pos, n) && !rd->eof) {
+		if (reader_fill(rd, n + 1))
+			break;
+		n = rd->end - rd->pos;
+	}
+	if (!n)
+		return rd->err ? -1 : 0;
+	w = charntorune(rune, rd->buf + rd->pos, n);
+	rd->pos += w;
+	rd->last = w;
+	return w;
+}
+
+int utfungetrune(struct utfreader *rd)
+{
+	if (!rd->last)
+		return -1;
+	rd->pos -= rd->last;
+	rd->last = 0;
+	return 0;
+}
+
+char *utfgetline(struct utfreader *rd, Rune delim, size_t *len)
+{
+	char sep[UTFmax];
+	size_t m = runetochar(sep, &delim), off = 0;
+
+	for (;;) {
+		size_t n = rd->end - rd->pos;
+		char *line = rd->buf + rd->pos, *p;
+
+		p = utfnutf(line + off, n - off, sep, m);
+		if (p || (rd->eof && n)) {
+			*len = p ? (size_t)(p - line) + m : n;
+			rd->pos += *len;
+			rd->last = 0;
+			return line;
+		}
+		if (rd->eof)
+			return NULL;
+		/* the delimiter may be split between reads */
+		off = (n >= m) ? n - m + 1 : 0;
+		if (reader_fill(rd, n + 1))
+			return NULL;
+	}
+}
+
+char *utfreaderpeek(struct utfreader *rd, size_t min, size_t *len)
+{
+	if (reader_fill(rd, min) && rd->end - rd->pos < min)
+		return NULL;
+	rd->last = 0;
+	*len = rd->end - rd->pos;
+	return rd->buf + rd->pos;
+}
+
+void utfreaderskip(struct utfreader *rd, size_t n)
+{
+	rd->pos += n;
+	rd->last = 0;
+}
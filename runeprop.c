@@ -0,0 +1,50 @@
+#include "utf.h"
+#include "runeprop.h"
+
+/* binary properties, in the order of mktables.pl */
+enum {
+	PROP_WHITE_SPACE = 1 << 0,
+	PROP_ALPHABETIC = 1 << 1,
+	PROP_UPPERCASE = 1 << 2,
+	PROP_LOWERCASE = 1 << 3
+};
+
+static inline unsigned runeprop(Rune c)
+{
+	return (c <= Runemax) ? runeprop_lookup(c) : RUNEPROP_UNASSIGNED;
+}
+
+enum runecategory runecategory(Rune rune)
+{
+	return runeprop_gc[runeprop(rune)];
+}
+
+uint32_t runescript(Rune rune)
+{
+	return runeprop_script[runeprop_sc[runeprop(rune)]];
+}
+
+int runeisspace(Rune rune)
+{
+	return runeprop_flags[runeprop(rune)] & PROP_WHITE_SPACE ? 1 : 0;
+}
+
+int runeisalpha(Rune rune)
+{
+	return runeprop_flags[runeprop(rune)] & PROP_ALPHABETIC ? 1 : 0;
+}
+
+int runeisupper(Rune rune)
+{
+	return runeprop_flags[runeprop(rune)] & PROP_UPPERCASE ? 1 : 0;
+}
+
+int runeislower(Rune rune)
+{
+	return runeprop_flags[runeprop(rune)] & PROP_LOWERCASE ? 1 : 0;
+}
+
+int runeisdigit(Rune rune)
+{
+	return runecategory(rune) == RUNECAT_ND;
+}
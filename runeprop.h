@@ -0,0 +1,1573 @@
+/* generated by mktables.pl from Unicode 14.0.0, do not edit */
+
+static const uint32_t runeprop_script[162] = {
+	0x5a797979, 0x4c61746e, 0x426f706f, 0x5a696e68, 0x4772656b,
+	0x5a7a7a7a, 0x436f7074, 0x4379726c, 0x41726d6e, 0x48656272,
+	0x41726162, 0x53797263, 0x54686161, 0x4e6b6f6f, 0x53616d72,
+	0x4d616e64, 0x44657661, 0x42656e67, 0x47757275, 0x47756a72,
+	0x4f727961, 0x54616d6c, 0x54656c75, 0x4b6e6461, 0x4d6c796d,
+	0x53696e68, 0x54686169, 0x4c616f6f, 0x54696274, 0x4d796d72,
+	0x47656f72, 0x48616e67, 0x45746869, 0x43686572, 0x43616e73,
+	0x4f67616d, 0x52756e72, 0x54676c67, 0x48616e6f, 0x42756864,
+	0x54616762, 0x4b686d72, 0x4d6f6e67, 0x4c696d62, 0x54616c65,
+	0x54616c75, 0x42756769, 0x4c616e61, 0x42616c69, 0x53756e64,
+	0x4261746b, 0x4c657063, 0x4f6c636b, 0x42726169, 0x476c6167,
+	0x54666e67, 0x48616e69, 0x48697261, 0x4b616e61, 0x59696969,
+	0x4c697375, 0x56616969, 0x42616d75, 0x53796c6f, 0x50686167,
+	0x53617572, 0x4b616c69, 0x526a6e67, 0x4a617661, 0x4368616d,
+	0x54617674, 0x4d746569, 0x4c696e62, 0x4c796369, 0x43617269,
+	0x4974616c, 0x476f7468, 0x5065726d, 0x55676172, 0x5870656f,
+	0x44737274, 0x53686177, 0x4f736d61, 0x4f736765, 0x456c6261,
+	0x41676862, 0x56697468, 0x4c696e61, 0x43707274, 0x41726d69,
+	0x50616c6d, 0x4e626174, 0x48617472, 0x50686e78, 0x4c796469,
+	0x4d65726f, 0x4d657263, 0x4b686172, 0x53617262, 0x4e617262,
+	0x4d616e69, 0x41767374, 0x50727469, 0x50686c69, 0x50686c70,
+	0x4f726b68, 0x48756e67, 0x526f6867, 0x59657a69, 0x536f676f,
+	0x536f6764, 0x4f756772, 0x43687273, 0x456c796d, 0x42726168,
+	0x4b746869, 0x536f7261, 0x43616b6d, 0x4d61686a, 0x53687264,
+	0x4b686f6a, 0x4d756c74, 0x53696e64, 0x4772616e, 0x4e657761,
+	0x54697268, 0x53696464, 0x4d6f6469, 0x54616b72, 0x41686f6d,
+	0x446f6772, 0x57617261, 0x4469616b, 0x4e616e64, 0x5a616e62,
+	0x536f796f, 0x50617563, 0x42686b73, 0x4d617263, 0x476f6e6d,
+	0x476f6e67, 0x4d616b61, 0x58737578, 0x43706d6e, 0x45677970,
+	0x486c7577, 0x4d726f6f, 0x546e7361, 0x42617373, 0x486d6e67,
+	0x4d656466, 0x506c7264, 0x54616e67, 0x4e736875, 0x4b697473,
+	0x4475706c, 0x53676e77, 0x486d6e70, 0x546f746f, 0x5763686f,
+	0x4d656e64, 0x41646c6d
+};
+
+#define RUNEPROP_UNASSIGNED 32
+
+static const uint8_t runeprop_gc[713] = {
+	26, 26, 23, 18, 20, 14, 15, 19, 13, 9, 1, 21, 12, 2, 22, 5, 16, 27,
+	11, 2, 17, 5, 3, 4, 4, 4, 21, 6, 6, 1, 2, 21, 0, 4, 1, 2, 19, 1, 2,
+	22, 6, 8, 1, 4, 18, 2, 13, 22, 20, 6, 6, 13, 18, 5, 27, 19, 18, 20,
+	22, 6, 5, 6, 6, 9, 4, 18, 27, 5, 6, 6, 5, 6, 9, 5, 6, 4, 22, 18, 20,
+	5, 6, 6, 4, 18, 5, 6, 18, 21, 6, 7, 5, 6, 9, 18, 4, 5, 6, 7, 6, 9, 20,
+	11, 22, 18, 6, 7, 5, 6, 9, 18, 6, 7, 5, 6, 9, 18, 20, 6, 7, 5, 6, 9,
+	22, 11, 6, 5, 7, 6, 9, 11, 22, 20, 6, 7, 6, 5, 9, 18, 11, 22, 5, 6, 7,
+	18, 6, 9, 6, 7, 5, 6, 22, 11, 9, 6, 7, 5, 6, 9, 18, 5, 6, 4, 6, 18, 9,
+	5, 6, 6, 4, 9, 5, 22, 18, 6, 9, 11, 14, 15, 7, 6, 7, 5, 7, 6, 6, 9,
+	18, 22, 1, 2, 4, 5, 5, 6, 18, 11, 22, 1, 2, 13, 5, 22, 18, 23, 5, 14,
+	15, 5, 10, 5, 6, 6, 7, 5, 6, 7, 5, 6, 5, 6, 5, 6, 7, 6, 18, 4, 20, 9,
+	11, 18, 13, 6, 27, 9, 5, 4, 6, 5, 6, 7, 6, 22, 18, 9, 5, 5, 9, 11, 22,
+	22, 5, 6, 7, 18, 5, 7, 6, 6, 9, 18, 4, 8, 6, 7, 5, 6, 7, 9, 18, 22, 6,
+	7, 5, 7, 6, 9, 5, 6, 7, 6, 7, 18, 5, 7, 6, 6, 18, 9, 9, 5, 4, 18, 18,
+	7, 5, 4, 3, 27, 24, 25, 1, 10, 10, 10, 22, 22, 22, 1, 2, 22, 6, 18,
+	11, 5, 4, 18, 6, 6, 22, 4, 10, 7, 5, 4, 5, 4, 5, 22, 22, 5, 5, 4, 22,
+	5, 4, 18, 5, 4, 18, 9, 5, 18, 4, 5, 10, 6, 18, 4, 5, 6, 6, 7, 22, 5,
+	18, 7, 5, 6, 6, 18, 9, 9, 5, 6, 6, 18, 5, 6, 7, 7, 18, 6, 7, 5, 6, 7,
+	18, 9, 4, 5, 6, 7, 9, 18, 5, 6, 6, 4, 18, 5, 7, 6, 18, 4, 6, 7, 9, 28,
+	29, 19, 5, 10, 11, 22, 5, 5, 5, 11, 5, 10, 5, 6, 5, 18, 5, 18, 10, 1,
+	2, 5, 5, 9, 1, 2, 5, 5, 18, 1, 2, 5, 5, 5, 18, 11, 5, 22, 11, 5, 11,
+	5, 11, 5, 11, 18, 5, 18, 5, 5, 11, 5, 6, 6, 11, 18, 5, 11, 18, 5, 11,
+	5, 22, 6, 11, 18, 5, 18, 5, 11, 5, 11, 5, 18, 11, 5, 1, 2, 11, 5, 6,
+	9, 11, 5, 6, 13, 5, 11, 5, 6, 11, 18, 5, 6, 18, 5, 11, 5, 7, 6, 5, 6,
+	18, 11, 9, 6, 7, 5, 6, 18, 27, 5, 9, 6, 5, 7, 6, 9, 18, 5, 6, 18, 6,
+	7, 5, 7, 18, 6, 9, 11, 5, 7, 6, 7, 6, 18, 5, 18, 5, 6, 7, 6, 9, 6, 7,
+	5, 6, 7, 5, 7, 6, 6, 18, 9, 5, 7, 6, 6, 18, 9, 5, 7, 6, 6, 18, 5, 7,
+	6, 6, 18, 9, 5, 6, 7, 7, 6, 18, 9, 5, 6, 7, 6, 9, 11, 18, 22, 5, 7, 6,
+	6, 18, 1, 2, 9, 11, 5, 5, 7, 6, 7, 6, 18, 9, 5, 7, 6, 6, 18, 5, 6, 6,
+	7, 18, 5, 6, 7, 6, 18, 5, 5, 7, 6, 6, 18, 9, 11, 18, 5, 6, 7, 5, 6, 6,
+	9, 5, 7, 6, 6, 9, 5, 6, 7, 18, 18, 5, 10, 18, 5, 18, 5, 27, 5, 5, 9,
+	18, 5, 9, 5, 6, 18, 5, 6, 18, 22, 4, 9, 11, 1, 2, 11, 18, 5, 6, 7, 4,
+	4, 4, 18, 6, 7, 5, 5, 5, 5, 22, 6, 6, 18, 6, 22, 6, 18, 6, 5, 6, 4, 9,
+	22, 5, 6, 5, 6, 9, 20, 5, 11, 6, 1, 2, 6, 6, 4, 9, 18, 22
+};
+
+static const uint8_t runeprop_flags[713] = {
+	0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 10, 0, 10, 0, 0, 0, 10, 0, 2,
+	2, 10, 2, 10, 0, 0, 10, 6, 10, 0, 0, 10, 6, 10, 0, 6, 10, 0, 0, 0, 6,
+	2, 0, 10, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 2, 0,
+	0, 2, 2, 0, 2, 2, 0, 2, 0, 2, 0, 0, 0, 2, 2, 0, 2, 0, 2, 0, 0, 0, 2,
+	2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2,
+	2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 0,
+	2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0, 0,
+	0, 2, 2, 2, 0, 0, 0, 2, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 6, 10, 2, 2, 2, 0, 0, 0, 0, 6, 10, 0, 2, 0, 0, 1,
+	2, 0, 0, 2, 2, 2, 2, 0, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 2, 2, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+	2, 2, 2, 0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2,
+	0, 0, 0, 2, 0, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 10,
+	2, 0, 1, 1, 6, 6, 10, 2, 6, 10, 0, 6, 10, 0, 0, 0, 0, 2, 2, 0, 0, 2,
+	0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0, 2,
+	0, 2, 2, 2, 0, 0, 2, 2, 2, 0, 2, 0, 2, 0, 2, 2, 0, 2, 0, 0, 0, 2, 2,
+	0, 0, 2, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 2, 2, 0,
+	2, 0, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 2, 2, 0, 2, 2,
+	2, 2, 2, 0, 2, 0, 2, 6, 10, 2, 2, 0, 6, 10, 2, 2, 0, 6, 10, 2, 2, 2,
+	0, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 2, 0, 2, 2, 0, 2, 2, 0, 0, 0, 2,
+	0, 0, 2, 0, 2, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 0, 2, 6, 10, 0, 2,
+	2, 0, 0, 2, 2, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, 2, 0, 2, 2, 2, 2, 0, 0,
+	0, 0, 0, 2, 2, 2, 0, 0, 2, 0, 2, 2, 2, 0, 0, 0, 2, 0, 0, 2, 2, 2, 0,
+	0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 2, 0, 0, 2, 2, 2, 0, 0, 2,
+	2, 2, 0, 0, 0, 2, 2, 2, 0, 0, 0, 2, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0, 2,
+	2, 2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 6, 10, 0, 0,
+	2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0, 0, 2, 2, 0, 2, 0, 2, 2, 2, 0, 0,
+	2, 2, 2, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 0, 0, 2, 2,
+	2, 0, 0, 2, 2, 0, 2, 0, 2, 0, 2, 2, 0, 0, 2, 0, 2, 0, 0, 2, 0, 0, 0,
+	2, 0, 0, 6, 10, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0, 2,
+	0, 0, 0, 0, 0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, 6, 10, 0,
+	2, 2, 0, 0, 0
+};
+
+static const uint8_t runeprop_sc[713] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 1,
+	1, 0, 0, 2, 3, 3, 4, 4, 4, 5, 4, 6, 6, 4, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+	8, 8, 8, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 3, 10, 10, 10, 11,
+	11, 11, 11, 11, 12, 12, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14,
+	14, 15, 15, 15, 10, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19,
+	20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 22, 22,
+	22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24,
+	24, 24, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 27, 27, 27,
+	27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29,
+	29, 29, 29, 30, 30, 30, 31, 32, 32, 32, 32, 32, 33, 33, 34, 34, 34,
+	34, 35, 35, 35, 35, 36, 36, 37, 37, 37, 37, 38, 38, 38, 39, 39, 40,
+	40, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42,
+	42, 43, 43, 43, 43, 43, 43, 43, 44, 45, 45, 45, 45, 41, 46, 46, 46,
+	46, 47, 47, 47, 47, 47, 47, 47, 3, 48, 48, 48, 48, 48, 48, 48, 48, 49,
+	49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 49, 0, 0, 7, 4, 3, 0, 0, 0, 1, 1, 1, 0, 0, 53, 54, 54,
+	6, 6, 6, 6, 55, 55, 55, 55, 7, 56, 56, 56, 31, 57, 57, 58, 58, 2, 31,
+	58, 56, 59, 59, 59, 60, 60, 60, 61, 61, 61, 61, 7, 7, 7, 62, 62, 62,
+	62, 1, 63, 63, 63, 63, 63, 64, 64, 65, 65, 65, 65, 65, 65, 66, 66, 66,
+	66, 66, 67, 67, 67, 67, 67, 68, 68, 68, 68, 68, 68, 68, 29, 69, 69,
+	69, 69, 69, 70, 70, 70, 70, 70, 71, 71, 71, 71, 71, 71, 71, 71, 5, 5,
+	9, 72, 4, 4, 4, 73, 74, 75, 75, 76, 76, 77, 77, 78, 78, 79, 79, 79,
+	80, 80, 81, 82, 82, 83, 83, 84, 85, 85, 86, 86, 87, 88, 89, 89, 89,
+	90, 90, 90, 91, 91, 92, 92, 93, 93, 93, 94, 94, 95, 96, 96, 97, 97,
+	97, 97, 97, 98, 98, 98, 99, 99, 100, 100, 100, 100, 100, 101, 101,
+	102, 102, 103, 103, 104, 104, 104, 105, 106, 106, 106, 107, 107, 107,
+	10, 108, 108, 108, 109, 109, 110, 110, 110, 110, 111, 111, 111, 112,
+	112, 113, 114, 114, 114, 114, 114, 114, 114, 115, 115, 115, 115, 115,
+	115, 116, 116, 117, 117, 117, 117, 117, 117, 118, 118, 118, 119, 119,
+	119, 119, 119, 119, 119, 25, 120, 120, 120, 120, 120, 120, 121, 121,
+	122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 124, 124, 124, 124,
+	124, 124, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 127,
+	127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 129, 129,
+	129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 131, 131, 131,
+	131, 131, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133, 133,
+	134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 136, 137, 137, 137,
+	137, 137, 137, 137, 138, 138, 138, 138, 139, 139, 139, 139, 140, 140,
+	140, 140, 140, 141, 141, 141, 141, 21, 142, 142, 142, 143, 143, 144,
+	144, 145, 146, 146, 146, 147, 147, 148, 148, 148, 149, 149, 149, 149,
+	149, 149, 149, 150, 150, 150, 150, 151, 151, 151, 151, 152, 153, 56,
+	154, 56, 152, 154, 153, 155, 155, 155, 155, 155, 4, 156, 156, 156, 54,
+	157, 157, 157, 157, 157, 158, 158, 159, 159, 159, 159, 160, 160, 160,
+	161, 161, 161, 161, 161, 161, 161, 57
+};
+
+/* runeprop: 40576 bytes */
+static const uint8_t runeprop_idx1[2176] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+	20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 28, 29, 30, 31, 32, 33, 34, 34,
+	34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+	34, 34, 35, 36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+	53, 54, 55, 56, 57, 58, 59, 60, 61, 61, 61, 61, 62, 63, 63, 64, 61,
+	61, 61, 61, 61, 61, 61, 65, 66, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 67, 68, 61, 69, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 71, 70, 72, 73, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 74, 75, 76, 61, 61, 61, 61, 77, 61,
+	61, 61, 61, 61, 61, 61, 61, 78, 79, 80, 81, 82, 83, 84, 61, 85, 86,
+	87, 61, 88, 89, 61, 90, 91, 92, 93, 94, 95, 96, 97, 61, 61, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 98, 26, 26, 26,
+	26, 26, 26, 26, 99, 100, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 101,
+	26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 102, 61, 61, 61,
+	61, 61, 61, 26, 103, 61, 61, 26, 26, 26, 26, 26, 26, 26, 26, 26, 104,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 105, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 106, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 106
+};
+
+static const uint16_t runeprop_idx2[3424] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14, 15, 15, 15, 16,
+	17, 15, 15, 18, 19, 20, 21, 22, 23, 24, 15, 25, 15, 15, 15, 26, 27,
+	13, 13, 13, 13, 28, 13, 29, 30, 31, 32, 33, 34, 34, 34, 34, 35, 34,
+	34, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 45, 45, 46, 46, 46, 47,
+	47, 48, 47, 47, 47, 49, 47, 47, 47, 47, 47, 47, 50, 51, 52, 53, 53,
+	54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 64, 65, 66, 67, 68, 64,
+	64, 64, 64, 64, 69, 70, 71, 72, 73, 74, 75, 76, 64, 64, 64, 77, 77,
+	78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 64, 91, 92, 64,
+	64, 93, 94, 95, 96, 97, 98, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+	107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+	135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+	149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
+	163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+	177, 177, 178, 179, 180, 181, 181, 182, 183, 184, 185, 186, 187, 181,
+	181, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200,
+	201, 181, 181, 202, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+	211, 212, 213, 213, 214, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+	215, 215, 215, 215, 215, 215, 215, 216, 216, 216, 216, 217, 218, 216,
+	216, 217, 216, 216, 219, 220, 221, 216, 216, 216, 220, 216, 216, 216,
+	222, 223, 224, 216, 225, 226, 226, 226, 226, 226, 227, 228, 229, 229,
+	229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+	229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+	229, 229, 229, 229, 229, 229, 229, 230, 229, 231, 232, 233, 233, 233,
+	233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 244, 244,
+	245, 246, 247, 248, 249, 250, 251, 252, 252, 253, 252, 252, 254, 255,
+	252, 256, 229, 229, 229, 229, 257, 258, 259, 260, 261, 262, 263, 264,
+	265, 266, 266, 267, 266, 268, 269, 270, 270, 271, 272, 273, 273, 273,
+	274, 275, 276, 277, 277, 278, 279, 280, 181, 181, 181, 281, 282, 282,
+	283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 292, 293, 294, 295,
+	295, 296, 297, 298, 299, 300, 301, 302, 211, 211, 303, 304, 305, 306,
+	307, 13, 13, 308, 309, 309, 310, 311, 312, 13, 313, 309, 314, 34, 34,
+	315, 316, 15, 15, 15, 15, 15, 15, 15, 15, 15, 317, 15, 15, 15, 15, 15,
+	15, 318, 319, 318, 318, 319, 320, 318, 321, 322, 322, 322, 323, 324,
+	325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338,
+	338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+	352, 353, 354, 355, 356, 354, 357, 358, 358, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 359, 354, 360, 354, 354,
+	354, 354, 361, 354, 362, 358, 363, 354, 364, 365, 354, 354, 354, 366,
+	181, 367, 181, 348, 348, 348, 368, 354, 369, 370, 371, 372, 348, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 373, 374, 354, 354,
+	375, 354, 354, 354, 354, 354, 354, 376, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 377, 378, 348, 379, 354,
+	354, 380, 358, 381, 358, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 382, 382, 358, 358, 358, 358, 358, 358, 358,
+	358, 383, 384, 358, 358, 358, 385, 358, 386, 358, 358, 358, 358, 358,
+	358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 354, 354, 354,
+	358, 387, 354, 354, 388, 354, 389, 354, 354, 354, 354, 354, 354, 390,
+	390, 390, 391, 391, 391, 392, 393, 394, 394, 394, 394, 394, 394, 395,
+	396, 213, 213, 397, 398, 398, 398, 399, 400, 216, 401, 402, 402, 402,
+	402, 403, 403, 404, 405, 406, 407, 408, 409, 181, 181, 410, 411, 410,
+	410, 410, 410, 410, 412, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+	410, 410, 410, 410, 413, 181, 414, 415, 416, 417, 418, 419, 420, 420,
+	420, 420, 421, 422, 423, 423, 423, 423, 424, 425, 426, 426, 427, 215,
+	215, 215, 215, 428, 429, 426, 426, 354, 354, 430, 423, 431, 432, 433,
+	354, 434, 435, 431, 436, 433, 354, 354, 435, 354, 437, 437, 438, 437,
+	437, 437, 437, 437, 439, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 354, 354, 354, 354, 441, 442, 441, 441, 441,
+	441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441,
+	441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441,
+	441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441,
+	441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441,
+	441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 443, 444, 444,
+	444, 445, 446, 446, 447, 448, 448, 448, 448, 448, 448, 448, 448, 448,
+	448, 448, 448, 448, 448, 448, 448, 449, 448, 450, 181, 47, 47, 451,
+	452, 47, 453, 454, 454, 454, 454, 455, 456, 33, 457, 458, 459, 15, 15,
+	15, 460, 461, 462, 463, 464, 465, 466, 181, 467, 468, 469, 470, 471,
+	472, 472, 472, 473, 474, 475, 475, 476, 477, 478, 479, 480, 481, 482,
+	483, 484, 485, 486, 215, 487, 488, 489, 489, 490, 491, 492, 493, 494,
+	495, 495, 496, 497, 498, 499, 202, 500, 501, 501, 501, 502, 503, 504,
+	505, 506, 507, 508, 402, 13, 13, 509, 510, 511, 511, 511, 511, 511,
+	512, 512, 513, 514, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+	215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+	215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+	215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+	215, 215, 215, 215, 215, 215, 515, 215, 516, 215, 215, 517, 518, 518,
+	518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518,
+	518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518, 518,
+	518, 518, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+	519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+	519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+	519, 519, 519, 519, 519, 519, 519, 519, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 520, 440, 440, 440, 440, 440, 440, 521, 181, 181, 522, 523,
+	524, 525, 526, 64, 64, 64, 64, 64, 64, 527, 528, 529, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	530, 531, 64, 64, 64, 64, 532, 64, 64, 533, 181, 181, 534, 34, 535,
+	536, 537, 538, 539, 540, 541, 64, 64, 64, 64, 64, 64, 64, 542, 543, 3,
+	4, 5, 6, 544, 545, 546, 423, 547, 215, 428, 548, 549, 550, 551, 552,
+	553, 554, 555, 556, 556, 181, 181, 553, 553, 553, 553, 553, 553, 553,
+	557, 558, 348, 348, 559, 560, 560, 560, 561, 562, 563, 564, 181, 181,
+	354, 354, 565, 181, 181, 181, 181, 181, 181, 181, 181, 566, 567, 568,
+	568, 568, 569, 570, 571, 572, 572, 573, 574, 575, 576, 576, 577, 578,
+	579, 580, 580, 581, 582, 181, 181, 583, 583, 584, 585, 585, 586, 586,
+	586, 587, 588, 589, 590, 590, 591, 592, 593, 594, 594, 595, 596, 596,
+	596, 597, 598, 598, 599, 600, 601, 181, 181, 181, 181, 602, 602, 602,
+	602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+	602, 602, 603, 602, 604, 605, 181, 606, 309, 309, 607, 181, 181, 181,
+	181, 608, 609, 609, 610, 611, 612, 613, 614, 615, 616, 617, 181, 181,
+	181, 618, 619, 620, 621, 622, 623, 181, 181, 181, 181, 624, 624, 625,
+	626, 627, 628, 627, 627, 629, 630, 631, 632, 633, 634, 635, 636, 637,
+	638, 181, 181, 639, 640, 641, 642, 643, 643, 643, 644, 645, 646, 647,
+	648, 649, 650, 651, 181, 181, 181, 181, 181, 652, 652, 652, 652, 653,
+	181, 181, 181, 654, 654, 654, 655, 656, 656, 656, 657, 658, 658, 659,
+	660, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 661, 662, 663, 663, 664, 665, 181, 181, 181,
+	181, 666, 667, 668, 669, 670, 671, 181, 672, 673, 181, 181, 674, 675,
+	181, 676, 677, 678, 679, 679, 680, 681, 682, 683, 684, 685, 686, 686,
+	687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 697, 698, 699,
+	700, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 181, 181, 181,
+	181, 710, 711, 712, 713, 713, 714, 715, 716, 717, 718, 719, 720, 721,
+	722, 723, 724, 181, 181, 181, 181, 181, 181, 181, 181, 725, 725, 725,
+	726, 727, 728, 729, 181, 730, 730, 730, 731, 732, 733, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 734, 734, 735, 736, 737, 738, 181,
+	181, 739, 739, 739, 740, 741, 742, 743, 181, 744, 744, 745, 746, 747,
+	181, 181, 181, 748, 749, 750, 751, 752, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 753, 753, 754, 755, 181, 181, 181, 181, 181,
+	181, 756, 756, 757, 757, 758, 759, 760, 761, 762, 763, 764, 765, 181,
+	181, 181, 181, 766, 767, 767, 768, 769, 181, 770, 771, 771, 772, 773,
+	774, 775, 775, 776, 777, 778, 229, 779, 779, 779, 780, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 781,
+	782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 181, 181, 181,
+	181, 793, 794, 794, 795, 796, 797, 798, 799, 800, 801, 802, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 803, 804, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 805, 806, 807, 808, 809, 810, 810, 810, 810, 810, 810, 810,
+	810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810,
+	810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810,
+	810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810, 810,
+	810, 810, 810, 810, 810, 810, 810, 810, 811, 181, 181, 181, 181, 181,
+	181, 812, 812, 812, 812, 812, 812, 813, 814, 810, 810, 810, 810, 810,
+	810, 810, 810, 810, 810, 810, 810, 815, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 816, 816, 816, 816, 816, 816, 817, 818,
+	818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818,
+	818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818, 818,
+	818, 818, 818, 818, 818, 819, 820, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 821, 821, 821, 821, 821, 821, 821,
+	821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821,
+	821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821, 821,
+	821, 822, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454,
+	454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454,
+	454, 454, 454, 454, 454, 454, 454, 454, 823, 824, 825, 826, 827, 827,
+	827, 827, 828, 829, 830, 831, 832, 833, 833, 833, 834, 835, 836, 837,
+	838, 833, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 839,
+	839, 840, 840, 841, 842, 181, 181, 181, 181, 181, 181, 843, 843, 843,
+	843, 844, 845, 846, 846, 847, 848, 181, 181, 181, 181, 849, 850, 851,
+	851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+	851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+	851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+	851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+	851, 851, 851, 851, 851, 851, 852, 851, 851, 851, 851, 851, 851, 851,
+	851, 851, 851, 851, 851, 851, 851, 851, 851, 853, 853, 853, 853, 853,
+	853, 853, 853, 853, 853, 853, 853, 853, 853, 853, 853, 853, 853, 853,
+	853, 853, 853, 853, 853, 853, 853, 853, 853, 853, 854, 181, 181, 855,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 856, 857, 420, 420, 420, 420, 420, 420, 420, 420,
+	420, 420, 420, 420, 420, 420, 420, 420, 420, 858, 181, 181, 859, 860,
+	861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 861,
+	861, 861, 861, 861, 861, 861, 861, 861, 861, 861, 862, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 863,
+	863, 863, 863, 863, 863, 864, 865, 866, 867, 868, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 34, 34, 869, 34, 870, 354, 354, 354, 354,
+	354, 354, 354, 430, 181, 181, 181, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 871, 354, 354, 872, 354, 354,
+	354, 873, 874, 875, 354, 876, 354, 354, 354, 367, 181, 877, 877, 877,
+	877, 878, 181, 181, 181, 181, 181, 181, 181, 181, 181, 348, 879, 354,
+	354, 354, 354, 354, 366, 348, 880, 181, 181, 181, 181, 181, 181, 181,
+	181, 881, 882, 883, 884, 885, 886, 887, 881, 888, 889, 890, 891, 892,
+	881, 882, 883, 893, 894, 883, 895, 896, 897, 898, 881, 899, 883, 881,
+	882, 883, 884, 885, 883, 887, 881, 888, 898, 881, 899, 883, 881, 882,
+	883, 900, 881, 901, 902, 903, 904, 883, 905, 881, 906, 907, 908, 909,
+	883, 910, 881, 911, 883, 912, 913, 913, 913, 914, 914, 914, 914, 914,
+	914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914,
+	914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 915,
+	915, 915, 916, 915, 915, 917, 918, 919, 920, 921, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 922, 923, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 924, 925, 926, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 927, 927, 928, 929, 930,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 931, 932, 181, 933, 933, 934, 935, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 936, 937, 938, 938, 938, 938, 938, 938, 938, 938, 938,
+	938, 938, 938, 939, 940, 181, 181, 941, 941, 942, 943, 944, 945, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 946, 348, 348, 947, 948, 181, 181, 181, 181, 946, 348, 949,
+	950, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 951,
+	64, 952, 953, 954, 955, 956, 957, 958, 959, 960, 959, 181, 181, 181,
+	961, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 354, 354, 414, 354, 354, 354, 354, 354, 354, 430, 962,
+	963, 963, 963, 354, 871, 964, 354, 354, 370, 965, 370, 965, 370, 965,
+	354, 966, 181, 181, 181, 967, 354, 968, 354, 354, 414, 969, 970, 871,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 971, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	972, 563, 563, 354, 354, 354, 354, 354, 354, 354, 430, 354, 354, 354,
+	354, 354, 969, 414, 973, 414, 354, 354, 354, 974, 975, 354, 354, 974,
+	354, 966, 970, 181, 181, 181, 181, 354, 354, 354, 354, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+	430, 966, 976, 366, 354, 563, 367, 871, 975, 974, 366, 354, 354, 354,
+	354, 354, 354, 354, 354, 354, 977, 354, 354, 367, 181, 181, 978, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 181,
+	181, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 979, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 520, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 980, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 440, 440, 981, 181, 440, 520, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 440, 440, 440, 440, 440,
+	440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440,
+	440, 982, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 983,
+	181, 984, 984, 984, 984, 984, 984, 181, 181, 181, 181, 181, 181, 181,
+	181, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 181,
+	519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+	519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 519,
+	519, 519, 519, 985
+};
+
+static const uint16_t runeprop_blk[15776] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7, 3, 8,
+	3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 7, 7, 7, 3, 3, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 5, 3, 6, 11, 12, 11, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 5, 7, 6, 7, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2, 3, 4, 4, 4, 4, 14, 3, 11, 14, 15, 16, 7, 17, 14, 11, 14, 7,
+	18, 18, 11, 19, 3, 3, 11, 18, 15, 20, 18, 18, 18, 3, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 7, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 7, 13,
+	13, 13, 13, 13, 13, 13, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13,
+	10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 10, 13,
+	10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 10, 13,
+	10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 10, 13, 10, 13,
+	10, 13, 13, 13, 10, 10, 13, 10, 13, 10, 10, 13, 10, 10, 10, 13, 13,
+	10, 10, 10, 10, 13, 10, 10, 13, 10, 10, 10, 13, 13, 13, 10, 10, 13,
+	10, 10, 13, 10, 13, 10, 13, 10, 10, 13, 10, 13, 13, 10, 13, 10, 10,
+	13, 10, 10, 10, 13, 10, 13, 10, 10, 13, 13, 21, 10, 13, 13, 13, 21,
+	21, 21, 21, 10, 22, 13, 10, 22, 13, 10, 22, 13, 10, 13, 10, 13, 10,
+	13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 10, 13, 13, 10, 22,
+	13, 10, 13, 10, 10, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13,
+	13, 13, 13, 13, 13, 13, 10, 10, 13, 10, 10, 13, 13, 10, 13, 10, 10,
+	10, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 13, 13, 13, 21, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 24, 24, 24, 24, 24, 24, 24, 25, 25, 11, 11, 11, 11, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 23, 23, 23, 23, 23, 11, 11, 11, 11, 11,
+	26, 26, 24, 11, 24, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 29, 30, 29, 30, 24, 31, 29, 30, 32, 32, 33, 30, 30, 30, 3,
+	29, 32, 32, 32, 32, 31, 11, 29, 3, 29, 29, 29, 32, 29, 32, 29, 29, 30,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	32, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30,
+	30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+	30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 29, 30, 30, 29, 29, 29,
+	30, 30, 30, 29, 30, 29, 30, 29, 30, 29, 30, 29, 30, 34, 35, 34, 35,
+	34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 30, 30, 30, 30, 29, 30, 36,
+	29, 30, 29, 29, 30, 30, 29, 29, 29, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+	38, 38, 38, 38, 38, 38, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38,
+	37, 38, 37, 38, 37, 38, 37, 38, 39, 40, 40, 27, 27, 40, 41, 41, 37,
+	38, 37, 38, 37, 38, 37, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37,
+	38, 37, 38, 38, 32, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 32, 32, 43, 44, 44, 44, 44, 44,
+	44, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+	45, 45, 45, 45, 45, 45, 45, 45, 45, 44, 46, 32, 32, 47, 47, 48, 32,
+	49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+	49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 51, 50, 52, 50, 50, 52,
+	50, 50, 52, 50, 32, 32, 32, 32, 32, 32, 32, 32, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 32, 32, 32, 32, 53, 53, 53, 53, 52, 52, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 54, 54, 54, 54, 54, 17, 55, 55,
+	55, 56, 56, 57, 3, 56, 58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+	59, 3, 54, 56, 56, 3, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+	60, 60, 60, 60, 24, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 61, 61,
+	61, 61, 61, 61, 61, 61, 61, 61, 61, 59, 59, 62, 59, 59, 59, 59, 59,
+	59, 59, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 56, 56, 56, 56, 60,
+	60, 61, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+	60, 60, 60, 60, 56, 60, 59, 59, 59, 59, 59, 59, 59, 17, 58, 62, 62,
+	59, 59, 59, 59, 64, 64, 59, 59, 58, 62, 62, 62, 59, 60, 60, 63, 63,
+	63, 63, 63, 63, 63, 63, 63, 63, 60, 60, 60, 58, 58, 60, 65, 65, 65,
+	65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 32, 66, 67, 68, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 68, 68, 68, 68, 68, 68,
+	68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 69, 69, 69, 69, 69, 69, 69,
+	69, 69, 69, 69, 32, 32, 67, 67, 67, 70, 70, 70, 70, 70, 70, 70, 70,
+	70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71, 71,
+	71, 71, 71, 71, 71, 71, 71, 71, 70, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+	73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 74, 74,
+	74, 74, 74, 74, 74, 74, 74, 75, 75, 76, 77, 77, 77, 75, 32, 32, 74,
+	78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+	79, 79, 79, 79, 79, 79, 79, 80, 80, 81, 81, 82, 80, 80, 80, 80, 80,
+	80, 80, 80, 80, 82, 80, 80, 80, 82, 80, 80, 80, 80, 81, 32, 32, 83,
+	83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 32, 84, 84,
+	84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+	84, 84, 84, 84, 84, 84, 85, 85, 85, 32, 32, 86, 32, 67, 67, 67, 67,
+	67, 67, 67, 67, 67, 67, 67, 32, 32, 32, 32, 32, 60, 60, 60, 60, 60,
+	60, 60, 60, 87, 60, 60, 60, 60, 60, 60, 32, 54, 54, 32, 32, 32, 32,
+	32, 32, 62, 62, 62, 62, 62, 62, 62, 62, 60, 60, 60, 60, 60, 60, 60,
+	60, 60, 64, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 59, 59, 59, 59,
+	59, 59, 59, 59, 59, 59, 59, 59, 62, 62, 17, 59, 59, 59, 59, 59, 59,
+	59, 62, 62, 62, 62, 62, 62, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+	59, 59, 59, 59, 59, 59, 88, 88, 88, 89, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 88, 89, 91,
+	90, 89, 89, 89, 88, 88, 88, 88, 88, 88, 88, 88, 89, 89, 89, 89, 91,
+	89, 89, 90, 27, 27, 27, 27, 88, 88, 88, 90, 90, 90, 90, 90, 90, 90,
+	90, 90, 90, 88, 88, 3, 3, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 93,
+	94, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 95, 96,
+	97, 97, 32, 95, 95, 95, 95, 95, 95, 95, 95, 32, 32, 95, 95, 32, 32,
+	95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+	95, 95, 95, 95, 95, 32, 95, 95, 95, 95, 95, 95, 95, 32, 95, 32, 32,
+	32, 95, 95, 95, 95, 32, 32, 98, 95, 97, 97, 97, 96, 96, 96, 96, 32,
+	32, 97, 97, 32, 32, 97, 97, 98, 95, 32, 32, 32, 32, 32, 32, 32, 32,
+	97, 32, 32, 32, 32, 95, 95, 32, 95, 95, 95, 96, 96, 32, 32, 99, 99,
+	99, 99, 99, 99, 99, 99, 99, 99, 95, 95, 100, 100, 101, 101, 101, 101,
+	101, 101, 102, 100, 95, 103, 98, 32, 32, 104, 104, 105, 32, 106, 106,
+	106, 106, 106, 106, 32, 32, 32, 32, 106, 106, 32, 32, 106, 106, 106,
+	106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 106, 106, 106, 106, 32, 106, 106, 106, 106, 106, 106, 106, 32,
+	106, 106, 32, 106, 106, 32, 106, 106, 32, 32, 107, 32, 105, 105, 105,
+	104, 104, 32, 32, 32, 32, 104, 104, 32, 32, 104, 104, 107, 32, 32, 32,
+	104, 32, 32, 32, 32, 32, 32, 32, 106, 106, 106, 106, 32, 106, 32, 32,
+	32, 32, 32, 32, 32, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	104, 104, 106, 106, 106, 104, 109, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 110, 110, 111, 32, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	32, 112, 112, 112, 32, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 32,
+	112, 112, 112, 112, 112, 112, 112, 32, 112, 112, 32, 112, 112, 112,
+	112, 112, 32, 32, 113, 112, 111, 111, 111, 110, 110, 110, 110, 110,
+	32, 110, 110, 111, 32, 111, 111, 113, 32, 32, 112, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 112, 110, 110, 32, 32,
+	114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 115, 116, 32, 32,
+	32, 32, 32, 32, 32, 112, 110, 110, 110, 113, 113, 113, 32, 117, 118,
+	118, 32, 119, 119, 119, 119, 119, 119, 119, 119, 32, 32, 119, 119, 32,
+	32, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+	119, 119, 119, 119, 119, 119, 119, 119, 119, 32, 119, 119, 119, 119,
+	119, 119, 119, 32, 119, 119, 32, 119, 119, 119, 119, 119, 32, 32, 120,
+	119, 118, 117, 118, 117, 117, 117, 117, 32, 32, 118, 118, 32, 32, 118,
+	118, 120, 32, 32, 32, 32, 32, 32, 32, 120, 117, 118, 32, 32, 32, 32,
+	119, 119, 32, 119, 119, 119, 117, 117, 32, 32, 121, 121, 121, 121,
+	121, 121, 121, 121, 121, 121, 122, 119, 123, 123, 123, 123, 123, 123,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 124, 125, 32, 125, 125, 125,
+	125, 125, 125, 32, 32, 32, 125, 125, 125, 32, 125, 125, 125, 125, 32,
+	32, 32, 125, 125, 32, 125, 32, 125, 125, 32, 32, 32, 125, 125, 32, 32,
+	32, 125, 125, 125, 32, 32, 32, 125, 125, 125, 125, 125, 125, 125, 125,
+	125, 125, 125, 125, 32, 32, 32, 32, 126, 126, 124, 126, 126, 32, 32,
+	32, 126, 126, 126, 32, 126, 126, 126, 127, 32, 32, 125, 32, 32, 32,
+	32, 32, 32, 126, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129,
+	130, 130, 130, 130, 130, 130, 131, 130, 32, 32, 32, 32, 32, 132, 133,
+	133, 133, 134, 135, 135, 135, 135, 135, 135, 135, 135, 32, 135, 135,
+	135, 32, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+	135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 32, 135, 135,
+	135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+	32, 32, 134, 135, 132, 132, 132, 133, 133, 133, 133, 32, 132, 132,
+	132, 32, 132, 132, 132, 134, 32, 32, 32, 32, 32, 32, 32, 132, 132, 32,
+	135, 135, 135, 32, 32, 135, 32, 32, 135, 135, 132, 132, 32, 32, 136,
+	136, 136, 136, 136, 136, 136, 136, 136, 136, 32, 32, 32, 32, 32, 32,
+	32, 137, 138, 138, 138, 138, 138, 138, 138, 139, 140, 141, 142, 142,
+	143, 140, 140, 140, 140, 140, 140, 140, 140, 32, 140, 140, 140, 32,
+	140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+	140, 140, 140, 140, 140, 140, 140, 140, 140, 32, 140, 140, 140, 140,
+	140, 140, 140, 140, 140, 140, 32, 140, 140, 140, 140, 140, 32, 32,
+	144, 140, 142, 141, 142, 142, 142, 142, 142, 32, 141, 142, 142, 32,
+	142, 142, 141, 144, 32, 32, 32, 32, 32, 32, 32, 142, 142, 32, 32, 32,
+	32, 32, 32, 140, 140, 32, 140, 140, 141, 141, 32, 32, 145, 145, 145,
+	145, 145, 145, 145, 145, 145, 145, 32, 140, 140, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 146, 146, 147, 147, 148, 148, 148,
+	148, 148, 148, 148, 148, 148, 32, 148, 148, 148, 32, 148, 148, 148,
+	148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+	148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+	148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 149, 149, 148, 147,
+	147, 147, 146, 146, 146, 146, 32, 147, 147, 147, 32, 147, 147, 147,
+	149, 148, 150, 32, 32, 32, 32, 148, 148, 148, 147, 151, 151, 151, 151,
+	151, 151, 151, 148, 148, 148, 146, 146, 32, 32, 152, 152, 152, 152,
+	152, 152, 152, 152, 152, 152, 151, 151, 151, 151, 151, 151, 151, 151,
+	151, 150, 148, 148, 148, 148, 148, 148, 32, 153, 154, 154, 32, 155,
+	155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+	155, 155, 155, 32, 32, 32, 155, 155, 155, 155, 155, 155, 155, 155,
+	155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+	155, 155, 32, 155, 155, 155, 155, 155, 155, 155, 155, 155, 32, 155,
+	32, 32, 155, 155, 155, 155, 155, 155, 155, 32, 32, 32, 156, 32, 32,
+	32, 32, 154, 154, 154, 153, 153, 153, 32, 153, 32, 154, 154, 154, 154,
+	154, 154, 154, 154, 32, 32, 32, 32, 32, 32, 157, 157, 157, 157, 157,
+	157, 157, 157, 157, 157, 32, 32, 154, 154, 158, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 159, 159, 159, 159, 159, 159, 159, 159,
+	159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+	159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 160, 159, 159, 160,
+	160, 160, 160, 160, 160, 160, 32, 32, 32, 32, 4, 159, 159, 159, 159,
+	159, 159, 161, 162, 162, 162, 162, 162, 162, 160, 162, 163, 164, 164,
+	164, 164, 164, 164, 164, 164, 164, 164, 163, 163, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 165,
+	165, 32, 165, 32, 165, 165, 165, 165, 165, 32, 165, 165, 165, 165,
+	165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+	165, 165, 165, 165, 165, 165, 32, 165, 32, 165, 165, 165, 165, 165,
+	165, 165, 165, 165, 165, 166, 165, 165, 166, 166, 166, 166, 166, 166,
+	167, 166, 166, 165, 32, 32, 165, 165, 165, 165, 165, 32, 168, 32, 167,
+	167, 167, 167, 167, 166, 32, 32, 169, 169, 169, 169, 169, 169, 169,
+	169, 169, 169, 32, 32, 165, 165, 165, 165, 170, 171, 171, 171, 172,
+	172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+	171, 172, 171, 171, 171, 173, 173, 171, 171, 171, 171, 171, 171, 174,
+	174, 174, 174, 174, 174, 174, 174, 174, 174, 175, 175, 175, 175, 175,
+	175, 175, 175, 175, 175, 171, 173, 171, 173, 171, 173, 176, 177, 176,
+	177, 178, 178, 170, 170, 170, 170, 170, 170, 170, 170, 32, 170, 170,
+	170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	170, 170, 170, 170, 170, 170, 32, 32, 32, 32, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 180, 179, 179, 173, 173,
+	173, 172, 173, 173, 170, 170, 170, 170, 170, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 32, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+	179, 32, 171, 171, 171, 171, 171, 171, 171, 171, 173, 171, 171, 171,
+	171, 171, 171, 32, 171, 171, 172, 172, 172, 172, 172, 14, 14, 14, 14,
+	172, 172, 32, 32, 32, 32, 32, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 182, 182, 183, 183, 183, 183, 182, 183, 183,
+	183, 183, 183, 184, 182, 184, 184, 182, 182, 183, 183, 181, 185, 185,
+	185, 185, 185, 185, 185, 185, 185, 185, 186, 186, 186, 186, 186, 186,
+	181, 181, 181, 181, 181, 181, 182, 182, 183, 183, 181, 181, 181, 181,
+	183, 183, 183, 181, 182, 182, 182, 181, 181, 182, 182, 182, 182, 182,
+	182, 182, 181, 181, 181, 183, 183, 183, 183, 181, 181, 181, 181, 181,
+	181, 181, 181, 181, 181, 181, 181, 181, 183, 182, 182, 183, 183, 182,
+	182, 182, 182, 182, 182, 183, 181, 182, 185, 185, 185, 185, 185, 185,
+	185, 185, 185, 185, 182, 182, 182, 183, 187, 187, 188, 188, 188, 188,
+	188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+	188, 188, 188, 188, 32, 188, 32, 32, 32, 32, 32, 188, 32, 32, 189,
+	189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+	189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 3, 190,
+	189, 189, 189, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+	191, 191, 191, 191, 191, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+	192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+	192, 192, 32, 192, 192, 192, 192, 32, 32, 192, 192, 192, 192, 192,
+	192, 192, 32, 192, 32, 192, 192, 192, 192, 32, 32, 192, 32, 192, 192,
+	192, 192, 32, 32, 192, 192, 192, 192, 192, 192, 192, 32, 192, 32, 192,
+	192, 192, 192, 32, 32, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+	192, 192, 192, 192, 192, 192, 32, 192, 192, 192, 192, 192, 192, 192,
+	192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 32, 32,
+	193, 193, 193, 194, 194, 194, 194, 194, 194, 194, 194, 194, 195, 195,
+	195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+	195, 195, 195, 195, 32, 32, 32, 196, 196, 196, 196, 196, 196, 196,
+	196, 196, 196, 32, 32, 32, 32, 32, 32, 197, 197, 197, 197, 197, 197,
+	197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197, 197,
+	197, 197, 32, 32, 198, 198, 198, 198, 198, 198, 32, 32, 199, 200, 200,
+	200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+	200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+	200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+	201, 202, 200, 203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+	204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+	204, 204, 205, 206, 32, 32, 32, 207, 207, 207, 207, 207, 207, 207,
+	207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207, 207,
+	207, 207, 207, 207, 207, 207, 3, 3, 3, 208, 208, 208, 207, 207, 207,
+	207, 207, 207, 207, 207, 32, 32, 32, 32, 32, 32, 32, 209, 209, 209,
+	209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+	209, 210, 210, 211, 212, 32, 32, 32, 32, 32, 32, 32, 32, 32, 209, 213,
+	213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+	213, 213, 213, 214, 214, 215, 3, 3, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+	216, 216, 216, 216, 216, 217, 217, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+	218, 218, 32, 218, 218, 218, 32, 219, 219, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 221, 221, 222, 223,
+	223, 223, 223, 223, 223, 223, 222, 222, 222, 222, 222, 222, 222, 222,
+	223, 222, 222, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+	224, 224, 224, 225, 224, 224, 224, 226, 220, 221, 32, 32, 227, 227,
+	227, 227, 227, 227, 227, 227, 227, 227, 32, 32, 32, 32, 32, 32, 228,
+	228, 228, 228, 228, 228, 228, 228, 228, 228, 32, 32, 32, 32, 32, 32,
+	229, 229, 3, 3, 229, 3, 230, 229, 229, 229, 229, 231, 231, 231, 232,
+	231, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 32, 32, 32, 32,
+	32, 32, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 235, 234, 234, 234, 234, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+	234, 32, 32, 32, 32, 32, 32, 32, 234, 234, 234, 234, 234, 236, 236,
+	234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+	234, 234, 234, 234, 236, 234, 32, 32, 32, 32, 32, 200, 200, 200, 200,
+	200, 200, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 237, 237, 237, 237,
+	237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+	237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 32,
+	238, 238, 238, 239, 239, 239, 239, 238, 238, 239, 239, 239, 32, 32,
+	32, 32, 239, 239, 238, 239, 239, 239, 239, 239, 239, 240, 240, 240,
+	32, 32, 32, 32, 241, 32, 32, 32, 242, 242, 243, 243, 243, 243, 243,
+	243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+	244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+	244, 244, 244, 244, 244, 244, 244, 32, 32, 244, 244, 244, 244, 244,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 245, 245, 245, 245, 245,
+	245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+	245, 245, 245, 245, 245, 245, 245, 245, 245, 32, 32, 32, 32, 245, 245,
+	245, 245, 245, 245, 245, 245, 245, 245, 32, 32, 32, 32, 32, 32, 246,
+	246, 246, 246, 246, 246, 246, 246, 246, 246, 247, 32, 32, 32, 248,
+	248, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+	249, 249, 249, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250,
+	250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 251, 251,
+	252, 252, 251, 32, 32, 253, 253, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	255, 256, 255, 256, 256, 256, 256, 256, 256, 256, 32, 257, 255, 256,
+	255, 255, 256, 256, 256, 256, 256, 256, 256, 256, 255, 255, 255, 255,
+	255, 255, 256, 256, 257, 257, 257, 257, 257, 257, 257, 257, 32, 32,
+	257, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 32, 32, 32, 32,
+	32, 32, 259, 259, 259, 259, 259, 259, 259, 260, 259, 259, 259, 259,
+	259, 259, 32, 32, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 261, 61, 61, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 61, 61,
+	61, 32, 262, 262, 262, 262, 263, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264,
+	264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 265, 263, 262, 262,
+	262, 262, 262, 263, 262, 263, 263, 263, 263, 263, 262, 263, 266, 264,
+	264, 264, 264, 264, 264, 264, 264, 32, 32, 32, 267, 267, 267, 267,
+	267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 269,
+	269, 269, 269, 269, 269, 269, 269, 269, 269, 265, 265, 265, 265, 265,
+	265, 265, 265, 265, 269, 269, 269, 269, 269, 269, 269, 269, 269, 268,
+	268, 32, 270, 270, 271, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+	272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+	272, 272, 272, 272, 272, 272, 272, 271, 270, 270, 270, 270, 271, 271,
+	270, 270, 273, 274, 270, 270, 272, 272, 275, 275, 275, 275, 275, 275,
+	275, 275, 275, 275, 272, 272, 272, 272, 272, 272, 276, 276, 276, 276,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+	276, 276, 276, 276, 277, 278, 279, 279, 278, 278, 278, 279, 278, 279,
+	279, 279, 280, 280, 32, 32, 32, 32, 32, 32, 32, 32, 281, 281, 281,
+	281, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+	282, 282, 282, 282, 282, 282, 282, 283, 283, 283, 283, 283, 283, 283,
+	283, 284, 284, 284, 284, 284, 284, 284, 284, 283, 283, 284, 285, 32,
+	32, 32, 286, 286, 286, 286, 286, 287, 287, 287, 287, 287, 287, 287,
+	287, 287, 287, 32, 32, 32, 282, 282, 282, 288, 288, 288, 288, 288,
+	288, 288, 288, 288, 288, 289, 289, 289, 289, 289, 289, 289, 289, 289,
+	289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289,
+	289, 289, 289, 289, 289, 289, 289, 290, 290, 290, 290, 290, 290, 291,
+	291, 38, 38, 38, 38, 38, 38, 38, 38, 38, 32, 32, 32, 32, 32, 32, 32,
+	188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 32, 32, 188,
+	188, 188, 292, 292, 292, 292, 292, 292, 292, 292, 32, 32, 32, 32, 32,
+	32, 32, 32, 27, 27, 27, 3, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 293, 27, 27, 27, 27, 27, 27, 27, 294, 294, 294, 294, 27, 294,
+	294, 294, 294, 294, 294, 27, 294, 294, 293, 27, 27, 294, 32, 32, 32,
+	32, 32, 13, 13, 13, 13, 13, 13, 30, 30, 30, 30, 30, 38, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 33, 33, 33, 33,
+	33, 23, 23, 23, 23, 33, 33, 33, 33, 33, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 295, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 33, 27, 27, 27, 27, 27,
+	27, 27, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 10, 13, 10, 13, 10, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 10, 13, 30, 30, 30, 30, 30, 30, 30, 30,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 32, 32, 29,
+	29, 29, 29, 29, 29, 32, 32, 30, 30, 30, 30, 30, 30, 30, 30, 32, 29,
+	32, 29, 32, 29, 32, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+	30, 30, 30, 32, 32, 30, 30, 30, 30, 30, 30, 30, 30, 296, 296, 296,
+	296, 296, 296, 296, 296, 30, 30, 30, 30, 30, 32, 30, 30, 29, 29, 29,
+	29, 296, 31, 30, 31, 31, 31, 30, 30, 30, 32, 30, 30, 29, 29, 29, 29,
+	296, 31, 31, 31, 30, 30, 30, 30, 32, 32, 30, 30, 29, 29, 29, 29, 32,
+	31, 31, 31, 30, 30, 30, 30, 30, 30, 30, 30, 29, 29, 29, 29, 29, 31,
+	31, 31, 32, 32, 30, 30, 30, 32, 30, 30, 29, 29, 29, 29, 296, 31, 31,
+	32, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17, 297, 297, 17, 17, 8, 8, 8, 8,
+	8, 8, 3, 3, 16, 20, 5, 16, 16, 20, 5, 16, 3, 3, 3, 3, 3, 3, 3, 3, 298,
+	299, 17, 17, 17, 17, 17, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 16, 20, 3, 3,
+	3, 3, 12, 12, 3, 3, 3, 7, 5, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 7, 3,
+	12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 17, 17, 17, 17, 17, 32, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 18, 23, 32, 32, 18, 18, 18, 18, 18,
+	18, 7, 7, 7, 5, 6, 23, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 7, 7,
+	7, 5, 6, 32, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 32,
+	32, 32, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 261, 261, 261, 261, 27, 261, 261, 261,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 14, 14, 300, 14, 14, 14, 14,
+	300, 14, 14, 19, 300, 300, 300, 19, 19, 300, 300, 300, 19, 14, 300,
+	14, 14, 7, 300, 300, 300, 300, 300, 14, 14, 14, 14, 14, 14, 300, 14,
+	29, 14, 300, 14, 10, 10, 300, 300, 14, 19, 300, 300, 10, 300, 19, 294,
+	294, 294, 294, 19, 14, 14, 19, 19, 300, 300, 7, 7, 7, 7, 7, 300, 19,
+	19, 19, 19, 14, 7, 14, 14, 13, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 301, 301, 301, 301, 301, 301, 301, 301,
+	301, 301, 301, 301, 301, 301, 301, 301, 302, 302, 302, 302, 302, 302,
+	302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 303, 303, 303, 10,
+	13, 303, 303, 303, 303, 18, 14, 14, 32, 32, 32, 32, 7, 7, 7, 7, 7, 14,
+	14, 14, 14, 14, 7, 7, 14, 14, 14, 14, 7, 14, 14, 7, 14, 14, 7, 14, 14,
+	14, 14, 14, 14, 14, 7, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 7, 7, 14, 14, 7, 14, 7, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 14, 14, 14, 14, 14, 14, 14, 14,
+	5, 6, 5, 6, 14, 14, 14, 14, 7, 7, 14, 14, 14, 14, 14, 14, 14, 5, 6,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 7,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 7, 7, 7, 7, 7, 7, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 32, 32, 32, 32, 32, 32, 32, 32, 32, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 32, 32, 32, 32, 32, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 304, 304, 304,
+	304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304,
+	304, 304, 304, 304, 304, 304, 304, 304, 304, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 18, 18, 18, 18, 18, 18, 14, 14, 14,
+	14, 14, 14, 14, 7, 14, 14, 14, 14, 14, 14, 14, 14, 14, 7, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 7, 7, 7, 7, 7, 7, 7, 7, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 7, 14, 14, 14, 14, 14, 14, 14, 14, 5, 6, 5, 6,
+	5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 7, 7,
+	7, 7, 7, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 6, 5,
+	6, 5, 6, 5, 6, 5, 6, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+	306, 306, 306, 306, 306, 306, 7, 7, 7, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+	5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 5, 6, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 5, 6, 7, 7, 7, 7, 7, 7, 7, 14, 14, 7, 7, 7, 7, 7, 7, 14, 14, 14,
+	14, 14, 14, 14, 32, 32, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 32, 14, 14, 14, 14, 14, 14, 14, 14, 14, 307, 307,
+	307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307,
+	308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+	308, 308, 10, 13, 10, 10, 10, 13, 13, 10, 13, 10, 13, 10, 13, 10, 10,
+	10, 10, 13, 10, 13, 13, 10, 13, 13, 13, 13, 13, 13, 23, 23, 10, 10,
+	34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 34,
+	35, 34, 35, 35, 309, 309, 309, 309, 309, 309, 34, 35, 34, 35, 310,
+	310, 310, 34, 35, 32, 32, 32, 32, 32, 311, 311, 311, 311, 312, 311,
+	311, 189, 189, 189, 189, 189, 189, 32, 189, 32, 32, 32, 32, 32, 189,
+	32, 32, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313,
+	313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 32, 32,
+	32, 32, 32, 32, 32, 314, 315, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 316, 192, 192, 192, 192, 192, 192, 192, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 192, 192, 192, 192, 192, 192, 192, 32, 192,
+	192, 192, 192, 192, 192, 192, 32, 317, 317, 317, 317, 317, 317, 317,
+	317, 317, 317, 317, 317, 317, 317, 317, 317, 3, 3, 16, 20, 16, 20, 3,
+	3, 3, 16, 20, 3, 16, 20, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 8, 3, 16,
+	20, 3, 3, 16, 20, 5, 6, 5, 6, 5, 6, 5, 6, 3, 3, 3, 3, 3, 24, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 8, 8, 3, 3, 3, 3, 8, 3, 5, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 14, 14, 3, 3, 3, 5, 6, 5, 6, 5, 6, 5, 6, 8, 32, 32,
+	318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318,
+	318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 32, 318,
+	318, 318, 318, 318, 318, 318, 318, 318, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 318, 318, 318, 318, 318, 318, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	32, 32, 32, 32, 2, 3, 3, 3, 14, 319, 294, 320, 5, 6, 5, 6, 5, 6, 5, 6,
+	5, 6, 14, 14, 5, 6, 5, 6, 5, 6, 5, 6, 8, 5, 6, 6, 14, 320, 320, 320,
+	320, 320, 320, 320, 320, 320, 27, 27, 27, 27, 321, 321, 8, 24, 24, 24,
+	24, 24, 14, 14, 320, 320, 320, 319, 294, 3, 14, 14, 32, 322, 322, 322,
+	322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+	322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+	322, 322, 322, 322, 322, 322, 322, 32, 32, 27, 27, 11, 11, 323, 323,
+	322, 8, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324,
+	324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324,
+	324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324,
+	324, 324, 3, 24, 325, 325, 324, 32, 32, 32, 32, 32, 326, 326, 326,
+	326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+	326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 32, 191, 191, 191,
+	191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+	191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 32,
+	14, 14, 18, 18, 18, 18, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 327, 327,
+	327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327,
+	327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327,
+	327, 32, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 18, 18, 18, 18, 18, 18, 18, 18,
+	14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 327,
+	327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327,
+	14, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+	328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328,
+	328, 328, 328, 328, 14, 328, 328, 328, 328, 328, 328, 328, 328, 14,
+	14, 14, 14, 14, 14, 14, 14, 329, 329, 329, 329, 329, 329, 329, 329,
+	329, 329, 329, 329, 329, 329, 329, 329, 330, 330, 330, 330, 330, 330,
+	330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+	330, 331, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330,
+	330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 330, 32, 32, 32,
+	332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+	332, 332, 332, 332, 332, 332, 332, 332, 332, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+	333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 334,
+	334, 334, 334, 334, 334, 335, 335, 336, 336, 336, 336, 336, 336, 336,
+	336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+	336, 336, 336, 336, 336, 336, 336, 337, 338, 338, 338, 339, 339, 339,
+	339, 339, 339, 339, 339, 339, 339, 336, 336, 32, 32, 32, 32, 37, 38,
+	37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 340, 40, 41, 41, 41,
+	341, 317, 317, 317, 317, 317, 317, 317, 317, 40, 40, 341, 342, 37, 38,
+	37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 295, 295, 317, 317, 343, 343,
+	343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+	343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	344, 344, 345, 345, 346, 346, 346, 346, 346, 346, 32, 32, 32, 32, 32,
+	32, 32, 32, 11, 11, 11, 11, 11, 11, 11, 24, 24, 24, 24, 24, 24, 24,
+	24, 24, 11, 11, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10,
+	13, 13, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13,
+	23, 13, 13, 13, 13, 13, 13, 13, 13, 10, 13, 10, 13, 10, 10, 13, 10,
+	13, 10, 13, 10, 13, 10, 13, 24, 11, 11, 10, 13, 10, 13, 21, 10, 13,
+	10, 13, 13, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10,
+	13, 10, 13, 10, 13, 10, 13, 10, 10, 10, 10, 10, 13, 10, 10, 10, 10,
+	10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10,
+	10, 10, 10, 13, 10, 13, 32, 32, 32, 32, 32, 10, 13, 32, 13, 32, 13,
+	10, 13, 10, 13, 32, 32, 32, 32, 32, 32, 32, 32, 347, 347, 347, 10, 13,
+	21, 23, 23, 13, 21, 21, 21, 21, 21, 348, 348, 349, 348, 348, 348, 350,
+	348, 348, 348, 348, 349, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+	348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348, 348,
+	351, 351, 349, 349, 351, 352, 352, 352, 352, 350, 32, 32, 32, 18, 18,
+	18, 18, 18, 18, 14, 14, 4, 14, 32, 32, 32, 32, 32, 32, 353, 353, 353,
+	353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353,
+	353, 353, 353, 354, 354, 354, 354, 32, 32, 32, 32, 32, 32, 32, 32,
+	355, 355, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+	356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356, 356,
+	356, 356, 356, 356, 356, 356, 356, 356, 355, 355, 355, 355, 355, 355,
+	355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 357, 358, 32, 32,
+	32, 32, 32, 32, 32, 32, 359, 359, 360, 360, 360, 360, 360, 360, 360,
+	360, 360, 360, 32, 32, 32, 32, 32, 32, 91, 91, 91, 91, 91, 91, 91, 91,
+	91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 90, 90, 90, 90, 90, 90, 93,
+	93, 93, 90, 93, 90, 90, 88, 361, 361, 361, 361, 361, 361, 361, 361,
+	361, 361, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362,
+	362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362, 362,
+	362, 362, 363, 363, 363, 363, 363, 364, 364, 364, 3, 365, 366, 366,
+	366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366, 366,
+	366, 366, 366, 366, 366, 366, 366, 367, 367, 367, 367, 367, 367, 367,
+	367, 367, 367, 367, 368, 369, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 370, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+	191, 32, 32, 32, 371, 371, 371, 372, 373, 373, 373, 373, 373, 373,
+	373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373,
+	373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 373, 374, 372, 372,
+	371, 371, 371, 371, 372, 372, 371, 371, 372, 372, 375, 376, 376, 376,
+	376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 32, 24, 377, 377,
+	377, 377, 377, 377, 377, 377, 377, 377, 32, 32, 32, 32, 376, 376, 181,
+	181, 181, 181, 181, 183, 378, 181, 181, 181, 181, 181, 181, 181, 181,
+	181, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 181, 181, 181,
+	181, 181, 32, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379,
+	379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379,
+	380, 380, 380, 380, 380, 380, 381, 381, 380, 380, 381, 381, 380, 380,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 379, 379, 379, 380, 379, 379, 379,
+	379, 379, 379, 379, 379, 380, 381, 32, 32, 382, 382, 382, 382, 382,
+	382, 382, 382, 382, 382, 32, 32, 383, 383, 383, 383, 378, 181, 181,
+	181, 181, 181, 181, 187, 187, 187, 181, 182, 183, 182, 181, 181, 384,
+	384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384,
+	384, 385, 384, 385, 385, 385, 384, 384, 385, 385, 384, 384, 384, 384,
+	384, 385, 386, 384, 386, 384, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 384, 384, 387,
+	388, 388, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 390,
+	391, 391, 390, 390, 392, 392, 389, 393, 393, 390, 394, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 192, 192, 192, 192, 192, 192, 32, 32, 192,
+	192, 192, 192, 192, 192, 32, 32, 192, 192, 192, 192, 192, 192, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 11, 23, 23, 23, 23, 13, 13, 13, 13, 13, 30, 13, 13, 13, 347, 11,
+	11, 32, 32, 32, 32, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+	198, 198, 198, 198, 198, 198, 389, 389, 389, 389, 389, 389, 389, 389,
+	389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 391,
+	390, 390, 391, 390, 390, 392, 395, 394, 32, 32, 396, 396, 396, 396,
+	396, 396, 396, 396, 396, 396, 32, 32, 32, 32, 32, 32, 191, 191, 191,
+	191, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 191, 191, 191,
+	191, 191, 191, 191, 32, 32, 32, 32, 191, 191, 191, 191, 191, 191, 191,
+	191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 32, 32, 32, 32, 397,
+	397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397,
+	397, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+	398, 398, 398, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 329,
+	329, 329, 329, 32, 32, 329, 329, 329, 329, 329, 329, 329, 329, 329,
+	329, 32, 32, 32, 32, 32, 32, 13, 13, 13, 13, 13, 13, 13, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 45, 45, 45, 45, 32, 32, 32,
+	32, 32, 53, 50, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 399, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 32, 53, 53, 53, 53, 53,
+	32, 53, 32, 53, 53, 32, 53, 53, 32, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 60, 60, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+	87, 87, 87, 87, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+	60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 6, 5, 58, 58, 58,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 32, 32, 60, 60,
+	60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+	60, 60, 60, 32, 32, 32, 32, 32, 32, 32, 58, 60, 60, 60, 60, 60, 60,
+	60, 60, 60, 60, 60, 60, 57, 58, 58, 58, 3, 3, 3, 3, 3, 3, 3, 5, 6, 3,
+	32, 32, 32, 32, 32, 32, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 40, 40, 3, 8, 8, 12, 12, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+	6, 5, 6, 5, 6, 3, 3, 5, 6, 3, 3, 3, 3, 12, 12, 12, 3, 3, 3, 32, 3, 3,
+	3, 3, 8, 5, 6, 5, 6, 5, 6, 3, 3, 3, 7, 8, 7, 7, 7, 32, 3, 4, 3, 3, 32,
+	32, 32, 32, 60, 60, 60, 60, 60, 32, 60, 60, 60, 60, 60, 60, 60, 60,
+	60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 32, 32,
+	17, 32, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7, 3, 8, 3, 3, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 5, 7, 6, 7, 5, 6, 3, 5, 6, 3, 3, 324, 324,
+	324, 324, 324, 324, 324, 324, 324, 324, 24, 324, 324, 324, 324, 324,
+	324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324,
+	324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 24, 24, 32, 32, 191,
+	191, 191, 191, 191, 191, 32, 32, 191, 191, 191, 191, 191, 191, 32, 32,
+	191, 191, 191, 191, 191, 191, 32, 32, 191, 191, 191, 32, 32, 32, 4, 4,
+	7, 11, 14, 4, 4, 32, 14, 7, 7, 7, 7, 14, 14, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 17, 17, 17, 14, 14, 32, 32, 400, 400, 400, 400, 400,
+	400, 400, 400, 400, 400, 400, 400, 32, 400, 400, 400, 400, 400, 400,
+	400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400,
+	400, 400, 400, 400, 400, 400, 32, 400, 400, 400, 400, 400, 400, 400,
+	400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 32, 400,
+	400, 32, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400,
+	400, 400, 400, 32, 32, 400, 400, 400, 400, 400, 400, 400, 400, 400,
+	400, 400, 32, 32, 32, 32, 32, 3, 3, 3, 32, 32, 32, 32, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 32, 32, 32, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+	401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 403,
+	403, 403, 403, 402, 402, 403, 403, 403, 32, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 32, 32, 32, 403, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 27, 32, 32, 404, 404, 404, 404, 404, 404, 404,
+	404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 404,
+	404, 404, 404, 404, 404, 404, 404, 404, 32, 32, 32, 405, 405, 405,
+	405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 27, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 32, 32, 32, 32, 406, 406, 406,
+	406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 407,
+	407, 407, 407, 32, 32, 32, 32, 32, 32, 32, 32, 32, 406, 406, 406, 408,
+	408, 408, 408, 408, 408, 408, 408, 408, 408, 408, 408, 408, 408, 408,
+	408, 408, 409, 408, 408, 408, 408, 408, 408, 408, 408, 409, 32, 32,
+	32, 32, 32, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410,
+	410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 410, 411, 411, 411,
+	411, 411, 32, 32, 32, 32, 32, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412, 412,
+	412, 412, 412, 412, 412, 412, 412, 412, 32, 413, 414, 414, 414, 414,
+	414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+	414, 414, 32, 32, 32, 32, 414, 414, 414, 414, 414, 414, 414, 414, 415,
+	416, 416, 416, 416, 416, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 417,
+	417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417, 417,
+	417, 417, 417, 417, 417, 417, 417, 417, 417, 418, 418, 418, 418, 418,
+	418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+	418, 418, 418, 418, 418, 419, 419, 419, 419, 419, 419, 419, 419, 419,
+	419, 419, 419, 419, 419, 419, 419, 420, 420, 420, 420, 420, 420, 420,
+	420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420, 420,
+	420, 420, 420, 420, 420, 420, 420, 420, 420, 32, 32, 421, 421, 421,
+	421, 421, 421, 421, 421, 421, 421, 32, 32, 32, 32, 32, 32, 422, 422,
+	422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422,
+	422, 422, 422, 422, 32, 32, 32, 32, 423, 423, 423, 423, 423, 423, 423,
+	423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+	423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423,
+	423, 32, 32, 32, 32, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424,
+	424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424,
+	32, 32, 32, 32, 32, 32, 32, 32, 425, 425, 425, 425, 425, 425, 425,
+	425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 426, 427, 427, 427, 427, 427,
+	427, 427, 427, 427, 427, 427, 32, 427, 427, 427, 427, 427, 427, 427,
+	32, 427, 427, 32, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+	428, 32, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+	428, 428, 428, 32, 428, 428, 428, 428, 428, 428, 428, 32, 428, 428,
+	32, 32, 32, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429,
+	429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 429, 429, 429, 429, 429, 429, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 429, 429, 429, 429, 429, 429, 429, 429,
+	32, 32, 32, 32, 32, 32, 32, 32, 23, 347, 347, 23, 23, 23, 32, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 32, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 32, 32, 32, 32, 32, 430, 430, 430, 430, 430, 430, 32, 32, 430, 32,
+	430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+	430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+	32, 430, 430, 32, 32, 32, 430, 32, 32, 430, 431, 431, 431, 431, 431,
+	431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431,
+	431, 431, 431, 32, 432, 433, 433, 433, 433, 433, 433, 433, 433, 434,
+	434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+	434, 434, 434, 434, 434, 434, 434, 434, 435, 435, 436, 436, 436, 436,
+	436, 436, 436, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437,
+	437, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437,
+	437, 437, 437, 437, 437, 437, 32, 32, 32, 32, 32, 32, 32, 32, 438,
+	438, 438, 438, 438, 438, 438, 438, 438, 439, 439, 439, 439, 439, 439,
+	439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 32,
+	439, 439, 32, 32, 32, 32, 32, 440, 440, 440, 440, 440, 441, 441, 441,
+	441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 441,
+	441, 441, 441, 441, 441, 442, 442, 442, 442, 442, 442, 32, 32, 32,
+	443, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444,
+	444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444, 32,
+	32, 32, 32, 32, 445, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446,
+	446, 446, 446, 446, 446, 446, 447, 447, 447, 447, 447, 447, 447, 447,
+	447, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447, 447,
+	447, 447, 32, 32, 32, 32, 448, 448, 447, 447, 448, 448, 448, 448, 448,
+	448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 32, 32, 448,
+	448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 449,
+	450, 450, 450, 32, 450, 450, 32, 32, 32, 32, 32, 450, 450, 450, 450,
+	449, 449, 449, 449, 32, 449, 449, 449, 32, 449, 449, 449, 449, 449,
+	449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+	449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 32, 32, 451, 451,
+	451, 32, 32, 32, 32, 451, 452, 452, 452, 452, 452, 452, 452, 452, 452,
+	32, 32, 32, 32, 32, 32, 32, 453, 453, 453, 453, 453, 453, 453, 453,
+	453, 32, 32, 32, 32, 32, 32, 32, 454, 454, 454, 454, 454, 454, 454,
+	454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454, 454,
+	454, 454, 454, 454, 454, 454, 454, 454, 455, 455, 456, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457,
+	457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 457, 458, 458,
+	458, 459, 459, 459, 459, 459, 459, 459, 459, 460, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+	459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 461, 461, 32, 32,
+	32, 32, 462, 462, 462, 462, 462, 463, 463, 463, 463, 463, 463, 463,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 464, 464, 464, 464, 464, 464, 464,
+	464, 464, 464, 464, 464, 464, 464, 464, 464, 464, 464, 464, 464, 464,
+	464, 32, 32, 32, 465, 465, 465, 465, 465, 465, 465, 466, 466, 466,
+	466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+	466, 466, 466, 466, 466, 32, 32, 467, 467, 467, 467, 467, 467, 467,
+	467, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
+	468, 468, 468, 468, 468, 468, 32, 32, 32, 32, 32, 469, 469, 469, 469,
+	469, 469, 469, 469, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470,
+	470, 470, 470, 470, 470, 470, 470, 470, 32, 32, 32, 32, 32, 32, 32,
+	471, 471, 471, 471, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	472, 472, 472, 472, 472, 472, 472, 473, 473, 473, 473, 473, 473, 473,
+	473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473, 473,
+	473, 473, 473, 473, 32, 32, 32, 32, 32, 32, 32, 474, 474, 474, 474,
+	474, 474, 474, 474, 474, 474, 474, 474, 474, 474, 474, 474, 474, 474,
+	474, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 475, 475,
+	475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475,
+	475, 475, 475, 32, 32, 32, 32, 32, 32, 32, 476, 476, 476, 476, 476,
+	476, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477,
+	477, 477, 477, 477, 477, 477, 477, 478, 478, 478, 478, 32, 32, 32, 32,
+	32, 32, 32, 32, 479, 479, 479, 479, 479, 479, 479, 479, 479, 479, 32,
+	32, 32, 32, 32, 32, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+	480, 480, 480, 480, 480, 480, 480, 32, 481, 481, 481, 481, 481, 481,
+	481, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481, 481,
+	481, 481, 481, 481, 481, 481, 32, 482, 482, 483, 32, 32, 481, 481, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 484, 484, 484,
+	484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484,
+	484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 485, 485,
+	485, 485, 485, 485, 485, 485, 485, 485, 484, 32, 32, 32, 32, 32, 32,
+	32, 32, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+	486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 487, 487, 487, 487,
+	487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 489, 489, 489,
+	489, 489, 32, 32, 32, 32, 32, 32, 490, 490, 490, 490, 490, 490, 490,
+	490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 491, 491, 491,
+	491, 492, 492, 492, 492, 32, 32, 32, 32, 32, 32, 493, 493, 493, 493,
+	493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 493,
+	493, 493, 493, 494, 494, 494, 494, 494, 494, 494, 32, 32, 32, 32, 495,
+	495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495,
+	495, 495, 495, 495, 495, 495, 495, 495, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 496, 497, 496, 498, 498, 498, 498, 498, 498, 498, 498, 498,
+	498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498,
+	498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498,
+	497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497,
+	499, 500, 500, 500, 500, 500, 500, 500, 32, 32, 32, 32, 501, 501, 501,
+	501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501, 501,
+	501, 501, 501, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 499,
+	498, 498, 497, 497, 498, 32, 32, 32, 32, 32, 32, 32, 32, 32, 499, 503,
+	503, 504, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+	505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505, 505,
+	505, 505, 505, 504, 504, 504, 506, 506, 506, 506, 504, 504, 503, 503,
+	507, 507, 508, 507, 507, 507, 507, 506, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 508, 32, 32, 509, 509, 509, 509, 509, 509, 509, 509, 509,
+	509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509, 509,
+	509, 509, 32, 32, 32, 32, 32, 32, 32, 510, 510, 510, 510, 510, 510,
+	510, 510, 510, 510, 32, 32, 32, 32, 32, 32, 511, 511, 511, 512, 512,
+	512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512,
+	512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512,
+	512, 512, 512, 512, 512, 512, 511, 511, 511, 511, 511, 513, 511, 511,
+	511, 511, 511, 511, 514, 514, 32, 515, 515, 515, 515, 515, 515, 515,
+	515, 515, 515, 516, 516, 516, 516, 512, 513, 513, 512, 32, 32, 32, 32,
+	32, 32, 32, 32, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+	517, 517, 517, 517, 517, 517, 517, 517, 518, 519, 519, 517, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 520, 520, 521, 522, 522, 522, 522, 522,
+	522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522,
+	522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 522, 521,
+	521, 521, 520, 520, 520, 520, 520, 520, 520, 520, 520, 521, 523, 522,
+	522, 522, 522, 524, 524, 524, 524, 525, 525, 525, 525, 524, 521, 520,
+	526, 526, 526, 526, 526, 526, 526, 526, 526, 526, 522, 524, 522, 524,
+	524, 524, 32, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527, 527,
+	527, 527, 527, 527, 527, 527, 527, 527, 527, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+	528, 528, 528, 528, 528, 528, 528, 528, 32, 528, 528, 528, 528, 528,
+	528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528, 528,
+	528, 528, 528, 528, 528, 528, 529, 529, 529, 530, 530, 530, 529, 529,
+	530, 531, 532, 530, 533, 533, 533, 533, 533, 533, 530, 32, 534, 534,
+	534, 534, 534, 534, 534, 32, 534, 32, 534, 534, 534, 534, 32, 534,
+	534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534,
+	32, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 535, 32, 32, 32,
+	32, 32, 32, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536,
+	536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536, 536,
+	536, 536, 536, 536, 536, 536, 537, 538, 538, 538, 537, 537, 537, 537,
+	537, 537, 539, 539, 32, 32, 32, 32, 32, 540, 540, 540, 540, 540, 540,
+	540, 540, 540, 540, 32, 32, 32, 32, 32, 32, 541, 541, 542, 542, 32,
+	543, 543, 543, 543, 543, 543, 543, 543, 32, 32, 543, 543, 32, 32, 543,
+	543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543, 543,
+	543, 543, 543, 543, 543, 543, 543, 32, 543, 543, 543, 543, 543, 543,
+	543, 32, 543, 543, 32, 543, 543, 543, 543, 543, 32, 27, 544, 543, 542,
+	542, 541, 542, 542, 542, 542, 32, 32, 542, 542, 32, 32, 542, 542, 545,
+	32, 32, 543, 32, 32, 32, 32, 32, 32, 542, 32, 32, 32, 32, 32, 543,
+	543, 543, 543, 543, 542, 542, 32, 32, 544, 544, 544, 544, 544, 544,
+	544, 32, 32, 32, 544, 544, 544, 544, 544, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 546,
+	546, 546, 546, 546, 546, 546, 546, 546, 546, 546, 547, 547, 547, 548,
+	548, 548, 548, 548, 548, 548, 548, 547, 547, 549, 548, 548, 547, 549,
+	546, 546, 546, 546, 550, 550, 550, 550, 550, 551, 551, 551, 551, 551,
+	551, 551, 551, 551, 551, 550, 550, 32, 550, 549, 546, 546, 546, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 552, 552, 552,
+	552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 553,
+	553, 553, 554, 554, 554, 554, 554, 554, 553, 554, 553, 553, 553, 553,
+	554, 554, 553, 555, 555, 552, 552, 556, 552, 32, 32, 32, 32, 32, 32,
+	32, 32, 557, 557, 557, 557, 557, 557, 557, 557, 557, 557, 32, 32, 32,
+	32, 32, 32, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+	558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558, 558,
+	558, 558, 558, 558, 558, 558, 559, 559, 559, 560, 560, 560, 560, 32,
+	32, 559, 559, 559, 559, 560, 560, 559, 561, 561, 562, 562, 562, 562,
+	562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562,
+	562, 562, 562, 562, 562, 558, 558, 558, 558, 560, 560, 32, 32, 563,
+	563, 563, 563, 563, 563, 563, 563, 563, 563, 563, 563, 563, 563, 563,
+	563, 564, 564, 564, 565, 565, 565, 565, 565, 565, 565, 565, 564, 564,
+	565, 564, 566, 565, 567, 567, 567, 563, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 32,
+	32, 32, 32, 32, 32, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+	229, 229, 229, 32, 32, 32, 569, 569, 569, 569, 569, 569, 569, 569,
+	569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569,
+	569, 569, 569, 569, 569, 570, 571, 570, 571, 571, 570, 570, 570, 570,
+	570, 570, 572, 573, 569, 574, 32, 32, 32, 32, 32, 32, 575, 575, 575,
+	575, 575, 575, 575, 575, 575, 575, 32, 32, 32, 32, 32, 32, 576, 576,
+	576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+	576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 32, 32, 577,
+	577, 577, 578, 578, 577, 577, 577, 577, 578, 577, 577, 577, 577, 579,
+	32, 32, 32, 32, 580, 580, 580, 580, 580, 580, 580, 580, 580, 580, 581,
+	581, 582, 582, 582, 583, 576, 576, 576, 576, 576, 576, 576, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 584, 584, 584, 584, 584, 584, 584, 584,
+	584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584,
+	584, 584, 584, 584, 584, 584, 585, 585, 585, 586, 586, 586, 586, 586,
+	586, 586, 586, 586, 585, 587, 587, 588, 32, 32, 32, 32, 589, 589, 589,
+	589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 590,
+	590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590,
+	590, 591, 591, 591, 591, 591, 591, 591, 591, 591, 591, 592, 592, 592,
+	592, 592, 592, 592, 592, 592, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 593, 594, 594, 594, 594, 594, 594, 594, 32, 32, 594, 32, 32,
+	594, 594, 594, 594, 594, 594, 594, 594, 32, 594, 594, 32, 594, 594,
+	594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594,
+	594, 594, 594, 594, 594, 594, 594, 594, 595, 595, 595, 595, 595, 595,
+	32, 595, 595, 32, 32, 596, 596, 597, 598, 594, 595, 594, 595, 598,
+	599, 599, 599, 32, 32, 32, 32, 32, 32, 32, 32, 32, 600, 600, 600, 600,
+	600, 600, 600, 600, 600, 600, 32, 32, 32, 32, 32, 32, 601, 601, 601,
+	601, 601, 601, 601, 601, 32, 32, 601, 601, 601, 601, 601, 601, 601,
+	601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+	601, 601, 602, 602, 602, 603, 603, 603, 603, 32, 32, 603, 603, 602,
+	602, 602, 602, 604, 601, 605, 601, 602, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 606, 607, 607, 607, 607, 607, 607, 607, 607, 607, 607,
+	606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606,
+	606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 608, 608, 607, 607,
+	607, 607, 609, 606, 607, 607, 607, 607, 610, 610, 610, 610, 610, 610,
+	610, 610, 608, 32, 32, 32, 32, 32, 32, 32, 32, 611, 612, 612, 612,
+	612, 612, 612, 613, 613, 612, 612, 612, 611, 611, 611, 611, 611, 611,
+	611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+	611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 612, 612, 612, 612,
+	612, 612, 612, 612, 612, 612, 612, 612, 612, 613, 614, 614, 615, 615,
+	615, 611, 615, 615, 615, 615, 615, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+	616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+	32, 32, 32, 32, 32, 32, 32, 617, 617, 617, 617, 617, 617, 617, 617,
+	617, 32, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617,
+	617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617,
+	617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 618, 619, 619,
+	619, 619, 619, 619, 619, 32, 619, 619, 619, 619, 619, 619, 618, 620,
+	617, 621, 621, 621, 621, 621, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 623, 623, 623, 623,
+	623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 623,
+	623, 32, 32, 32, 624, 624, 625, 625, 625, 625, 625, 625, 625, 625,
+	625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+	625, 625, 625, 625, 625, 625, 625, 625, 32, 32, 626, 626, 626, 626,
+	626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626,
+	626, 626, 626, 626, 32, 627, 626, 626, 626, 626, 626, 626, 626, 627,
+	626, 626, 627, 626, 626, 32, 32, 32, 32, 32, 32, 32, 32, 32, 628, 628,
+	628, 628, 628, 628, 628, 32, 628, 628, 32, 628, 628, 628, 628, 628,
+	628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+	628, 628, 628, 629, 629, 629, 629, 629, 629, 32, 32, 32, 629, 32, 629,
+	629, 32, 629, 629, 629, 630, 629, 630, 630, 628, 629, 32, 32, 32, 32,
+	32, 32, 32, 32, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 32,
+	32, 32, 32, 32, 32, 632, 632, 632, 632, 632, 632, 32, 632, 632, 32,
+	632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+	632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+	632, 632, 632, 632, 633, 633, 633, 633, 633, 32, 634, 634, 32, 633,
+	633, 634, 633, 635, 632, 32, 32, 32, 32, 32, 32, 32, 636, 636, 636,
+	636, 636, 636, 636, 636, 636, 636, 32, 32, 32, 32, 32, 32, 637, 637,
+	637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637,
+	637, 637, 637, 638, 638, 639, 639, 640, 640, 32, 32, 32, 32, 32, 32,
+	32, 333, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+	129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130,
+	130, 131, 131, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+	130, 130, 130, 130, 130, 130, 130, 130, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 641, 642, 642, 642, 642, 642, 642, 642, 642,
+	642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642,
+	642, 642, 642, 642, 32, 32, 32, 32, 32, 32, 643, 643, 643, 643, 643,
+	643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643,
+	643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 32, 644,
+	644, 644, 644, 644, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 642,
+	642, 642, 642, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 645,
+	645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645, 645,
+	645, 645, 646, 646, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647,
+	647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647,
+	647, 647, 647, 647, 32, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+	32, 32, 32, 32, 32, 32, 32, 649, 649, 649, 649, 649, 649, 649, 649,
+	649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649,
+	649, 32, 32, 32, 32, 32, 32, 32, 32, 32, 343, 343, 343, 343, 343, 343,
+	343, 343, 343, 32, 32, 32, 32, 32, 32, 32, 650, 650, 650, 650, 650,
+	650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650,
+	650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 32, 651,
+	651, 651, 651, 651, 651, 651, 651, 651, 651, 32, 32, 32, 32, 652, 652,
+	653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653,
+	653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653,
+	653, 653, 653, 32, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654,
+	32, 32, 32, 32, 32, 32, 655, 655, 655, 655, 655, 655, 655, 655, 655,
+	655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655,
+	655, 655, 655, 655, 655, 655, 655, 32, 32, 656, 656, 656, 656, 656,
+	657, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 658, 658, 658, 658, 658,
+	658, 658, 658, 658, 658, 658, 658, 658, 658, 658, 658, 659, 659, 659,
+	659, 659, 659, 659, 660, 660, 660, 660, 660, 661, 661, 661, 661, 662,
+	662, 662, 662, 660, 661, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 663,
+	663, 663, 663, 663, 663, 663, 663, 663, 663, 32, 664, 664, 664, 664,
+	664, 664, 664, 32, 658, 658, 658, 658, 658, 658, 658, 658, 658, 658,
+	658, 658, 658, 658, 658, 658, 658, 658, 658, 658, 658, 32, 32, 32, 32,
+	32, 658, 658, 658, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+	665, 665, 665, 665, 665, 665, 666, 666, 666, 666, 666, 666, 666, 666,
+	666, 666, 666, 666, 666, 666, 666, 666, 667, 667, 667, 667, 667, 667,
+	667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667,
+	667, 667, 667, 668, 668, 668, 668, 32, 32, 32, 32, 32, 669, 669, 669,
+	669, 669, 669, 669, 669, 669, 669, 669, 669, 669, 669, 669, 669, 669,
+	669, 669, 669, 669, 669, 669, 669, 669, 669, 669, 32, 32, 32, 32, 670,
+	669, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671,
+	671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671,
+	671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 32, 32,
+	32, 32, 32, 32, 32, 670, 670, 670, 670, 672, 672, 672, 672, 672, 672,
+	672, 672, 672, 672, 672, 672, 672, 673, 674, 675, 319, 676, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 677, 677, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 678, 678, 678, 678, 678, 678, 678,
+	678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678,
+	678, 678, 678, 32, 32, 32, 32, 32, 32, 32, 32, 679, 679, 679, 679,
+	679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679,
+	679, 679, 679, 679, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 678, 678,
+	678, 678, 678, 678, 678, 678, 678, 32, 32, 32, 32, 32, 32, 32, 325,
+	325, 325, 325, 32, 325, 325, 325, 325, 325, 325, 325, 32, 325, 325,
+	32, 324, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322,
+	322, 322, 322, 324, 324, 324, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 322, 322, 322, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 324, 324, 324, 324, 32, 32, 32, 32, 32, 32,
+	32, 32, 680, 680, 680, 680, 680, 680, 680, 680, 680, 680, 680, 680,
+	680, 680, 680, 680, 680, 680, 680, 680, 680, 680, 680, 680, 680, 680,
+	680, 680, 32, 32, 32, 32, 681, 681, 681, 681, 681, 681, 681, 681, 681,
+	681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681,
+	681, 681, 681, 681, 32, 32, 32, 32, 32, 681, 681, 681, 681, 681, 681,
+	681, 681, 681, 681, 681, 681, 681, 32, 32, 32, 681, 681, 681, 681,
+	681, 681, 681, 681, 681, 32, 32, 32, 32, 32, 32, 32, 681, 681, 681,
+	681, 681, 681, 681, 681, 681, 681, 32, 32, 682, 683, 684, 685, 17, 17,
+	17, 17, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 32, 32, 27, 27, 27, 27,
+	27, 27, 27, 32, 32, 32, 32, 32, 32, 32, 32, 32, 14, 14, 14, 14, 14,
+	14, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 14, 14, 14, 14, 14, 14,
+	14, 32, 32, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 293, 293,
+	27, 27, 27, 14, 14, 14, 293, 293, 293, 293, 293, 293, 17, 17, 17, 17,
+	17, 17, 17, 17, 27, 27, 27, 27, 27, 27, 27, 27, 14, 14, 27, 27, 27,
+	27, 27, 27, 27, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 27, 27, 27, 27, 14, 14, 403, 403, 403, 403, 403, 403, 403, 403,
+	403, 403, 403, 403, 403, 403, 403, 403, 403, 403, 686, 686, 686, 403,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 18, 18, 18, 18, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 32, 32, 32, 32, 32, 32, 32, 300, 300, 300, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 300, 300,
+	300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 19, 19, 19, 19, 19,
+	19, 19, 32, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 300, 32, 300, 300, 32, 32, 300, 32,
+	32, 300, 300, 32, 32, 300, 300, 300, 300, 32, 300, 300, 300, 300, 300,
+	300, 300, 300, 19, 19, 19, 19, 32, 19, 32, 19, 19, 19, 19, 19, 19, 19,
+	32, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 300,
+	300, 32, 300, 300, 300, 300, 32, 32, 300, 300, 300, 300, 300, 300,
+	300, 300, 32, 300, 300, 300, 300, 300, 300, 300, 32, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 300, 300, 32, 300, 300, 300, 300, 32, 300,
+	300, 300, 300, 300, 32, 300, 32, 32, 32, 300, 300, 300, 300, 300, 300,
+	300, 32, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 300, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 32, 32, 300, 300, 300, 300, 300, 300, 300, 300,
+	300, 7, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 7, 19, 19, 19, 19, 19, 19,
+	300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 7, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 7, 19, 19, 19, 19, 19, 19, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 7, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 7, 19, 19,
+	19, 19, 19, 19, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+	300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+	7, 19, 19, 19, 19, 19, 19, 19, 19, 19, 7, 19, 19, 19, 19, 19, 19, 300,
+	300, 300, 300, 300, 300, 300, 300, 300, 7, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 7, 19, 19, 19, 19, 19, 19, 300, 19, 32, 32, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 687, 687, 687, 687, 687, 687, 687,
+	687, 687, 687, 687, 687, 687, 687, 687, 687, 688, 688, 688, 688, 688,
+	688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688,
+	688, 688, 688, 688, 687, 687, 687, 687, 688, 688, 688, 688, 688, 688,
+	688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 687, 687,
+	687, 687, 687, 687, 687, 687, 688, 687, 687, 687, 687, 687, 687, 687,
+	687, 687, 687, 687, 687, 687, 687, 688, 687, 687, 689, 689, 689, 689,
+	689, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 688,
+	688, 688, 688, 688, 32, 688, 688, 688, 688, 688, 688, 688, 688, 688,
+	688, 688, 688, 688, 688, 688, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	21, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 32, 690, 690, 690, 690, 690, 690, 690, 32, 690, 690,
+	690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690,
+	690, 32, 32, 690, 690, 690, 690, 690, 690, 690, 32, 690, 690, 32, 690,
+	690, 690, 690, 690, 32, 32, 32, 32, 32, 691, 691, 691, 691, 691, 691,
+	691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691, 691,
+	691, 691, 691, 691, 691, 691, 691, 691, 691, 32, 32, 32, 692, 692,
+	692, 692, 692, 692, 692, 693, 693, 693, 693, 693, 693, 693, 32, 32,
+	694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 32, 32, 32, 32, 691,
+	695, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696,
+	696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696, 696,
+	696, 696, 696, 697, 32, 698, 698, 698, 698, 698, 698, 698, 698, 698,
+	698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698, 698,
+	698, 698, 698, 698, 698, 699, 699, 699, 699, 700, 700, 700, 700, 700,
+	700, 700, 700, 700, 700, 32, 32, 32, 32, 32, 701, 192, 192, 192, 192,
+	192, 192, 192, 32, 192, 192, 192, 192, 32, 192, 192, 32, 192, 192,
+	192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 32,
+	702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702,
+	702, 702, 702, 702, 702, 702, 702, 32, 32, 703, 703, 703, 703, 703,
+	703, 703, 703, 703, 704, 704, 704, 704, 704, 704, 704, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705,
+	705, 705, 705, 705, 705, 705, 705, 705, 706, 706, 706, 706, 706, 706,
+	706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706,
+	706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706,
+	707, 707, 707, 708, 707, 707, 707, 709, 32, 32, 32, 32, 710, 710, 710,
+	710, 710, 710, 710, 710, 710, 710, 32, 32, 32, 32, 711, 711, 32, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 14, 18, 18, 18, 4, 18, 18, 18, 18,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 14, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 32, 32, 60, 60, 60, 60, 32, 60, 60, 60,
+	60, 60, 60, 60, 60, 60, 60, 60, 32, 60, 60, 32, 60, 32, 32, 60, 32,
+	60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 32, 60, 60, 60, 60, 32, 60,
+	32, 60, 32, 32, 32, 32, 32, 32, 60, 32, 32, 32, 32, 60, 32, 60, 32,
+	60, 32, 60, 60, 60, 32, 60, 60, 32, 60, 32, 32, 60, 32, 60, 32, 60,
+	32, 60, 32, 60, 32, 60, 60, 32, 60, 32, 32, 60, 60, 60, 60, 32, 60,
+	60, 60, 60, 60, 60, 60, 32, 60, 60, 60, 60, 32, 60, 60, 60, 60, 32,
+	60, 32, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 32, 60, 60, 60, 60,
+	60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 32, 32, 32, 32,
+	32, 60, 60, 60, 32, 60, 60, 60, 60, 60, 32, 60, 60, 60, 60, 60, 55,
+	55, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 32, 32, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 14, 14, 14, 304, 304, 304, 304,
+	304, 304, 304, 304, 304, 304, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 32, 32, 32, 32, 32, 32, 32,
+	32, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 712, 14, 14, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 32, 32, 32, 32, 32, 32, 32, 14, 14, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 14, 11, 11, 11, 11, 11, 14, 14, 14, 14, 14, 14, 14, 14, 32, 32,
+	32, 32, 32, 14, 14, 14, 14, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+	32, 32, 32, 32, 32, 14, 14, 14, 14, 14, 14, 14, 14, 32, 32, 32, 32,
+	32, 32, 32, 32, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 32, 32, 32,
+	32, 32, 32, 14, 14, 14, 14, 14, 32, 32, 32, 14, 14, 14, 14, 14, 32,
+	32, 32, 14, 14, 14, 32, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 32, 32, 32, 32, 32, 32, 329, 329,
+	329, 329, 329, 329, 329, 329, 329, 32, 32, 32, 32, 32, 32, 32, 329,
+	329, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 329, 32,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 329, 329, 329,
+	329, 329, 329, 329, 329, 329, 329, 329, 32, 32, 32, 32, 32, 32, 17,
+	32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 398, 398, 398,
+	398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 32, 32
+};
+
+static inline uint16_t runeprop_lookup(Rune c)
+{
+	size_t i = (size_t)runeprop_idx1[c >> 9] << 5 | (c >> 4 & 0x1f);
+
+	return runeprop_blk[(size_t)runeprop_idx2[i] << 4 | (c & 0xf)];
+}
+
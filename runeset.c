@@ -0,0 +1,205 @@
+#include <stdlib.h>
+#include "utf.h"
+#include "utfint.h"
+
+/* shufti needs ssse3, which is checked at run time on x86 */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RUNESET_SHUFTI
+#include <tmmintrin.h>
+#endif
+
+static int rune_cmp(const void *a, const void *b)
+{
+	Rune r1 = *(const Rune *)a, r2 = *(const Rune *)b;
+
+	return (r1 > r2) - (r1 < r2);
+}
+
+/* add a byte a rune in the set can start with */
+static void add_first(struct runeset *set, unsigned char c)
+{
+	int bucket = (c >> 4) & 7;
+
+	set->first[c >> 3] |= 1u << (c & 7);
+	set->lo[c & 0xf] |= 1u << bucket;
+	set->hi[c >> 4] |= 1u << bucket;
+}
+
+int runesetinit(struct runeset *set, const Rune *runes, size_t n)
+{
+	size_t i, j;
+
+	memset(set, 0, sizeof(*set));
+	set->runes = malloc((n ? n : 1) * sizeof(*set->runes));
+	if (!set->runes)
+		return -1;
+	for (i = 0; i < n; i++) {
+		char buf[UTFmax];
+		Rune rune = runes[i];
+
+		if (rune == Runeerror) {
+			/* invalid encodings can start with any byte >= 0x80 */
+			set->invalid = 1;
+			for (j = 0x80; j <= 0xff; j++)
+				add_first(set, j);
+		}
+		if (!validrune(rune))
+			continue;
+		runetochar(buf, &rune);
+		add_first(set, *buf);
+		if (rune >= Runeself)
+			set->runes[set->len++] = rune;
+	}
+	qsort(set->runes, set->len, sizeof(*set->runes), rune_cmp);
+	for (i = j = 0; i < set->len; i++) {
+		if (!j || set->runes[j - 1] != set->runes[i])
+			set->runes[j++] = set->runes[i];
+	}
+	set->len = j;
+	return 0;
+}
+
+void runesetfree(struct runeset *set)
+{
+	free(set->runes);
+	set->runes = NULL;
+	set->len = 0;
+}
+
+/* return 1 if a rune is in the set */
+static inline int runeset_has(const struct runeset *set, Rune rune)
+{
+	size_t lo = 0, hi = set->len;
+
+	if (rune < Runeself)
+		return set->first[rune >> 3] >> (rune & 7) & 1;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (set->runes[mid] == rune)
+			return 1;
+		else if (set->runes[mid] < rune)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/* return 1 if a rune in the set can start with c */
+static inline int runeset_first(const struct runeset *set, unsigned char c)
+{
+	return set->first[c >> 3] >> (c & 7) & 1;
+}
+
+#ifdef RUNESET_SHUFTI
+/*
+ * return the number of leading bytes no rune in the set can start with,
+ * checking 16 at a time and leaving less than 16 to the caller
+ */
+__attribute__((target("ssse3")))
+static size_t runeset_shufti(const struct runeset *set, const char *str,
+                             size_t n)
+{
+	/* shufti: a byte is a candidate if its nibbles share a bucket */
+	__m128i lo = _mm_loadu_si128((const __m128i *)set->lo);
+	__m128i hi = _mm_loadu_si128((const __m128i *)set->hi);
+	__m128i nibble = _mm_set1_epi8(0xf), zero = _mm_setzero_si128();
+	size_t i;
+
+	for (i = 0; i + 16 <= n; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(str + i));
+		__m128i m = _mm_and_si128(
+			_mm_shuffle_epi8(lo, _mm_and_si128(v, nibble)),
+			_mm_shuffle_epi8(hi, _mm_and_si128(
+				_mm_srli_epi16(v, 4), nibble)));
+		int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(m, zero)) ^ 0xffff;
+
+		/* buckets are shared, so confirm with the exact table */
+		while (mask) {
+			int j = __builtin_ctz(mask);
+
+			if (runeset_first(set, str[i + j]))
+				return i + j;
+			mask &= mask - 1;
+		}
+	}
+	return i;
+}
+#endif
+
+/* return the number of leading bytes no rune in the set can start with */
+static inline size_t runeset_skip(const struct runeset *set, const char *str,
+                                  size_t n)
+{
+	size_t i = 0;
+
+#ifdef RUNESET_SHUFTI
+	if (__builtin_cpu_supports("ssse3"))
+		i = runeset_shufti(set, str, n);
+#endif
+	for (; i < n; i++) {
+		if (runeset_first(set, str[i]))
+			break;
+	}
+	return i;
+}
+
+size_t utfcspan(const char *str, size_t n, const struct runeset *set)
+{
+	size_t i = 0;
+	Rune rune;
+	int w;
+
+	while (i < n) {
+		/* without invalid encodings, candidates are rune boundaries */
+		if (!set->invalid) {
+			i += runeset_skip(set, str + i, n - i);
+			if (i == n)
+				break;
+		}
+		if ((unsigned char)str[i] < Runeself) {
+			if (runeset_has(set, (unsigned char)str[i]))
+				break;
+			i++;
+			continue;
+		}
+		w = charntorune(&rune, str + i, n - i);
+		if (runeset_has(set, rune))
+			break;
+		i += w;
+	}
+	STAT(stats_search(str, n, (i < n) ? str + i : NULL, 1));
+	return i;
+}
+
+size_t utfspan(const char *str, size_t n, const struct runeset *set)
+{
+	size_t i = 0;
+	Rune rune;
+	int w;
+
+	while (i < n) {
+		unsigned char c = str[i];
+
+		if (!runeset_first(set, c))
+			break;
+		if (c < Runeself) {
+			i++;
+			continue;
+		}
+		w = charntorune(&rune, str + i, n - i);
+		if (!runeset_has(set, rune))
+			break;
+		i += w;
+	}
+	STAT(stats_search(str, n, (i < n) ? str + i : NULL, 1));
+	return i;
+}
+
+char *utfrunes(const char *str, size_t n, const struct runeset *set)
+{
+	size_t i = utfcspan(str, n, set);
+
+	return (i < n) ? (char *)str + i : NULL;
+}
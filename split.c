@@ -0,0 +1,87 @@
+#include "utf.h"
+#include "utfint.h"
+
+static void split_init(struct utfsplit *sp, const char *str, size_t n)
+{
+	memset(sp, 0, sizeof(*sp));
+	sp->str = str;
+	sp->n = n;
+}
+
+void utfsplitinit(struct utfsplit *sp, const char *str, size_t n,
+                  const char *sep, size_t m)
+{
+	split_init(sp, str, n);
+	sp->sep = sep;
+	sp->seplen = m;
+}
+
+void utfsplitrune(struct utfsplit *sp, const char *str, size_t n, Rune sep)
+{
+	split_init(sp, str, n);
+	sp->seplen = runetochar(sp->rune, &sep);
+}
+
+void utfsplitset(struct utfsplit *sp, const char *str, size_t n,
+                 const struct runeset *set)
+{
+	split_init(sp, str, n);
+	sp->set = set;
+}
+
+/* return the offset of the next separator, or n, and its size in @w */
+static size_t split_find(const struct utfsplit *sp, size_t *w)
+{
+	const char *sep = sp->sep ? sp->sep : sp->rune;
+	const char *p;
+	Rune rune;
+
+	*w = 0;
+	if (sp->set) {
+		size_t off = utfcspan(sp->str, sp->n, sp->set);
+
+		if (off < sp->n)
+			*w = charntorune(&rune, sp->str + off, sp->n - off);
+		return off;
+	}
+	if (!sp->seplen)
+		return sp->n;
+	p = utfnutf(sp->str, sp->n, sep, sp->seplen);
+	if (!p)
+		return sp->n;
+	*w = sp->seplen;
+	return p - sp->str;
+}
+
+int utfsplitnext(struct utfsplit *sp, const char **field, size_t *len)
+{
+	size_t off, w;
+
+	if (sp->done)
+		return 0;
+	/* skipping leading separators leaves no empty fields */
+	while (sp->collapse && sp->n && !split_find(sp, &w) && w) {
+		sp->str += w;
+		sp->n -= w;
+	}
+	if (sp->collapse && !sp->n) {
+		sp->done = 1;
+		return 0;
+	}
+	if (sp->limit && sp->splits == sp->limit) {
+		off = sp->n;
+		w = 0;
+	} else {
+		off = split_find(sp, &w);
+	}
+	*field = sp->str;
+	*len = off;
+	if (!w) {
+		sp->done = 1;
+	} else {
+		sp->str += off + w;
+		sp->n -= off + w;
+		sp->splits++;
+	}
+	return 1;
+}
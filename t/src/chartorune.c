@@ -138,6 +138,10 @@ int main()
 	           {4, 0x10ffff, "U+10FFFF"},
 	);
 
+	utf8_check("U+1D800", "\xf0\x9d\xa0\x80",
+	           {4, 0x1d800, "U+1D800 SIGNWRITING HAND-FIST INDEX"},
+	);
+
 	utf8_check("U+110000", "\xf4\x90\x80\x80",
 	           {1, Runeerror, "Runeerror"},
 	           {1, Runeerror, "Runeerror"},
@@ -0,0 +1,50 @@
+#include "tap.h"
+#include "utf.h"
+
+int main()
+{
+	is(runecategory('A'), RUNECAT_LU, "%d", "'A' is Lu");
+	is(runecategory('a'), RUNECAT_LL, "%d", "'a' is Ll");
+	is(runecategory('7'), RUNECAT_ND, "%d", "'7' is Nd");
+	is(runecategory(0x01c5), RUNECAT_LT, "%d", "U+01C5 is Lt");
+	is(runecategory(0x0301), RUNECAT_MN, "%d", "U+0301 is Mn");
+	is(runecategory(0x20ac), RUNECAT_SC, "%d", "EURO SIGN is Sc");
+	is(runecategory(0x2028), RUNECAT_ZL, "%d", "LINE SEPARATOR is Zl");
+	is(runecategory(0xe000), RUNECAT_CO, "%d", "U+E000 is Co");
+	is(runecategory(0xd800), RUNECAT_CS, "%d", "U+D800 is Cs");
+	is(runecategory(0x0378), RUNECAT_CN, "%d", "U+0378 is Cn");
+	is(runecategory(0x110000), RUNECAT_CN, "%d", "Invalid runes are Cn");
+
+	is(runescript('a'), RUNESCRIPT("Latn"), "%08"PRIX32, "'a' is Latin");
+	is(runescript('1'), RUNESCRIPT("Zyyy"), "%08"PRIX32, "'1' is Common");
+	is(runescript(0x03c3), RUNESCRIPT("Grek"), "%08"PRIX32,
+	   "U+03C3 is Greek");
+	is(runescript(0x0915), RUNESCRIPT("Deva"), "%08"PRIX32,
+	   "U+0915 is Devanagari");
+	is(runescript(0x0301), RUNESCRIPT("Zinh"), "%08"PRIX32,
+	   "U+0301 is Inherited");
+	is(runescript(0x4e2d), RUNESCRIPT("Hani"), "%08"PRIX32,
+	   "U+4E2D is Han");
+	is(runescript(0x0378), RUNESCRIPT("Zzzz"), "%08"PRIX32,
+	   "U+0378 is Unknown");
+	is(runescript(0x110000), RUNESCRIPT("Zzzz"), "%08"PRIX32,
+	   "Invalid runes are Unknown");
+
+	ok(runeisspace(' ') && runeisspace('\n') && runeisspace(0x85) &&
+	   runeisspace(0x3000) && runeisspace(0x2029),
+	   "White space is detected");
+	ok(!runeisspace(0x200b) && !runeisspace('x'),
+	   "ZERO WIDTH SPACE isn't white space");
+	ok(runeisalpha('x') && runeisalpha(0x0915) && runeisalpha(0x093e) &&
+	   runeisalpha(0x2160), "Alphabetic runes are detected");
+	ok(!runeisalpha('1') && !runeisalpha(0x0301),
+	   "Digits and U+0301 aren't alphabetic");
+	ok(runeisupper('Q') && runeisupper(0x2160) && !runeisupper('q'),
+	   "Uppercase runes are detected");
+	ok(runeislower('q') && runeislower(0x00aa) && !runeislower('Q'),
+	   "Lowercase runes are detected");
+	ok(runeisdigit('0') && runeisdigit(0x0966) && !runeisdigit(0x00b2),
+	   "Decimal digits are detected");
+
+	done_testing();
+}
@@ -0,0 +1,31 @@
+#include "tap.h"
+#include "utf.h"
+
+int main()
+{
+	Rune runes[] = {
+		0x0041, 0x007f, 0x0080, 0x07ff, 0x0800, 0xffff, 0x10000,
+		0x10ffff, 0xd800, 0xdfff, 0x110000, 0xffffffff, 0x1d800
+	};
+	size_t i, n = sizeof(runes) / sizeof(*runes), len8 = 0, len16 = 0;
+
+	for (i = 0; i < n; i++) {
+		char buf[UTFmax];
+		char16_t buf16[2];
+
+		is(runelen(runes[i]), runetochar(buf, &runes[i]), "%d",
+		   "runelen() of U+%"PRIRune" matches runetochar()", runes[i]);
+		len8 += runetochar(buf, &runes[i]);
+		len16 += runetochar16(buf16, &runes[i]);
+	}
+	for (i = 0; i <= n; i++) {
+		is(runenlen8(runes, i) + runenlen8(runes + i, n - i), len8, "%zu",
+		   "runenlen8() sums up the sizes split at %zu", i);
+		is(runenlen16(runes, i) + runenlen16(runes + i, n - i), len16,
+		   "%zu", "runenlen16() sums up the sizes split at %zu", i);
+	}
+	is(runenlen(runes, n), (int)len8, "%d", "runenlen() matches runenlen8()");
+	is(runenlen(runes, -1), 0, "%d", "runenlen() of a negative count is 0");
+
+	done_testing();
+}
@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+/* naive index of the first unpaired surrogate */
+static size_t naive16(const char16_t *str, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		if (str[i] >= 0xdc00 && str[i] < 0xe000)
+			return i;
+		if (str[i] >= 0xd800 && str[i] < 0xdc00) {
+			if (i + 1 == n || str[i + 1] < 0xdc00 ||
+			    str[i + 1] >= 0xe000)
+				return i;
+			i++;
+		}
+	}
+	return n;
+}
+
+static size_t naive32(const char32_t *str, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		if (!validrune(str[i]))
+			break;
+	}
+	return i;
+}
+
+static char16_t swap16(char16_t c)
+{
+	return (char16_t)(c << 8 | c >> 8);
+}
+
+static char32_t swap32(char32_t c)
+{
+	return c << 24 | (c & 0xff00) << 8 | (c >> 8 & 0xff00) | c >> 24;
+}
+
+int main()
+{
+	static const char16_t pair[] = { 'a', 0xd83d, 0xde00, 'b' };
+	static const char16_t lone[] = {
+		'a', 'b', 'c', 'd', 'e', 'f', 'g', 0xd83d, 'h'
+	};
+	static const char32_t runes[] = {
+		'a', 0x10ffff, 0xe000, 0xd7ff, 0xdfff
+	};
+	char16_t s16[40], x16[40];
+	char32_t s32[40], x32[40];
+	int big = swap16(1) == 1, bad = 0;
+	size_t err, i, j, n;
+
+	ok(utf16valid(pair, 4, &err) && err == 4, "Pairs are valid");
+	ok(!utf16valid(pair, 2, &err) && err == 1,
+	   "A high surrogate at the end is invalid");
+	ok(!utf16valid(pair + 2, 2, &err) && err == 0,
+	   "A low surrogate alone is invalid");
+	ok(!utf16valid(lone, 9, &err) && err == 7,
+	   "A high surrogate alone is invalid");
+	ok(utf16valid(pair, 0, NULL), "Nothing is valid");
+	ok(!utf32valid(runes, 5, &err) && err == 4,
+	   "Surrogates are invalid in utf-32");
+	ok(utf32valid(runes, 4, &err) && err == 4, "Other runes are valid");
+
+	srand(1);
+	for (i = 0; i < 20000; i++) {
+		n = rand() % 40;
+		for (j = 0; j < n; j++) {
+			/* mostly valid, with some surrogates and large runes */
+			int r = rand() % 64;
+
+			s16[j] = r ? 'a' + r : 0xd800 + rand() % 0x800;
+			s32[j] = 'a' + r;
+			if (!r && (rand() & 1))
+				s32[j] = 0xd800 + (char32_t)rand() % 0x800;
+			else if (!r)
+				s32[j] = 0x110000 + (char32_t)rand();
+			if (r == 1)
+				s16[j] = 0xd800 + rand() % 0x400;
+			if (r == 2)
+				s16[j] = 0xdc00 + rand() % 0x400;
+			x16[j] = swap16(s16[j]);
+			x32[j] = swap32(s32[j]);
+		}
+		utf16valid(s16, n, &err);
+		bad += err != naive16(s16, n);
+		utf16xevalid(x16, n, !big, &err);
+		bad += err != naive16(s16, n);
+		utf16xevalid(s16, n, big, &err);
+		bad += err != naive16(s16, n);
+		utf32valid(s32, n, &err);
+		bad += err != naive32(s32, n);
+		utf32xevalid(x32, n, !big, &err);
+		bad += err != naive32(s32, n);
+		utf32levalid(big ? x32 : s32, n, &err);
+		bad += err != naive32(s32, n);
+	}
+	is(bad, 0, "%d", "The first invalid code unit matches a naive check");
+
+	done_testing();
+}
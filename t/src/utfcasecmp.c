@@ -0,0 +1,66 @@
+#include "tap.h"
+#include "utf.h"
+
+int main()
+{
+	char buf[64];
+	size_t n;
+
+	is(runecasefold('A'), 'a', "U+%"PRIRune, "'A' folds to 'a'");
+	is(runecasefold('a'), 'a', "U+%"PRIRune, "'a' stays 'a'");
+	is(runecasefold(0x212a), 'k', "U+%"PRIRune, "KELVIN SIGN folds to 'k'");
+	is(runecasefold(0x03a3), 0x03c3, "U+%"PRIRune,
+	   "GREEK CAPITAL LETTER SIGMA folds to GREEK SMALL LETTER SIGMA");
+	is(runecasefold(0x03c2), 0x03c3, "U+%"PRIRune,
+	   "GREEK SMALL LETTER FINAL SIGMA folds to GREEK SMALL LETTER SIGMA");
+	is(runecasefold(0x1e9e), 0x00df, "U+%"PRIRune,
+	   "LATIN CAPITAL LETTER SHARP S folds to LATIN SMALL LETTER SHARP S");
+	is(runecasefold(0x10400), 0x10428, "U+%"PRIRune,
+	   "DESERET CAPITAL LETTER LONG I folds to DESERET SMALL LETTER LONG I");
+	is(runecasefold(0xd800), 0xd800, "U+%"PRIRune,
+	   "Invalid runes are left alone");
+
+	n = utfcasefold(buf, sizeof(buf), "Gr\xc3\x9c\xc3\x9f Dich", 11);
+	is(n, 11, "%zu", "Folding \"GrÜß Dich\" keeps its size");
+	ismem(buf, "gr\xc3\xbc\xc3\x9f dich", 11,
+	      "\"GrÜß Dich\" folds to \"grüß dich\"");
+	n = utfcasefold(buf, sizeof(buf), "\xc8\xba", 2);
+	is(n, 3, "%zu", "U+023A folds to a longer encoding");
+	ismem(buf, "\xe2\xb1\xa5", 3,
+	      "LATIN CAPITAL LETTER A WITH STROKE folds to U+2C65");
+	n = utfcasefold(buf, 2, "A\xc8\xba", 3);
+	is(n, 4, "%zu", "The needed size is returned if the buffer is too small");
+	ismem(buf, "a", 1, "Only whole runes are written to a small buffer");
+
+	ok(!utfcasecmp("Stra\xc3\x9f" "e", "STRA\xe1\xba\x9e" "E"),
+	   "\"Straße\" equals \"STRAẞE\"");
+	ok(!utfcasecmp("\xce\x9a\xce\x8c\xce\xa3\xce\x9c\xce\x95",
+	               "\xce\xba\xce\x8c\xcf\x83\xce\xbc\xce\xb5"),
+	   "Greek words compare equal ignoring case");
+	ok(utfcasecmp("abc", "ABD") < 0, "\"abc\" is less than \"ABD\"");
+	ok(utfcasecmp("abc", "AB") > 0, "\"abc\" is greater than \"AB\"");
+	ok(utfcasecmp("", "a") < 0, "\"\" is less than \"a\"");
+	ok(!utfncasecmp("Content-Type: x", "content-type: y", 13),
+	   "utfncasecmp() only compares n runes");
+	ok(!utfncasecmp("\xc3\x9c" "ber", "\xc3\xbc" "BERALL", 4),
+	   "utfncasecmp() counts runes, not bytes");
+	ok(utfncasecmp("\xc3\x9c" "ber", "\xc3\xbc" "BERALL", 5) < 0,
+	   "utfncasecmp() sees the end of the shorter string");
+
+	{
+		const char *str = "Hello W\xc3\x96rld, hello world";
+
+		ok(utfcaseutf(str, "w\xc3\xb6RLD") == str + 6,
+		   "utfcaseutf() finds \"wöRLD\"");
+		ok(utfcaseutf(str, "") == str,
+		   "utfcaseutf() finds the empty string");
+		ok(utfcaseutf(str, "WORLD") == str + 20,
+		   "utfcaseutf() finds \"WORLD\"");
+		ok(!utfcaseutf(str, "worlds"),
+		   "utfcaseutf() doesn't find \"worlds\"");
+		ok(utfcaseutf("\xe2\x84\xaa" "elvin", "KELVIN") != NULL,
+		   "utfcaseutf() folds KELVIN SIGN");
+	}
+
+	done_testing();
+}
@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+static const enum utfconv_type types[] = {
+	UTFCONV_UTF8, UTFCONV_UTF16, UTFCONV_UTF16LE, UTFCONV_UTF16BE,
+	UTFCONV_UTF32, UTFCONV_UTF32LE, UTFCONV_UTF32BE, UTFCONV_WCHAR
+};
+
+/* convert n runes to a type and return the size in bytes */
+static size_t encode(void *ret, enum utfconv_type type, const Rune *runes,
+                     size_t n)
+{
+	static const size_t unit[] = {
+		1, 2, 2, 2, 4, 4, 4, sizeof(wchar_t)
+	};
+	int len = utfnconv(ret, type, runes, n * sizeof(*runes),
+	                   UTFCONV_UTF32, NULL);
+
+	return len * unit[type];
+}
+
+static int sign(int x)
+{
+	return (x > 0) - (x < 0);
+}
+
+static int naive(const Rune *a, size_t alen, const Rune *b, size_t blen)
+{
+	size_t i;
+
+	for (i = 0; i < alen && i < blen; i++) {
+		if (a[i] != b[i])
+			return (a[i] < b[i]) ? -1 : 1;
+	}
+	return (i < alen) - (i < blen);
+}
+
+int main()
+{
+	static const Rune pool[] = { 'a', 'b', 0xe4, 0xffff, 0x10000, 0xe000 };
+	static const char16_t ffff[] = { 0xffff }, pair[] = { 0xd800, 0xdc00 };
+	Rune a[12], b[12];
+	size_t i, j, alen, blen;
+	int bad = 0;
+
+	ok(utfconvcmp("abc", 3, UTFCONV_UTF8, "abc", 3, UTFCONV_UTF8) == 0,
+	   "Equal strings compare equal");
+	ok(utfconvcmp("abcdefghij", 10, UTFCONV_UTF8, "abcdefghiz", 10,
+	              UTFCONV_UTF8) < 0, "Compares after ascii");
+	ok(utfconvcmp("ab", 2, UTFCONV_UTF8, "a\0b\0", 4, UTFCONV_UTF16LE) == 0,
+	   "Compares across encodings");
+	ok(utfconvcmp("a", 1, UTFCONV_UTF8, "\xff\xfe" "a\0b\0", 6,
+	              UTFCONV_AUTO) < 0, "Detects encodings");
+	ok(utfconvcmp(ffff, 2, UTFCONV_UTF16, pair, 4, UTFCONV_UTF16) < 0,
+	   "U+FFFF is less than U+10000 in utf-16");
+	ok(utfconvcmp("\xff", 1, UTFCONV_UTF8, "\xef\xbf\xbd", 3,
+	              UTFCONV_UTF8) == 0, "Invalid encodings are U+FFFD");
+
+	srand(1);
+	for (i = 0; i < 3000; i++) {
+		enum utfconv_type at = types[rand() % 8];
+		enum utfconv_type bt = types[rand() % 8];
+		void *as, *bs;
+		size_t an, bn;
+
+		alen = rand() % 12;
+		blen = rand() % 12;
+		for (j = 0; j < alen; j++)
+			a[j] = pool[rand() % 6];
+		/* mostly a common prefix */
+		for (j = 0; j < blen; j++) {
+			b[j] = pool[rand() % 6];
+			if (j < alen && rand() % 8)
+				b[j] = a[j];
+		}
+		an = encode(&as, at, a, alen);
+		bn = encode(&bs, bt, b, blen);
+		bad += sign(utfconvcmp(as, an, at, bs, bn, bt)) !=
+		       naive(a, alen, b, blen);
+		free(as);
+		free(bs);
+	}
+	is(bad, 0, "%d", "Matches comparing the runes");
+
+	done_testing();
+}
@@ -0,0 +1,64 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+int main()
+{
+	const char *str = "a\xff" "b\xef\xbf\xbd";
+	const char16_t str16[] = {'a', 0xdc00, 'b', 0};
+	struct utfconv_opts opts = {'?', 0};
+	char32_t *ret32;
+	char16_t *ret16;
+	char *ret;
+
+	is(utfconvopts(&ret32, UTFCONV_UTF32, str, UTFCONV_UTF8, NULL), 4, "%d",
+	   "NULL options replace invalid encodings");
+	is(ret32[1], 0xfffd, "%"PRIRune, "The default replacement is U+FFFD");
+	is(ret32[3], 0xfffd, "%"PRIRune, "A literal U+FFFD is kept");
+	free(ret32);
+
+	is(utfconvopts(&ret, UTFCONV_UTF8, str, UTFCONV_UTF8, &opts), 6, "%d",
+	   "Replacing by ascii shrinks the utf-8 output");
+	ismem(ret, "a?b\xef\xbf\xbd", 7, "Invalid encodings become '?'");
+	free(ret);
+
+	opts.replacement = 0x1f600;
+	is(utfconvopts(&ret16, UTFCONV_UTF16, str16, UTFCONV_UTF16,
+	               &opts), 4, "%d",
+	   "Replacing by a supplementary rune grows the utf-16 output");
+	is(ret16[1], 0xd83d, "%x", "The replacement is a surrogate pair");
+	is(ret16[2], 0xde00, "%x", "The replacement is a surrogate pair");
+	free(ret16);
+	is(utfconvopts(&ret16, UTFCONV_UTF16, "\xff\xff\xff\xff",
+	               UTFCONV_UTF8, &opts), 8, "%d",
+	   "Every invalid byte can grow into a surrogate pair");
+	ok(ret16[6] == 0xd83d && ret16[7] == 0xde00 && !ret16[8],
+	   "The utf-16 output fits the pairs");
+	free(ret16);
+
+	opts.strict = 1;
+	is(utfconvopts(&ret32, UTFCONV_UTF32, str, UTFCONV_UTF8, &opts), -1,
+	   "%d", "Strict conversion fails on an invalid encoding");
+	ok(!ret32, "Strict conversion returns NULL");
+	is(utfconvopts(&ret32, UTFCONV_UTF32, str + 2, UTFCONV_UTF8, &opts), 2,
+	   "%d", "Strict conversion succeeds on valid input");
+	free(ret32);
+
+	opts.strict = 0;
+	opts.replacement = 0xd800;
+	is(utfconvopts(&ret32, UTFCONV_UTF32, str, UTFCONV_UTF8, &opts), -1,
+	   "%d", "A surrogate isn't a valid replacement");
+
+	Runeerror = '?';
+	is(utfconvopts(&ret32, UTFCONV_UTF32, str, UTFCONV_UTF8, NULL), 4, "%d",
+	   "Runeerror doesn't affect utfconvopts()");
+	is(ret32[1], 0xfffd, "%"PRIRune, "Runeerror doesn't affect utfconvopts()");
+	free(ret32);
+	is(utfconv(&ret, UTFCONV_UTF8, str, UTFCONV_UTF8), 6, "%d",
+	   "utfconv() still uses Runeerror");
+	ismem(ret, "a?b\xef\xbf\xbd", 7, "utfconv() still uses Runeerror");
+	free(ret);
+	Runeerror = 0xfffd;
+
+	done_testing();
+}
@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include "tap.h"
+#include "utf.h"
+
+/* convert n bytes and compare the result with len code units at expected */
+static int conv_is(enum utfconv_type rettype, const void *str, size_t n,
+                   enum utfconv_type strtype, const void *expected,
+                   size_t len, size_t unit)
+{
+	void *ret;
+	int retval = utfnconv(&ret, rettype, str, n, strtype, NULL);
+
+	if (retval < 0)
+		return 0;
+	retval = (size_t)retval == len && !memcmp(ret, expected, len * unit);
+	free(ret);
+	return retval;
+}
+
+/* convert n bytes to a utf-8 variant and back, return 1 if nothing changed */
+static int round_trip(enum utfconv_type via, const void *str, size_t n,
+                      enum utfconv_type strtype, size_t unit)
+{
+	struct utfconv_opts strict = { 0xfffd, 1 };
+	void *tmp, *ret;
+	int len, retval;
+
+	len = utfnconv(&tmp, via, str, n, strtype, &strict);
+	if (len < 0)
+		return 0;
+	retval = utfnconv(&ret, strtype, tmp, len, via, &strict);
+	retval = retval >= 0 && (size_t)retval * unit == n &&
+	         !memcmp(ret, str, n);
+	free(tmp);
+	free(ret);
+	return retval;
+}
+
+int main()
+{
+	static const enum utfconv_type variants[] = {
+		UTFCONV_MUTF8, UTFCONV_CESU8, UTFCONV_WTF8
+	};
+	static const char16_t lone16[] = { 'a', 0xd800, 'b' };
+	static const char16_t pair16[] = { 0xfffd, 0xde00 };
+	static const char16_t lone16be[] = { 0x6100, 0x00d8 };
+	struct utfconv_opts strict = { 0xfffd, 1 };
+	struct utftranscode_opts opts = { 5, 0, 0, NULL };
+	static char text[3000], out[3000];
+	struct utfwriter wr;
+	char16_t s16[32];
+	Rune runes[32];
+	size_t i, j, n;
+	int bad = 0, len, in;
+	char *ret;
+	FILE *fp;
+
+	ok(conv_is(UTFCONV_MUTF8, "a\0b", 3, UTFCONV_UTF8, "a\xc0\x80" "b", 4,
+	           1), "Modified utf-8 writes null as 0xc0 0x80");
+	ok(conv_is(UTFCONV_UTF8, "a\xc0\x80", 3, UTFCONV_MUTF8, "a", 2, 1),
+	   "Modified utf-8 reads 0xc0 0x80 as null");
+	ok(conv_is(UTFCONV_CESU8, "\xf0\x9f\x98\x80", 4, UTFCONV_UTF8,
+	           "\xed\xa0\xbd\xed\xb8\x80", 6, 1),
+	   "Cesu-8 writes runes above U+FFFF as surrogates");
+	ok(conv_is(UTFCONV_UTF8, "\xed\xa0\xbd\xed\xb8\x80", 6,
+	           UTFCONV_MUTF8, "\xf0\x9f\x98\x80", 4, 1),
+	   "Modified utf-8 reads pairs of surrogates");
+	ok(conv_is(UTFCONV_WTF8, "\xf0\x9f\x98\x80", 4, UTFCONV_UTF8,
+	           "\xf0\x9f\x98\x80", 4, 1), "Wtf-8 writes runes as utf-8");
+	ok(conv_is(UTFCONV_WTF8, lone16, 6, UTFCONV_UTF16,
+	           "a\xed\xa0\x80" "b", 5, 1), "Wtf-8 keeps lone surrogates");
+	ok(conv_is(UTFCONV_MUTF8, lone16, 6, UTFCONV_UTF16,
+	           "a\xed\xa0\x80" "b", 5, 1),
+	   "Modified utf-8 keeps lone surrogates");
+	ok(conv_is(UTFCONV_CESU8, lone16, 6, UTFCONV_UTF16,
+	           "a\xef\xbf\xbd" "b", 5, 1),
+	   "Cesu-8 replaces lone surrogates");
+	ok(conv_is(UTFCONV_UTF16, "a\xed\xa0\x80" "b", 5, UTFCONV_WTF8,
+	           lone16, 3, 2), "Lone surrogates are kept in utf-16");
+	ok(conv_is(UTFCONV_UTF16BE, "a\xed\xa0\x80", 4, UTFCONV_WTF8,
+	           lone16be, 2, 2), "Lone surrogates are kept in utf-16be");
+	ok(conv_is(UTFCONV_UTF8, "a\xed\xa0\x80" "b", 5, UTFCONV_WTF8,
+	           "a\xef\xbf\xbd" "b", 5, 1),
+	   "Lone surrogates are invalid in utf-8");
+	ok(conv_is(UTFCONV_UTF16, "\xed\xa0\xbd\xed\xb8\x80", 6, UTFCONV_WTF8,
+	           pair16, 2, 2), "Wtf-8 has no pairs of surrogates");
+	ok(conv_is(UTFCONV_UTF8, "\xf0\x9f\x98\x80", 4, UTFCONV_CESU8,
+	           "\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbd", 12, 1),
+	   "Cesu-8 has no 4-byte sequences");
+	ok(utfnconv(&ret, UTFCONV_UTF8, "\xc0\x80", 2, UTFCONV_WTF8,
+	            &strict) < 0 && !ret, "Only modified utf-8 has 0xc0 0x80");
+	ok(utfconv(&ret, UTFCONV_MUTF8, "a\xc3\xa4", UTFCONV_UTF8) == 3 &&
+	   !strcmp(ret, "a\xc3\xa4"), "Converts terminated strings");
+	free(ret);
+	ok(utfhash("\xed\xa0\xbd\xed\xb8\x80", 6, UTFCONV_CESU8, 0) ==
+	   utfhash("\xf0\x9f\x98\x80", 4, UTFCONV_UTF8, 0),
+	   "Hashes the same runes equally");
+
+	srand(1);
+	for (i = 0; i < 3000; i++) {
+		n = rand() % 32;
+		for (j = 0; j < n; j++) {
+			int r = rand() % 8;
+
+			runes[j] = r < 3 ? (Rune)(rand() % 0x80) :
+			           r < 6 ? (Rune)(0x80 + rand() % 0xd000) :
+			           (Rune)(0x10000 + rand() % 0x100000);
+			/* utf-16 with lone surrogates now and then */
+			s16[j] = (r == 7) ? 0xd800 + rand() % 0x800 :
+			                    'a' + rand() % 0x100;
+		}
+		for (j = 0; j < 3; j++)
+			bad += !round_trip(variants[j], runes, n * 4,
+			                   UTFCONV_UTF32, 4);
+		bad += !round_trip(UTFCONV_WTF8, s16, n * 2, UTFCONV_UTF16, 2);
+		bad += !round_trip(UTFCONV_MUTF8, s16, n * 2, UTFCONV_UTF16,
+		                   2);
+	}
+	is(bad, 0, "%d", "Converts there and back without losses");
+
+	/* pairs split between chunks */
+	for (n = 0; n + 7 <= sizeof(text); n += 7)
+		memcpy(text + n, "a\xed\xa0\xbd\xed\xb8\x80", 7);
+	len = utfnconv(&ret, UTFCONV_UTF8, text, n, UTFCONV_CESU8, NULL);
+	fp = tmpfile();
+	fwrite(text, 1, n, fp);
+	fflush(fp);
+	in = dup(fileno(fp));
+	lseek(in, 0, SEEK_SET);
+	fclose(fp);
+	fp = tmpfile();
+	ok(!utftranscode(fileno(fp), UTFCONV_UTF8, in, UTFCONV_CESU8, &opts,
+	                 NULL), "Transcodes cesu-8");
+	rewind(fp);
+	ok(fread(out, 1, sizeof(out), fp) == (size_t)len &&
+	   !memcmp(out, ret, len), "Pairs may be split between chunks");
+	free(ret);
+	close(in);
+	rewind(fp);
+	ftruncate(fileno(fp), 0);
+
+	ok(!utfwriterfile(&wr, fp, UTFCONV_MUTF8) &&
+	   utfputrune(&wr, 0x1f600) == 6 && utfputrune(&wr, 0) == 2 &&
+	   utfputrune(&wr, 0xdc00) == 3 && !utfwriterfree(&wr),
+	   "Writes modified utf-8");
+	rewind(fp);
+	ok(fread(out, 1, sizeof(out), fp) == 11 &&
+	   !memcmp(out, "\xed\xa0\xbd\xed\xb8\x80\xc0\x80\xed\xb0\x80", 11),
+	   "Writes the encoded runes");
+	fclose(fp);
+
+	done_testing();
+}
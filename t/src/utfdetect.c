@@ -0,0 +1,73 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+static void test_detect(const char *str, size_t n, enum utfconv_type type,
+                        size_t bomlen, const char *msg)
+{
+	size_t bom = 99;
+
+	ok(utfdetect(str, n, &bom) == type && bom == bomlen, "%s", msg);
+}
+
+int main()
+{
+	char big[8192];
+	char *ret;
+	char16_t *ret16;
+	size_t i;
+
+	test_detect("\xef\xbb\xbf" "abc", 6, UTFCONV_UTF8, 3, "UTF-8 BOM");
+	test_detect("\xff\xfe" "a\0", 4, UTFCONV_UTF16LE, 2, "UTF-16LE BOM");
+	test_detect("\xfe\xff\0a", 4, UTFCONV_UTF16BE, 2, "UTF-16BE BOM");
+	test_detect("\xff\xfe\0\0" "a\0\0\0", 8, UTFCONV_UTF32LE, 4,
+	            "UTF-32LE BOM");
+	test_detect("\0\0\xfe\xff\0\0\0a", 8, UTFCONV_UTF32BE, 4,
+	            "UTF-32BE BOM");
+
+	test_detect("", 0, UTFCONV_UTF8, 0, "Nothing is UTF-8");
+	test_detect("abc \xc3\xa4", 6, UTFCONV_UTF8, 0, "Plain UTF-8");
+	test_detect("a\0b\0c\0\xe4\0", 8, UTFCONV_UTF16LE, 0, "Plain UTF-16LE");
+	test_detect("\0a\0b\0c\0\xe4", 8, UTFCONV_UTF16BE, 0, "Plain UTF-16BE");
+	test_detect("a\0\0\0\x00\xf6\x01\0", 8, UTFCONV_UTF32LE, 0,
+	            "Plain UTF-32LE");
+	test_detect("\0\0\0a\0\x01\xf6\0", 8, UTFCONV_UTF32BE, 0,
+	            "Plain UTF-32BE");
+	test_detect("\x2d\x4e\x87\x65", 4, UTFCONV_UTF16LE, 0,
+	            "UTF-16 without null bytes");
+	test_detect("\xff\xdc\xff\xdc\xff", 5, UTFCONV_UTF8, 0,
+	            "Garbage is UTF-8");
+	test_detect("abc\0defg", 8, UTFCONV_UTF8, 0,
+	            "A stray null byte is UTF-8");
+
+	/* a rune cut off at the end of the examined prefix is fine */
+	for (i = 0; i + 3 <= sizeof(big); i += 3)
+		memcpy(big + i, "\xe2\x82\xac", 3);
+	test_detect(big, i, UTFCONV_UTF8, 0, "Only a prefix is examined");
+	for (i = 0; i < sizeof(big); i += 2)
+		memcpy(big + i, "a\0", 2);
+	big[sizeof(big) - 1] = 1;
+	test_detect(big, sizeof(big), UTFCONV_UTF16LE, 0,
+	            "Bytes after the prefix don't matter");
+
+	is(utfnconv(&ret, UTFCONV_UTF8, "\xff\xfe" "a\0\xe4\0", 6,
+	            UTFCONV_AUTO, NULL), 3, "%d", "utfnconv() detects");
+	ok(!strcmp(ret, "a\xc3\xa4"), "utfnconv() skips the BOM");
+	free(ret);
+	is(utfnconv(&ret, UTFCONV_UTF8, "a\0b", 3, UTFCONV_UTF8, NULL), 3,
+	   "%d", "utfnconv() converts null characters");
+	ok(!memcmp(ret, "a\0b", 4), "utfnconv() terminates");
+	free(ret);
+	is(utfnconv(&ret16, UTFCONV_UTF16, "a\0b", 3, UTFCONV_UTF16LE, NULL),
+	   2, "%d", "A partial code unit is replaced");
+	ok(ret16[0] == 'a' && ret16[1] == 0xfffd && !ret16[2],
+	   "A partial code unit is replaced by U+FFFD");
+	free(ret16);
+	ok(utfnconv(&ret16, UTFCONV_UTF16, "a\0b", 3, UTFCONV_UTF16LE,
+	            &(struct utfconv_opts){ 0xfffd, 1 }) == -1 && !ret16,
+	   "A partial code unit is invalid when strict");
+	ok(utfconv(&ret, UTFCONV_UTF8, "abc", UTFCONV_AUTO) == -1,
+	   "utfconv() can't detect");
+
+	done_testing();
+}
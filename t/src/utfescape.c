@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+/* pieces of strings and their escapes for json, ascii json and xml */
+static const char *const pieces[][4] = {
+	{ "abcdefghijklmnopqrstuvwxyz", NULL, NULL, NULL },
+	{ "a", NULL, NULL, NULL },
+	{ "\"", "\\\"", "\\\"", "&quot;" },
+	{ "\\", "\\\\", "\\\\", NULL },
+	{ "\n", "\\n", "\\n", NULL },
+	{ "\x01", "\\u0001", "\\u0001", "\xef\xbf\xbd" },
+	{ "<", NULL, NULL, "&lt;" },
+	{ "&", NULL, NULL, "&amp;" },
+	{ "'", NULL, NULL, "&#39;" },
+	{ "\xc3\xa4", NULL, "\\u00e4", NULL },
+	{ "\xf0\x9f\x98\x80", NULL, "\\ud83d\\ude00", NULL },
+	{ "\xef\xbf\xbf", NULL, "\\uffff", "\xef\xbf\xbd" },
+	{ "\xff", "\xef\xbf\xbd", "\\ufffd", "\xef\xbf\xbd" },
+	{ "\xe2\x82", "\xef\xbf\xbd\xef\xbf\xbd", "\\ufffd\\ufffd",
+	  "\xef\xbf\xbd\xef\xbf\xbd" }
+};
+
+/* escape a string and compare it with expected */
+static int escape_is(const char *str, enum utfescape_type type,
+                     const struct utfconv_opts *opts, const char *expected)
+{
+	size_t len, n = strlen(str);
+	char *ret = utfescape(str, n, type, opts, &len);
+	int retval = ret && len == strlen(expected) &&
+	             !memcmp(ret, expected, len);
+
+	if (ret != str)
+		free(ret);
+	return retval;
+}
+
+int main()
+{
+	static const char clean[] = "Nothing to escape, even \xc3\xa4";
+	struct utfconv_opts strict = { 0xfffd, 1 }, quote = { '"', 0 };
+	static char str[2000], expected[3][8000];
+	size_t i, j, k, n, len;
+	int bad = 0;
+
+	ok(utfescape(clean, strlen(clean), UTFESCAPE_JSON, NULL, &len) ==
+	   clean && len == strlen(clean),
+	   "Returns the string itself if nothing needs escaping");
+	ok(escape_is("say \"hi\"\t\\", UTFESCAPE_JSON, NULL,
+	             "say \\\"hi\\\"\\t\\\\"), "Escapes json");
+	ok(escape_is("\x1f\b\f\r", UTFESCAPE_JSON, NULL, "\\u001f\\b\\f\\r"),
+	   "Escapes control characters in json");
+	ok(escape_is("\xc3\xa4\xf0\x9f\x98\x80", UTFESCAPE_JSON_ASCII, NULL,
+	             "\\u00e4\\ud83d\\ude00"), "Escapes all but ascii");
+	ok(escape_is("<a href='x'>&\t</a>", UTFESCAPE_XML, NULL,
+	             "&lt;a href=&#39;x&#39;&gt;&amp;\t&lt;/a&gt;"),
+	   "Escapes xml");
+	ok(!utfescape("a\xff", 2, UTFESCAPE_JSON, &strict, NULL),
+	   "Fails on invalid encodings when strict");
+	ok(!utfescape("a\x01", 2, UTFESCAPE_XML, &strict, NULL),
+	   "Fails on control characters in xml when strict");
+	ok(escape_is("a\xff", UTFESCAPE_JSON, &quote, "a\\\""),
+	   "Escapes the replacement");
+	quote.replacement = 0;
+	ok(!utfescape("a", 1, UTFESCAPE_XML, &quote, NULL),
+	   "Fails on replacements xml can't hold");
+
+	srand(1);
+	for (i = 0; i < 3000; i++) {
+		size_t m = sizeof(pieces) / sizeof(*pieces);
+
+		str[0] = '\0';
+		for (k = 0; k < 3; k++)
+			expected[k][0] = '\0';
+		n = rand() % 60;
+		for (j = 0; j < n; j++) {
+			const char *const *p = pieces[rand() % m];
+
+			strcat(str, p[0]);
+			for (k = 0; k < 3; k++)
+				strcat(expected[k], p[k + 1] ? p[k + 1] : p[0]);
+		}
+		bad += !escape_is(str, UTFESCAPE_JSON, NULL, expected[0]);
+		bad += !escape_is(str, UTFESCAPE_JSON_ASCII, NULL,
+		                  expected[1]);
+		bad += !escape_is(str, UTFESCAPE_XML, NULL, expected[2]);
+	}
+	is(bad, 0, "%d", "Matches escaping the pieces one by one");
+
+	done_testing();
+}
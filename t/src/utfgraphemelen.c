@@ -0,0 +1,89 @@
+#include "tap.h"
+#include "utf.h"
+
+struct expected_cluster {
+	size_t size;
+	const char *name;
+};
+
+#define grapheme_check(desc, str, ...)                                   \
+	(grapheme_check)((desc), (str),                                  \
+	                 sizeof((struct expected_cluster[]){__VA_ARGS__}) / \
+	                 sizeof(struct expected_cluster),                   \
+	                 ((struct expected_cluster[]){__VA_ARGS__}))
+
+void (grapheme_check)(const char *desc, const char *str, size_t num,
+                      struct expected_cluster *expected_clusters)
+{
+	const char *cluster;
+	size_t i, size, off = 0, len = strlen(str);
+
+	is(utfgraphemelen(str, len), num, "%zu",
+	   "%s consists of %zu grapheme cluster%s", desc, num,
+	   num > 1 ? "s" : "");
+	loop_graphemes(i, cluster, size, str, len, {
+		if (i >= num) {
+			ok(0, "Don't read past %s", desc);
+			break;
+		}
+		if (cluster != str + off)
+			ok(0, "%zu. Cluster of %s follows the last one", i + 1,
+			   desc);
+		off += size;
+		is(size, expected_clusters[i].size, "%zu",
+		   "%zu. Cluster of %s is: %s", i + 1, desc,
+		   expected_clusters[i].name);
+	});
+}
+
+int main()
+{
+	grapheme_check("ascii", "ab\r\nc",
+	               {1, "a"}, {1, "b"}, {2, "CR LF"}, {1, "c"},
+	);
+
+	grapheme_check("combining marks", "e\xcc\x81\xcc\xa3x",
+	               {5, "e + U+0301 + U+0323"}, {1, "x"},
+	);
+
+	grapheme_check("CR before a combining mark", "\r\xcc\x81",
+	               {1, "CR"}, {2, "U+0301"},
+	);
+
+	grapheme_check("hangul jamo", "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8"
+	               "\xea\xb0\x80\xe1\x86\xa8",
+	               {9, "L V T"}, {6, "LV T"},
+	);
+
+	grapheme_check("regional indicators",
+	               "\xf0\x9f\x87\xa9\xf0\x9f\x87\xaa\xf0\x9f\x87\xaa",
+	               {8, "U+1F1E9 U+1F1EA"}, {4, "U+1F1EA"},
+	);
+
+	grapheme_check("an emoji zwj sequence",
+	               "\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x92\xbb!",
+	               {11, "U+1F469 ZWJ U+1F4BB"}, {1, "!"},
+	);
+
+	grapheme_check("a zwj without emoji", "a\xe2\x80\x8d\xf0\x9f\x92\xbb",
+	               {4, "a ZWJ"}, {4, "U+1F4BB"},
+	);
+
+	grapheme_check("a prepended concatenation mark",
+	               "\xd8\x80" "1",
+	               {3, "U+0600 + 1"},
+	);
+
+	grapheme_check("a spacing mark", "\xe0\xa4\x95\xe0\xa4\xbe",
+	               {6, "U+0915 + U+093E"},
+	);
+
+	grapheme_check("malformed sequences", "a\xff\xcc\x81",
+	               {1, "a"}, {3, "Runeerror + U+0301"},
+	);
+
+	is(utfgraphemenext("", 0), 0, "%zu",
+	   "An empty string has no grapheme cluster");
+
+	done_testing();
+}
@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+static const enum utfconv_type types[] = {
+	UTFCONV_UTF8, UTFCONV_UTF16, UTFCONV_UTF16LE, UTFCONV_UTF16BE,
+	UTFCONV_UTF32, UTFCONV_UTF32LE, UTFCONV_UTF32BE, UTFCONV_WCHAR
+};
+
+/* convert n runes to a type and return the size in bytes */
+static size_t encode(void *ret, enum utfconv_type type, const Rune *runes,
+                     size_t n)
+{
+	static const size_t unit[] = {
+		1, 2, 2, 2, 4, 4, 4, sizeof(wchar_t)
+	};
+	int len = utfnconv(ret, type, runes, n * sizeof(*runes),
+	                   UTFCONV_UTF32, NULL);
+
+	return len * unit[type];
+}
+
+/* hash n bytes in pieces of random sizes, at any alignment */
+static uint64_t hash_pieces(const void *str, size_t n, enum utfconv_type type,
+                            uint64_t seed)
+{
+	const char *s = str;
+	struct utfhash st;
+
+	utfhashinit(&st, type, seed);
+	while (n) {
+		size_t k = rand() % (n + 1);
+
+		utfhashupdate(&st, s, k);
+		s += k;
+		n -= k;
+	}
+	return utfhashfinal(&st);
+}
+
+int main()
+{
+	static const Rune pool[] = { 'a', 'b', 0xe4, 0xffff, 0x10000, 0xe000 };
+	static char odd[24 * 4 + 1];
+	Rune runes[24];
+	size_t i, j, n;
+	int bad = 0, split = 0, unaligned = 0;
+
+	ok(utfhash("", 0, UTFCONV_UTF8, 0) ==
+	   utfhash(NULL, 0, UTFCONV_UTF16, 0), "Empty strings hash equally");
+	ok(utfhash("ab", 2, UTFCONV_UTF8, 0) !=
+	   utfhash("ba", 2, UTFCONV_UTF8, 0), "The order of runes matters");
+	ok(utfhash("a", 1, UTFCONV_UTF8, 0) != utfhash("a", 2, UTFCONV_UTF8, 0),
+	   "A trailing null rune matters");
+	ok(utfhash("ab", 2, UTFCONV_UTF8, 0) !=
+	   utfhash("ab", 2, UTFCONV_UTF8, 1), "The seed matters");
+	ok(utfhash("ab", 2, UTFCONV_UTF8, 0) ==
+	   utfhash("\xff\xfe" "a\0b\0", 6, UTFCONV_AUTO, 0),
+	   "Detects encodings");
+	ok(utfhash("a\xff", 2, UTFCONV_UTF8, 0) ==
+	   utfhash("a\xef\xbf\xbd", 4, UTFCONV_UTF8, 0),
+	   "Invalid encodings hash as U+FFFD");
+	ok(utfhash("a\0\x3d", 3, UTFCONV_UTF16LE, 0) ==
+	   utfhash("a\xef\xbf\xbd", 4, UTFCONV_UTF8, 0),
+	   "A code unit cut off hashes as U+FFFD");
+
+	srand(1);
+	for (i = 0; i < 2000; i++) {
+		uint64_t h;
+		void *s;
+		size_t len;
+
+		n = rand() % 24;
+		for (j = 0; j < n; j++)
+			runes[j] = (rand() % 4) ? (Rune)('a' + rand() % 26) :
+			           pool[rand() % 6];
+		h = utfhash(runes, n * sizeof(*runes), UTFCONV_UTF32, 7);
+		for (j = 0; j < 8; j++) {
+			len = encode(&s, types[j], runes, n);
+			bad += utfhash(s, len, types[j], 7) != h;
+			split += hash_pieces(s, len, types[j], 7) != h;
+			/* an odd offset misaligns every code unit */
+			memcpy(odd + 1, s, len);
+			unaligned += utfhash(odd + 1, len, types[j], 7) != h;
+			free(s);
+		}
+		if (n) {
+			runes[rand() % n] ^= 1;
+			bad += utfhash(runes, n * sizeof(*runes),
+			               UTFCONV_UTF32, 7) == h;
+		}
+	}
+	is(bad, 0, "%d", "The same runes hash equally in every encoding");
+	is(split, 0, "%d", "Hashing in pieces matches hashing at once");
+	is(unaligned, 0, "%d", "Strings at odd offsets hash the same");
+
+	done_testing();
+}
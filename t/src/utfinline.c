@@ -0,0 +1,148 @@
+#define UTF_INLINE
+#include "tap.h"
+#include "utf.h"
+
+struct encoding {
+	Rune rune;
+	const char *str;
+};
+
+/* the size of the encoding a byte leads, 0 if it can't lead */
+static size_t lead_size(unsigned char c)
+{
+	if (c < 0x80)
+		return 1;
+	if (c >= 0xc0 && c < 0xe0)
+		return 2;
+	if (c >= 0xe0 && c < 0xf0)
+		return 3;
+	if (c >= 0xf0 && c < 0xf8)
+		return 4;
+	return 0;
+}
+
+/* decode n bytes the way the standard describes it */
+static int naive_decode(Rune *rune, const unsigned char *s, size_t n)
+{
+	static const Rune min[] = { 0, 0, 0x80, 0x800, 0x10000 };
+	size_t len, i;
+	Rune c;
+
+	*rune = Runeerror;
+	if (!n)
+		return 0;
+	len = lead_size(s[0]);
+	if (len == 1) {
+		*rune = s[0];
+		return 1;
+	}
+	if (!len || n < len)
+		return 1;
+	c = s[0] & (0x7f >> len);
+	for (i = 1; i < len; i++) {
+		if ((s[i] & 0xc0) != 0x80)
+			return 1;
+		c = c << 6 | (s[i] & 0x3f);
+	}
+	if (c < min[len] || c > 0x10ffff || (c >= 0xd800 && c < 0xe000))
+		return 1;
+	*rune = c;
+	return len;
+}
+
+int main()
+{
+	static const struct encoding valid[] = {
+		{0x0000, "\x00"}, {0x007f, "\x7f"}, {0x0080, "\xc2\x80"},
+		{0x00e4, "\xc3\xa4"}, {0x07ff, "\xdf\xbf"},
+		{0x0800, "\xe0\xa0\x80"}, {0xd7ff, "\xed\x9f\xbf"},
+		{0xe000, "\xee\x80\x80"}, {0xfffd, "\xef\xbf\xbd"},
+		{0xffff, "\xef\xbf\xbf"}, {0x10000, "\xf0\x90\x80\x80"},
+		{0x1f600, "\xf0\x9f\x98\x80"}, {0x10ffff, "\xf4\x8f\xbf\xbf"}
+	};
+	static const Rune invalid[] = { 0xd800, 0xdfff, 0x110000, 0xffffffff };
+	static const char *const malformed[] = {
+		"\x80", "\xbf", "\xc0\x80", "\xc1\xbf", "\xe0\x80\x80",
+		"\xed\xa0\x80", "\xed\xbf\xbf", "\xf0\x80\x80\x80",
+		"\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xf8", "\xff",
+		"\xc3" "a", "\xe2\x82" "a"
+	};
+	size_t i, n, bad = 0;
+	Rune r;
+
+	for (i = 0; i < sizeof(valid) / sizeof(*valid); i++) {
+		char buf[UTFmax];
+		int len = strlen(valid[i].str) + !valid[i].rune;
+
+		r = valid[i].rune;
+		bad += runetochar(buf, &r) != len ||
+		       memcmp(buf, valid[i].str, len) ||
+		       chartorune(&r, valid[i].str) != len ||
+		       r != valid[i].rune ||
+		       charntorune(&r, valid[i].str, len) != len ||
+		       r != valid[i].rune || !fullrune(valid[i].str, len) ||
+		       (len > 1 && fullrune(valid[i].str, len - 1)) ||
+		       !validrune(valid[i].rune);
+	}
+	is(bad, (size_t)0, "%zu", "Encodes and decodes the boundaries");
+
+	bad = 0;
+	for (i = 0; i < sizeof(invalid) / sizeof(*invalid); i++) {
+		char buf[UTFmax];
+
+		r = invalid[i];
+		bad += runetochar(buf, &r) != 3 ||
+		       memcmp(buf, "\xef\xbf\xbd", 3) || validrune(invalid[i]);
+	}
+	is(bad, (size_t)0, "%zu", "Encodes invalid runes as U+FFFD");
+
+	bad = 0;
+	for (i = 0; i < sizeof(malformed) / sizeof(*malformed); i++) {
+		n = strlen(malformed[i]);
+		bad += chartorune(&r, malformed[i]) != 1 || r != Runeerror ||
+		       charntorune(&r, malformed[i], n) != 1 ||
+		       r != Runeerror;
+	}
+	is(bad, (size_t)0, "%zu", "Malformed sequences are one Runeerror");
+	ok(charntorune(&r, "a", 0) == 0 && r == Runeerror,
+	   "Nothing decodes to Runeerror");
+	ok(!fullrune("\xf0\x9f\x98", 3) && fullrune("\x80", 1) &&
+	   fullrune("\xf8", 1) && !fullrune("a", 0),
+	   "fullrune() looks at the leading byte");
+
+	bad = 0;
+	for (r = 0; r <= 0x110000; r++) {
+		char buf[UTFmax + 1] = {0};
+		Rune want = validrune(r) ? r : Runeerror, got;
+		int len = runetochar(buf, &r);
+
+		bad += len != naive_decode(&got, (unsigned char *)buf, len) ||
+		       got != want || chartorune(&got, buf) != len ||
+		       got != want || (runetochar)(buf, &r) != len ||
+		       (chartorune)(&got, buf) != len || got != want ||
+		       validrune(r) != (r < 0xd800 ||
+		                        (r >= 0xe000 && r <= 0x10ffff));
+	}
+	is(bad, (size_t)0, "%zu", "Every rune round trips");
+
+	bad = 0;
+	for (i = 0; i < 0x1000000; i++) {
+		unsigned char buf[UTFmax] = {i >> 16, i >> 8, i, 0};
+		const char *s = (const char *)buf;
+		Rune want, got;
+
+		for (n = 0; n <= 3; n++) {
+			int len = naive_decode(&want, buf, n);
+			size_t lead = lead_size(buf[0]);
+
+			bad += charntorune(&got, s, n) != len || got != want ||
+			       (charntorune)(&got, s, n) != len ||
+			       got != want ||
+			       fullrune(s, n) != (n && (!lead || n >= lead));
+		}
+	}
+	is(bad, (size_t)0, "%zu",
+	   "All sequences of up to 3 bytes decode like the standard says");
+
+	done_testing();
+}
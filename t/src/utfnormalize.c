@@ -0,0 +1,65 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+#define norm_check(desc, form, str, expected)                              \
+	do {                                                               \
+		size_t _len;                                               \
+		char *_ret = utfnormalize((str), strlen(str), (form), &_len); \
+		is(_len, strlen(expected), "%zu",                          \
+		   "%s has the expected size", (desc));                    \
+		ismem(_ret, (expected), _len < strlen(expected) ?          \
+		      _len : strlen(expected), "%s is normalized", (desc)); \
+		if (_ret != (str))                                         \
+			free(_ret);                                        \
+	} while (0)
+
+int main()
+{
+	const char *ascii = "plain ascii";
+	const char *nfc = "Sch\xc3\xb6n";
+	char *ret;
+	size_t len;
+
+	ok(utfnormalize(ascii, strlen(ascii), UTFNORM_NFC, &len) == ascii,
+	   "Normalized ascii isn't copied");
+	ok(utfnormalize(nfc, strlen(nfc), UTFNORM_NFC, &len) == nfc,
+	   "Normalized NFC isn't copied");
+	ret = utfnormalize(nfc, strlen(nfc), UTFNORM_NFD, &len);
+	ok(ret && ret != nfc, "NFC gets copied for NFD");
+	if (ret != nfc)
+		free(ret);
+	is(utfnormspan("ab\xcc\x81" "c", 4, UTFNORM_NFC), 1, "%zu",
+	   "The quick check stops before the starter of a combining mark");
+	is(utfnormspan("ab\x80" "c", 4, UTFNORM_NFD), 1, "%zu",
+	   "The quick check stops at malformed sequences");
+
+	norm_check("NFD of U+00F6", UTFNORM_NFD, "Sch\xc3\xb6n",
+	           "Scho\xcc\x88n");
+	norm_check("NFC of o + U+0308", UTFNORM_NFC, "Scho\xcc\x88n",
+	           "Sch\xc3\xb6n");
+	norm_check("NFC of reordered marks", UTFNORM_NFC,
+	           "a\xcc\x81\xcc\xa3", "\xe1\xba\xa1\xcc\x81");
+	norm_check("NFD of reordered marks", UTFNORM_NFD,
+	           "a\xcc\x81\xcc\xa3", "a\xcc\xa3\xcc\x81");
+	norm_check("NFD of a hangul syllable", UTFNORM_NFD, "\xea\xb0\x81",
+	           "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8");
+	norm_check("NFC of hangul jamo", UTFNORM_NFC,
+	           "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8", "\xea\xb0\x81");
+	norm_check("NFC of U+212B ANGSTROM SIGN", UTFNORM_NFC, "\xe2\x84\xab",
+	           "\xc3\x85");
+	norm_check("NFKC of U+FB01 LATIN SMALL LIGATURE FI", UTFNORM_NFKC,
+	           "\xef\xac\x81", "fi");
+	norm_check("NFC of U+FB01 LATIN SMALL LIGATURE FI", UTFNORM_NFC,
+	           "\xef\xac\x81", "\xef\xac\x81");
+	norm_check("NFKD of U+1E9B", UTFNORM_NFKD, "\xe1\xba\x9b",
+	           "s\xcc\x87");
+	norm_check("NFD of U+1E9B", UTFNORM_NFD, "\xe1\xba\x9b",
+	           "\xc5\xbf\xcc\x87");
+	norm_check("NFC of a malformed sequence", UTFNORM_NFC, "a\xff" "b",
+	           "a\xef\xbf\xbd" "b");
+	norm_check("NFC of text around a change", UTFNORM_NFC,
+	           "x\xc3\xa9y e\xcc\x81 z", "x\xc3\xa9y \xc3\xa9 z");
+
+	done_testing();
+}
@@ -0,0 +1,35 @@
+#include "tap.h"
+#include "utf.h"
+
+int main()
+{
+	const char str[] = "a\xc3\xa4\0b\xc3\xa4" "c\xa4" "0123456789\xff" "d";
+	size_t n = sizeof(str) - 1;
+
+	ok(utfnrune(str, n, 'b') == str + 4, "Finds ascii past a null byte");
+	ok(!utfnrune(str, 3, 'b'), "Stops at the given size");
+	ok(utfnrune(str, n, 0xe4) == str + 1, "Finds a multibyte rune");
+	ok(utfnrune(str, n, Runeerror) == str + 8,
+	   "Runeerror finds the first invalid encoding");
+	ok(!utfnrune(str, n, 0x10000), "Returns NULL if there is no match");
+
+	ok(utfnrrune(str, n, 'a') == str, "Finds the last ascii rune");
+	ok(utfnrrune(str, n, '0') == str + 9,
+	   "Finds ascii before a long run of other bytes");
+	ok(utfnrrune(str, n, 0xe4) == str + 5, "Finds the last multibyte rune");
+	ok(utfnrrune(str, 5, 0xe4) == str + 1, "Stops at the given size");
+	ok(utfnrrune(str, n, Runeerror) == str + 19,
+	   "Runeerror finds the last invalid encoding");
+
+	ok(utfnutf(str, n, "\xc3\xa4" "c", 3) == str + 5,
+	   "Finds a substring past a null byte");
+	ok(utfnutf(str, n, "\0b", 2) == str + 3,
+	   "Finds a substring with a null byte");
+	ok(!utfnutf(str, n, "\xa4\0", 2), "Doesn't match within a rune");
+	ok(utfnutf(str, n, "\xa4" "0", 2) == str + 8,
+	   "Matches invalid bytes at a rune boundary");
+	ok(utfnutf(str, n, "", 0) == str, "An empty substring matches");
+	ok(!utfnutf(str, 2, "a\xc3\xa4", 3), "Stops at the given size");
+
+	done_testing();
+}
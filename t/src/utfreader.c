@@ -0,0 +1,109 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include "tap.h"
+#include "utf.h"
+
+/* return a stream positioned at the start of n bytes */
+static FILE *file_of(const char *str, size_t n)
+{
+	FILE *fp = tmpfile();
+
+	fwrite(str, 1, n, fp);
+	rewind(fp);
+	return fp;
+}
+
+int main()
+{
+	const char *str = "a\xc3\xa4\n\xe2\x82\xac\xe2\x82\xac\n\xf0\x9f";
+	struct utfreader rd;
+	size_t i, len, big = 200000, lines = 0;
+	char *text, *line;
+	Rune rune;
+	FILE *fp;
+	int w, bad = 0, fds[2];
+
+	fp = file_of(str, strlen(str));
+	ok(!utfreaderfile(&rd, fp), "Reading from a stream");
+	is(utfgetrune(&rd, &rune), 1, "%d", "Reads ascii");
+	is(utfgetrune(&rd, &rune), 2, "%d", "Reads multibyte runes");
+	ok(rune == 0xe4, "Decodes the rune");
+	ok(!utfungetrune(&rd) && utfungetrune(&rd) == -1,
+	   "Pushes back the last rune once");
+	is(utfgetrune(&rd, &rune), 2, "%d", "Reads it again");
+	line = utfgetline(&rd, '\n', &len);
+	ok(line && len == 1 && *line == '\n', "Reads the rest of the line");
+	line = utfgetline(&rd, 0x20ac, &len);
+	ok(line && len == 3, "Lines can end in any rune");
+	line = utfgetline(&rd, '\n', &len);
+	ok(line && len == 4, "Reads up to the delimiter");
+	ok(utfgetrune(&rd, &rune) == 1 && rune == Runeerror,
+	   "A sequence cut off by the end is invalid");
+	is(utfgetrune(&rd, &rune), 1, "%d", "Each of its bytes");
+	is(utfgetrune(&rd, &rune), 0, "%d", "Reports the end");
+	ok(!utfgetline(&rd, '\n', &len), "No lines at the end");
+	utfreaderfree(&rd);
+	fclose(fp);
+
+	/* a rune is returned without waiting for more, a hang gets killed */
+	alarm(10);
+	pipe(fds);
+	utfreaderfd(&rd, fds[0]);
+	write(fds[1], "a", 1);
+	ok(utfgetrune(&rd, &rune) == 1 && rune == 'a',
+	   "Reads ascii from a pipe that is still open");
+	write(fds[1], "\xc3\xa4", 2);
+	ok(utfgetrune(&rd, &rune) == 2 && rune == 0xe4,
+	   "Reads multibyte runes from a pipe that is still open");
+	write(fds[1], "\xe2", 1);
+	write(fds[1], "\x82\xac", 2);
+	ok(utfgetrune(&rd, &rune) == 3 && rune == 0x20ac,
+	   "Reads runes split between writes");
+	close(fds[1]);
+	is(utfgetrune(&rd, &rune), 0, "%d", "Reports the end of the pipe");
+	utfreaderfree(&rd);
+	close(fds[0]);
+	alarm(0);
+
+	/* sequences and delimiters straddle every buffer boundary */
+	text = malloc(big);
+	for (i = 0; i + 4 <= big; i += 4)
+		memcpy(text + i, (i % 1000 == 996) ? "\xf0\x9f\x98\x80" :
+		                  (i % 12) ? "\xe2\x82\xac" "a" : "\xc3\xa4\n",
+		       4);
+	fp = file_of(text, i);
+	ok(!utfreaderfd(&rd, fileno(fp)), "Reading from a file descriptor");
+	while ((w = utfgetrune(&rd, &rune)) > 0)
+		bad += rune == Runeerror;
+	ok(!w && !bad, "Sequences split between reads are decoded");
+	utfreaderfree(&rd);
+	lseek(fileno(fp), 0, SEEK_SET);
+	utfreaderfd(&rd, fileno(fp));
+	for (len = 0; (line = utfgetline(&rd, 0x1f600, &len)); lines++)
+		/* do nothing */;
+	is(lines, (size_t)(big / 1000), "%zu",
+	   "Delimiters split between reads are found");
+	utfreaderfree(&rd);
+	fclose(fp);
+
+	memset(text, 'x', big);
+	fp = file_of(text, big);
+	utfreaderfile(&rd, fp);
+	line = utfgetline(&rd, '\n', &len);
+	ok(line && len == big && !memcmp(line, text, big),
+	   "Lines longer than the buffer are read");
+	utfreaderfree(&rd);
+	rewind(fp);
+	utfreaderfile(&rd, fp);
+	line = utfreaderpeek(&rd, 100000, &len);
+	ok(line && len >= 100000, "Peeking buffers enough");
+	utfreaderskip(&rd, len);
+	i = len;
+	ok(utfreaderpeek(&rd, big, &len) && i + len == big,
+	   "Skipping consumes the bytes");
+	utfreaderfree(&rd);
+	fclose(fp);
+	free(text);
+
+	done_testing();
+}
@@ -0,0 +1,72 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+/* append a random rune, or a random byte if @junk */
+static size_t random_rune(char *buf, int junk)
+{
+	static const Rune max[] = {0x7f, 0x7ff, 0xffff, 0x10ffff};
+	Rune rune;
+
+	if (junk) {
+		*buf = rand();
+		return 1;
+	}
+	do
+		rune = rand() % (max[rand() % 4] + 1);
+	while (!validrune(rune));
+	return runetochar(buf, &rune);
+}
+
+int main()
+{
+	char old[64], new[64];
+	size_t runes, before, after, all_before, all_after;
+	int i, bad_valid = 0, bad_delta = 0;
+
+	ok(utfnvalid("a\0\xef\xbf\xbd", 5, &runes),
+	   "A null byte and U+FFFD are valid");
+	is(runes, (size_t)3, "%zu", "utfnvalid() counts the runes");
+	ok(!utfnvalid("a\xe4\xbf" "b", 4, &runes),
+	   "A truncated sequence is invalid");
+	is(runes, (size_t)4, "%zu", "Invalid bytes count as a rune each");
+
+	/* replace the second byte of U+00E4 by the one of U+00E5 */
+	ok(utfrevalid("a\xc3\xa5z", 4, 2, 1, &runes),
+	   "Changing a continuation byte stays valid");
+	is(runes, (size_t)1, "%zu", "The window is the changed rune");
+	ok(!utfrevalid("a\xc3" "bz", 4, 2, 1, NULL),
+	   "Replacing a continuation byte by ascii is invalid");
+	ok(!utfrevalid("a\xe2\xa4z", 4, 1, 1, NULL),
+	   "Growing a lead byte is invalid");
+
+	srand(1);
+	for (i = 0; i < 100000; i++) {
+		size_t n = 0, m, off, oldlen = 0, newlen = 0, k;
+		int junk = rand() % 4 == 0;
+
+		while (n < 32)
+			n += random_rune(old + n, 0);
+		off = rand() % (n + 1);
+		while (off + oldlen < n && rand() % 3)
+			oldlen++;
+		for (k = rand() % 3; k; k--)
+			newlen += random_rune(new + off + newlen, junk);
+		memcpy(new, old, off);
+		memcpy(new + off + newlen, old + off + oldlen, n - off - oldlen);
+		m = n - oldlen + newlen;
+
+		utfnvalid(old, n, &all_before);
+		utfrevalid(old, n, off, oldlen, &before);
+		if (utfrevalid(new, m, off, newlen, &after) !=
+		    utfnvalid(new, m, &all_after))
+			bad_valid++;
+		else if (utfnvalid(new, m, NULL) &&
+		         all_after - all_before != after - before)
+			bad_delta++;
+	}
+	is(bad_valid, 0, "%d", "Revalidating random splices matches utfnvalid()");
+	is(bad_delta, 0, "%d", "The change in runes matches utfnvalid()");
+
+	done_testing();
+}
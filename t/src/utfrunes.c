@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+/* the first rune of @str that's one of @runes, the slow way */
+static size_t naive_cspan(const char *str, size_t n, const Rune *runes,
+                          size_t len)
+{
+	size_t i, off = 0, j;
+	Rune rune;
+
+	loop_runes(i, rune, str, n, {
+		for (j = 0; j < len; j++) {
+			if (rune == runes[j])
+				return off;
+		}
+		off += charntorune(&rune, str + off, n - off);
+	});
+	return n;
+}
+
+int main()
+{
+	static const char bytes[] = "a,\"\xc3\xa4\xe2\x80\x8b\xf0\x9f\x98\x80\xff";
+	const char *str = "key=\"v\xc3\xa4lue\xe2\x80\x8b\",x";
+	Rune delims[] = {'"', ',', 0x200b, 0x200b};
+	Rune quotes[] = {'"', 0xe4, 0x201c, 'k', 'e', 'y', '='};
+	Rune bad[] = {Runeerror, 0xd800, 0x110000};
+	struct runeset set;
+	size_t n = strlen(str);
+	int i, diff = 0;
+
+	ok(!runesetinit(&set, delims, 4), "runesetinit() succeeds");
+	is(set.len, (size_t)1, "%zu", "Duplicates are removed");
+	ok(utfrunes(str, n, &set) == str + 4, "utfrunes() finds ascii");
+	ok(utfrunes(str + 5, n - 5, &set) == str + 11,
+	   "utfrunes() finds U+200B");
+	is(utfcspan(str, n, &set), (size_t)4, "%zu", "utfcspan() stops at '\"'");
+	ok(!utfrunes("v\xc3\xa4lue", 6, &set), "utfrunes() returns NULL");
+	runesetfree(&set);
+
+	runesetinit(&set, quotes, 7);
+	is(utfspan(str, n, &set), (size_t)5, "%zu", "utfspan() stops at 'v'");
+	is(utfspan("\xc3\xa4\xe2\x80\x9c" "a", 6, &set), (size_t)5, "%zu",
+	   "utfspan() accepts multibyte runes");
+	is(utfspan("\xc3\xa5", 2, &set), (size_t)0, "%zu",
+	   "utfspan() checks the whole rune");
+	runesetfree(&set);
+
+	runesetinit(&set, bad, 3);
+	is(set.len, (size_t)1, "%zu", "Invalid runes are ignored");
+	is(utfcspan("ab\xc3\xa4\x80", 5, &set), (size_t)4, "%zu",
+	   "Runeerror matches invalid encodings");
+	is(utfspan("\xef\xbf\xbd\xc3", 4, &set), (size_t)4, "%zu",
+	   "Runeerror matches U+FFFD and truncated runes");
+	runesetfree(&set);
+
+	srand(1);
+	for (i = 0; i < 20000; i++) {
+		char buf[128];
+		Rune runes[4];
+		size_t j, len = rand() % 4, size = rand() % sizeof(buf);
+
+		for (j = 0; j < size; j++)
+			buf[j] = bytes[rand() % (sizeof(bytes) - 1)];
+		for (j = 0; j < len; j++)
+			charntorune(&runes[j], bytes + rand() % 10, 4);
+		runesetinit(&set, runes, len);
+		if (utfcspan(buf, size, &set) !=
+		    naive_cspan(buf, size, runes, len))
+			diff++;
+		runesetfree(&set);
+	}
+	is(diff, 0, "%d", "utfcspan() matches a naive search");
+
+	done_testing();
+}
@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+int main()
+{
+	const char *str = "a\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80" "bcdefghij";
+	size_t n = strlen(str), len, i, k, diff = 0;
+	char *sub;
+
+	is(utfseek(str, n, 0), (size_t)0, "%zu", "Skipping 0 runes stays put");
+	is(utfseek(str, n, 3), (size_t)6, "%zu", "Skips multibyte runes");
+	is(utfseek(str, n, 11), (size_t)17, "%zu", "Skips within a long run");
+	is(utfseek(str, n, 14), n, "%zu", "Stops at the end");
+	is(utfseek(str, n, 100), n, "%zu", "Stops at the end");
+	is(utfseek("\x80\x80" "a", 3, 1), (size_t)2, "%zu",
+	   "Stray continuation bytes belong to the rune before");
+
+	sub = utfsubstr(str, n, 1, 3, &len);
+	ok(sub == str + 1, "utfsubstr() starts at the rune");
+	is(len, (size_t)9, "%zu", "utfsubstr() covers the runes");
+	sub = utfsubstr(str, n, 12, 5, &len);
+	ok(sub == str + 18 && len == 1, "utfsubstr() is cut short at the end");
+
+	srand(1);
+	for (i = 0; i < 2000; i++) {
+		char buf[256];
+		size_t size = 0, off = 0;
+		Rune rune;
+
+		while (size < sizeof(buf) - UTFmax) {
+			do
+				rune = rand() % ((rand() % 2) ? 0x80 : 0x110000);
+			while (!validrune(rune));
+			size += runetochar(buf + size, &rune);
+		}
+		for (k = 0; off <= size; k++) {
+			if (utfseek(buf, size, k) != off)
+				diff++;
+			off += off < size ? charntorune(&rune, buf + off,
+			                                 size - off) : 1;
+		}
+	}
+	is(diff, (size_t)0, "%zu", "utfseek() matches charntorune()");
+
+	done_testing();
+}
@@ -0,0 +1,78 @@
+#include "tap.h"
+#include "utf.h"
+
+/* join the fields with '|' */
+static const char *join(struct utfsplit *sp)
+{
+	static char buf[256];
+	const char *field;
+	size_t len, n = 0;
+
+	while (utfsplitnext(sp, &field, &len)) {
+		if (n)
+			buf[n++] = '|';
+		memcpy(buf + n, field, len);
+		n += len;
+	}
+	buf[n] = '\0';
+	return buf;
+}
+
+/* count the fields */
+static int count(struct utfsplit *sp)
+{
+	const char *field;
+	size_t len;
+	int i = 0;
+
+	while (utfsplitnext(sp, &field, &len))
+		i++;
+	return i;
+}
+
+int main()
+{
+	const char *str = "a\xe2\x86\x92" "b\xe2\x86\x92\xe2\x86\x92" "c";
+	const char *csv = "a,b;;c, d";
+	Rune seps[] = {',', ';', ' '};
+	struct runeset set;
+	struct utfsplit sp;
+
+	utfsplitrune(&sp, str, strlen(str), 0x2192);
+	ok(!strcmp(join(&sp), "a|b||c"), "Splits at a multibyte rune");
+	utfsplitrune(&sp, str, strlen(str), 0x2192);
+	sp.collapse = 1;
+	ok(!strcmp(join(&sp), "a|b|c"), "Collapses empty fields");
+	utfsplitrune(&sp, str, strlen(str), 0x2192);
+	sp.limit = 1;
+	ok(!strcmp(join(&sp), "a|b\xe2\x86\x92\xe2\x86\x92" "c"),
+	   "The rest is the last field once the limit is hit");
+
+	utfsplitinit(&sp, "x::y:z", 6, "::", 2);
+	ok(!strcmp(join(&sp), "x|y:z"), "Splits at a substring");
+	utfsplitinit(&sp, "\xc3\xa4\xa4", 3, "\xa4", 1);
+	ok(!strcmp(join(&sp), "\xc3\xa4|"),
+	   "Only splits at rune boundaries");
+	utfsplitinit(&sp, "xy", 2, "", 0);
+	ok(!strcmp(join(&sp), "xy"), "An empty separator doesn't split");
+
+	runesetinit(&set, seps, 3);
+	utfsplitset(&sp, csv, strlen(csv), &set);
+	ok(!strcmp(join(&sp), "a|b||c||d"), "Splits at any rune of a set");
+	utfsplitset(&sp, csv, strlen(csv), &set);
+	sp.collapse = 1;
+	sp.limit = 2;
+	ok(!strcmp(join(&sp), "a|b|c, d"),
+	   "Collapsing skips separators before the rest");
+	runesetfree(&set);
+
+	utfsplitrune(&sp, "", 0, ',');
+	is(count(&sp), 1, "%d", "An empty string has one field");
+	utfsplitrune(&sp, ",", 1, ',');
+	is(count(&sp), 2, "%d", "A separator makes two fields");
+	utfsplitrune(&sp, ",,", 2, ',');
+	sp.collapse = 1;
+	is(count(&sp), 0, "%d", "Only separators collapse to no field");
+
+	done_testing();
+}
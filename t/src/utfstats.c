@@ -0,0 +1,67 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+static void test_counters(void)
+{
+	struct utfstats stats;
+	char32_t *ret;
+
+	utfstats(&stats, 0);
+	is(stats.units, (uint64_t)0, "%"PRIu64, "Reset clears the counters");
+
+	is(utflen("a\xc3\xa4"), (size_t)2, "%zu", "utflen() counts runes");
+	utfstats(&stats, 1);
+	is(stats.units, (uint64_t)3, "%"PRIu64, "utflen() adds the bytes");
+	is(stats.runes, (uint64_t)2, "%"PRIu64, "utflen() adds the runes");
+	is(stats.ascii, (uint64_t)1, "%"PRIu64, "utflen() adds the ascii runes");
+
+	is(utfconv(&ret, UTFCONV_UTF32, "a\xff\xc3\xa4", UTFCONV_UTF8), 3, "%d",
+	   "utfconv() converts");
+	free(ret);
+	utfstats(&stats, 0);
+	is(stats.units, (uint64_t)4, "%"PRIu64, "utfconv() adds the units");
+	is(stats.runes, (uint64_t)3, "%"PRIu64, "utfconv() adds the runes");
+	is(stats.ascii, (uint64_t)1, "%"PRIu64, "utfconv() adds the ascii runes");
+	is(stats.replaced, (uint64_t)1, "%"PRIu64,
+	   "utfconv() adds the replacements");
+	is(stats.allocated, (uint64_t)(5 * sizeof(char32_t)), "%"PRIu64,
+	   "utfconv() adds the allocation");
+	is(stats.conv[UTFCONV_UTF8][UTFCONV_UTF32], (uint64_t)1, "%"PRIu64,
+	   "utfconv() counts the conversion");
+
+	utfstats(NULL, 1);
+	utfnrune("abc\xc3\xa4", 5, 'b');
+	utfstats(&stats, 1);
+	is(stats.units, (uint64_t)2, "%"PRIu64,
+	   "Searches add the bytes up to the match");
+
+	utfgraphemelen("e\xcc\x81x", 4);
+	utfstats(&stats, 1);
+	ok(stats.units == 4 && stats.runes == 3 && stats.ascii == 2,
+	   "utfgraphemelen() adds the bytes and runes");
+
+	utfhash("a\xc3\xa4", 3, UTFCONV_UTF8, 0);
+	utfstats(&stats, 1);
+	ok(stats.units == 3 && stats.runes == 2 && stats.ascii == 1,
+	   "utfhash() adds the bytes and runes");
+
+	free(utfescape("a\"\xff", 3, UTFESCAPE_JSON, NULL, NULL));
+	utfstats(&stats, 1);
+	ok(stats.units == 3 && stats.runes == 3 && stats.ascii == 2 &&
+	   stats.replaced == 1 && stats.allocated,
+	   "utfescape() adds the runes and replacements");
+}
+
+int main()
+{
+	struct utfstats stats;
+
+	if (utfstats(&stats, 1))
+		test_counters();
+	else
+		ok(!stats.units && !stats.conv[0][0],
+		   "Without UTF_STATS the counters are zeroed");
+
+	done_testing();
+}
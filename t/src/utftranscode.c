@@ -0,0 +1,95 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include "tap.h"
+#include "utf.h"
+
+/* return a file descriptor of a file holding n bytes */
+static int file_of(const void *buf, size_t n)
+{
+	FILE *fp = tmpfile();
+	int fd = dup(fileno(fp));
+
+	fwrite(buf, 1, n, fp);
+	fclose(fp);
+	lseek(fd, 0, SEEK_SET);
+	return fd;
+}
+
+/* transcode in to a new file and compare it with n bytes at expected */
+static int transcode_is(int in, enum utfconv_type rettype,
+                        enum utfconv_type strtype,
+                        const struct utftranscode_opts *opts,
+                        const void *expected, size_t n)
+{
+	static char buf[1 << 16];
+	struct utftranscode_stats stats;
+	FILE *fp = tmpfile();
+	int retval;
+
+	lseek(in, 0, SEEK_SET);
+	retval = utftranscode(fileno(fp), rettype, in, strtype, opts, &stats);
+	rewind(fp);
+	retval = !retval && stats.written == n &&
+	         fread(buf, 1, sizeof(buf), fp) == n &&
+	         !memcmp(buf, expected, n);
+	fclose(fp);
+	return retval;
+}
+
+int main()
+{
+	static char text[20004];
+	struct utftranscode_opts opts = {0};
+	struct utfconv_opts strict = { 0xfffd, 1 };
+	size_t i, n = 0;
+	char16_t *utf16;
+	int in, len16;
+
+	for (i = 0; n + 7 <= 20000; i++) {
+		memcpy(text + n, "a\xc3\xa4\xf0\x9f\x98\x80", 7);
+		n += (i % 3) ? 7 : 3;
+	}
+	text[n++] = '\xc3';
+	in = file_of(text, n);
+	len16 = utfnconv(&utf16, UTFCONV_UTF16, text, n, UTFCONV_UTF8, NULL);
+
+	ok(transcode_is(in, UTFCONV_UTF16, UTFCONV_UTF8, NULL, utf16,
+	                len16 * 2), "Converts with the defaults");
+	opts.chunk = 7;
+	ok(transcode_is(in, UTFCONV_UTF16, UTFCONV_UTF8, &opts, utf16,
+	                len16 * 2), "Runes split between chunks are converted");
+	opts.workers = 3;
+	ok(transcode_is(in, UTFCONV_UTF16, UTFCONV_UTF8, &opts, utf16,
+	                len16 * 2), "Workers convert in order");
+	opts.chunk = 1000;
+	opts.workers = 1;
+	ok(transcode_is(in, UTFCONV_UTF16, UTFCONV_UTF8, &opts, utf16,
+	                len16 * 2), "A single worker converts in order");
+	opts.conv = &strict;
+	ok(!transcode_is(in, UTFCONV_UTF16, UTFCONV_UTF8, &opts, utf16,
+	                 len16 * 2), "Fails on invalid encodings when strict");
+	opts.conv = NULL;
+	close(in);
+
+	/* surrogate pairs split between chunks */
+	in = file_of(utf16, len16 * 2);
+	opts.chunk = 6;
+	opts.workers = 2;
+	memcpy(text + n - 1, "\xef\xbf\xbd", 3);
+	ok(transcode_is(in, UTFCONV_UTF8, UTFCONV_UTF16, &opts, text, n + 2),
+	   "Converts utf-16 in chunks");
+	close(in);
+	free(utf16);
+
+	in = file_of("\xff\xfe" "a\0\xe4\0", 6);
+	ok(transcode_is(in, UTFCONV_UTF8, UTFCONV_AUTO, NULL, "a\xc3\xa4", 3),
+	   "Detects the encoding");
+	close(in);
+	in = file_of("", 0);
+	opts.workers = 1;
+	ok(transcode_is(in, UTFCONV_UTF8, UTFCONV_AUTO, &opts, "", 0),
+	   "Converts empty files");
+	close(in);
+
+	done_testing();
+}
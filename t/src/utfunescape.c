@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include "tap.h"
+#include "utf.h"
+
+/* unescape a string and compare it with len bytes at expected */
+static int unescape_is(const char *str, enum utfunescape_type type,
+                       const struct utfconv_opts *opts, const char *expected,
+                       size_t len)
+{
+	static char buf[1000];
+	size_t n;
+
+	return !utfunescape(buf, sizeof(buf), str, strlen(str), type, opts,
+	                    &n) && n == len && !memcmp(buf, expected, len);
+}
+
+/* percent-encode the bytes of str that aren't ascii letters, every other */
+static size_t percent_encode(char *dest, const char *str, size_t n)
+{
+	static const char hex[] = "0123456789ABCDEF";
+	size_t i, len = 0;
+
+	for (i = 0; i < n; i++) {
+		unsigned char c = str[i];
+
+		if ((c | 0x20) >= 'a' && (c | 0x20) <= 'z' && (rand() & 1)) {
+			dest[len++] = c;
+			continue;
+		}
+		dest[len++] = '%';
+		dest[len++] = hex[c >> 4];
+		dest[len++] = hex[c & 0xf];
+	}
+	return len;
+}
+
+int main()
+{
+	static const char *const pieces[] = {
+		"abcdefghijklmnopqrstuvwxyz", "a", "\"", "\\", "\n", "\x01",
+		"/", "%", "\xc3\xa4", "\xf0\x9f\x98\x80", "\xef\xbf\xbf"
+	};
+	struct utfconv_opts strict = { 0xfffd, 1 };
+	static char str[2000], esc[12000], ret[12000];
+	char inplace[] = "caf\\u00e9 \\ud83d\\ude00\\n";
+	size_t i, j, n, len;
+	int bad = 0;
+
+	ok(unescape_is("a\\\"b\\\\c\\/\\b\\f\\n\\r\\t", UTFUNESCAPE_JSON, NULL,
+	               "a\"b\\c/\b\f\n\r\t", 11), "Unescapes json");
+	ok(unescape_is("\\u00e4\\uD83D\\uDE00\\u0000", UTFUNESCAPE_JSON,
+	               NULL, "\xc3\xa4\xf0\x9f\x98\x80", 7),
+	   "Unescapes \\u and surrogate pairs");
+	ok(unescape_is("\\ud83d!\\ude00", UTFUNESCAPE_JSON, NULL,
+	               "\xef\xbf\xbd!\xef\xbf\xbd", 7),
+	   "Lone surrogates are invalid");
+	ok(unescape_is("\\x\\u12", UTFUNESCAPE_JSON, NULL,
+	               "\xef\xbf\xbd\xef\xbf\xbd" "12", 8),
+	   "Malformed escapes are invalid");
+	ok(unescape_is("a\xff\xc3\xa4", UTFUNESCAPE_JSON, NULL,
+	               "a\xef\xbf\xbd\xc3\xa4", 6),
+	   "Invalid encodings are replaced");
+	ok(unescape_is("a%20b%C3%a4%2F", UTFUNESCAPE_PERCENT, NULL,
+	               "a b\xc3\xa4/", 6), "Unescapes percent-encoding");
+	ok(unescape_is("%C3\xa4", UTFUNESCAPE_PERCENT, NULL, "\xc3\xa4", 2),
+	   "Encoded and raw bytes make up runes together");
+	ok(unescape_is("%C3%28%ED%A0%80%", UTFUNESCAPE_PERCENT, NULL,
+	               "\xef\xbf\xbd(\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbd"
+	               "\xef\xbf\xbd", 16),
+	   "Percent-encoded bytes are validated");
+	ok(utfunescape(str, sizeof(str), "%C3", 3, UTFUNESCAPE_PERCENT,
+	               &strict, &len) < 0, "Fails when strict");
+	ok(utfunescape(str, 2, "abc", 3, UTFUNESCAPE_JSON, NULL, &len) < 0,
+	   "Fails if the result doesn't fit");
+	ok(!utfunescape(inplace, sizeof(inplace), inplace, strlen(inplace),
+	                UTFUNESCAPE_JSON, &strict, &len) && len == 11 &&
+	   !memcmp(inplace, "caf\xc3\xa9 \xf0\x9f\x98\x80\n", len),
+	   "Unescapes in place");
+	ok(utfunescape(str, 4, "\xff\xff", 2, UTFUNESCAPE_JSON, NULL, &len) ==
+	   -1, "Replacements may be longer than the input");
+	memcpy(str, "\xff\xff", 2);
+	ok(utfunescape(str, sizeof(str), str, 2, UTFUNESCAPE_JSON, NULL,
+	               &len) == -1, "They don't overwrite unread input");
+
+	srand(1);
+	for (i = 0; i < 3000; i++) {
+		size_t m = sizeof(pieces) / sizeof(*pieces);
+		char *e;
+
+		str[0] = '\0';
+		for (j = rand() % 80; j > 0; j--)
+			strcat(str, pieces[rand() % m]);
+		n = strlen(str);
+		e = utfescape(str, n, (i & 1) ? UTFESCAPE_JSON_ASCII :
+		              UTFESCAPE_JSON, NULL, &len);
+		bad += utfunescape(ret, len, e, len, UTFUNESCAPE_JSON, &strict,
+		                   &len) || len != n || memcmp(ret, str, n);
+		if (e != str)
+			free(e);
+		len = percent_encode(esc, str, n);
+		bad += utfunescape(esc, len, esc, len, UTFUNESCAPE_PERCENT,
+		                   &strict, &len) || len != n ||
+		       memcmp(esc, str, n);
+	}
+	is(bad, 0, "%d", "Undoes escaping");
+
+	done_testing();
+}
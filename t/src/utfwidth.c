@@ -0,0 +1,40 @@
+#include "tap.h"
+#include "utf.h"
+
+int main()
+{
+	const char *mixed = "ab\xe4\xb8\xad\xe6\x96\x87" "e\xcc\x81!";
+
+	is(runewidth('a'), 1, "%d", "'a' is 1 column wide");
+	is(runewidth('\t'), 0, "%d", "Control codes are 0 columns wide");
+	is(runewidth(0x7f), 0, "%d", "DELETE is 0 columns wide");
+	is(runewidth(0x0301), 0, "%d", "Combining marks are 0 columns wide");
+	is(runewidth(0x200b), 0, "%d", "ZERO WIDTH SPACE is 0 columns wide");
+	is(runewidth(0x4e2d), 2, "%d", "CJK ideographs are 2 columns wide");
+	is(runewidth(0xff21), 2, "%d", "Fullwidth forms are 2 columns wide");
+	is(runewidth(0x1f600), 2, "%d", "Emoji are 2 columns wide");
+	is(runewidth(0x2615), 2, "%d",
+	   "HOT BEVERAGE with emoji presentation is 2 columns wide");
+	is(runewidth(0x263a), 1, "%d",
+	   "WHITE SMILING FACE with text presentation is 1 column wide");
+	is(runewidth(0x1160), 0, "%d", "Hangul medial vowels are 0 columns wide");
+	is(runewidth(0x110000), 0, "%d", "Invalid runes are 0 columns wide");
+
+	is(utfwidth("", 0), 0, "%zu", "\"\" is 0 columns wide");
+	is(utfwidth("plain ascii text\n", 17), 16, "%zu",
+	   "Ascii is measured without control codes");
+	is(utfwidth(mixed, strlen(mixed)), 8, "%zu",
+	   "Mixed text is measured correctly");
+	is(utfwidth("\xff", 1), 1, "%zu", "Malformed sequences count as Runeerror");
+
+	is(utfwidthtrunc(mixed, strlen(mixed), 3), 2, "%zu",
+	   "Wide runes that don't fit in whole are cut off");
+	is(utfwidthtrunc(mixed, strlen(mixed), 7), 11, "%zu",
+	   "Combining marks stay with their base");
+	is(utfwidthtrunc(mixed, strlen(mixed), 100), strlen(mixed), "%zu",
+	   "Everything fits into enough columns");
+	is(utfwidthtrunc("0123456789abcdefgh", 18, 9), 9, "%zu",
+	   "Ascii is truncated at the exact column");
+
+	done_testing();
+}
@@ -0,0 +1,80 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include "tap.h"
+#include "utf.h"
+
+/* read back everything written to fp */
+static size_t contents(FILE *fp, char *buf, size_t size)
+{
+	size_t n;
+
+	fflush(fp);
+	rewind(fp);
+	n = fread(buf, 1, size, fp);
+	rewind(fp);
+	return n;
+}
+
+int main()
+{
+	Rune runes[] = { 'a', 0xe4, 0x20ac, 0x1f600, 0xd800 };
+	static char buf[300000], big[200000];
+	struct utfwriter wr;
+	size_t i, n;
+	char *p;
+	FILE *fp = tmpfile();
+
+	ok(!utfwriterfile(&wr, fp, UTFCONV_UTF8), "Writing utf-8 to a stream");
+	is(utfputrune(&wr, 'a'), 1, "%d", "Writes ascii");
+	is(utfputrune(&wr, 0x1f600), 4, "%d", "Writes multibyte runes");
+	is(contents(fp, buf, sizeof(buf)), (size_t)0, "%zu",
+	   "Nothing is written before flushing");
+	ok(!utfputrunes(&wr, runes, 5), "Writes rune arrays");
+	ok(!utfwriterfree(&wr), "Flushes when freed");
+	n = contents(fp, buf, sizeof(buf));
+	ok(n == 18 && !memcmp(buf, "a\xf0\x9f\x98\x80" "a\xc3\xa4\xe2\x82\xac"
+	                           "\xf0\x9f\x98\x80\xef\xbf\xbd", n),
+	   "Writes the encoded runes");
+	ftruncate(fileno(fp), 0);
+
+	ok(!utfwriterfd(&wr, fileno(fp), UTFCONV_UTF16BE),
+	   "Writing utf-16be to a file descriptor");
+	ok(!utfputrunes(&wr, runes, 5) && !utfflush(&wr),
+	   "Writes rune arrays");
+	n = contents(fp, buf, sizeof(buf));
+	ok(n == 12 && !memcmp(buf, "\0a\0\xe4\x20\xac\xd8\x3d\xde\x00\xff\xfd",
+	                      12), "Writes the code units in byte order");
+	utfwriterfree(&wr);
+	ftruncate(fileno(fp), 0);
+	ok(utfwriterfd(&wr, 1, UTFCONV_AUTO) == -1,
+	   "UTFCONV_AUTO can't be written");
+
+	/* more than fits into the buffer */
+	utfwriterfd(&wr, fileno(fp), UTFCONV_UTF32LE);
+	for (i = 0; i < 70000; i++)
+		utfputrune(&wr, 0x20ac);
+	utfwriterfree(&wr);
+	n = contents(fp, buf, sizeof(buf));
+	for (i = 0; i < n && !memcmp(buf + i, "\xac\x20\0\0", 4); i += 4)
+		/* do nothing */;
+	ok(n == 280000 && i == n, "Flushes when the buffer is full");
+	ftruncate(fileno(fp), 0);
+
+	utfwriterfd(&wr, fileno(fp), UTFCONV_UTF8);
+	memset(big, 'x', sizeof(big));
+	ok(!utfwrite(&wr, "ab", 2) && !utfwrite(&wr, big, sizeof(big)),
+	   "Writes encoded bytes");
+	p = utfwriterreserve(&wr, 100000);
+	ok(p != NULL, "Reserves room");
+	memcpy(p, "cd", 2);
+	utfwritercommit(&wr, 2);
+	p = utfwriterreserve(&wr, 100000);
+	ok(p != NULL, "Reserves room twice");
+	utfwriterfree(&wr);
+	n = contents(fp, buf, sizeof(buf));
+	ok(n == sizeof(big) + 4 && !memcmp(buf, "ab", 2) && buf[2] == 'x' &&
+	   !memcmp(buf + n - 2, "cd", 2), "Writes them in order");
+	fclose(fp);
+
+	done_testing();
+}
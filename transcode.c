@@ -0,0 +1,320 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "utf.h"
+#include "utfint.h"
+
+/* defaults of struct utftranscode_opts */
+#define TRANSCODE_CHUNK (1 << 20)
+#define TRANSCODE_INFLIGHT 2 /* chunks per worker */
+
+enum slot_state {
+	SLOT_FREE,
+	SLOT_READ,
+	SLOT_CONVERTING,
+	SLOT_CONVERTED
+};
+
+/* a chunk on its way through the pipeline */
+struct slot {
+	enum slot_state state;
+	size_t seq;  /* number of the chunk in the file */
+	char *in;    /* bytes read, with room for a carried over rune */
+	size_t len;  /* number of bytes in @in */
+	void *out;   /* converted code units, from utfnconv() */
+	size_t size; /* size of @out in bytes */
+};
+
+struct pipeline {
+	int in, out;
+	enum utfconv_type rettype, strtype;
+	const struct utfconv_opts *conv;
+	size_t chunk;
+	char carry[UTFCONVmax]; /* start of a rune cut off by the last read */
+	size_t carried;
+	int eof;                /* whether the reader reached the end */
+
+	struct slot *slots;
+	size_t nslots;
+	size_t chunks;   /* number of chunks read, final once @done is set */
+	int done;        /* whether all chunks were read */
+	int err;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	struct utftranscode_stats stats;
+};
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* read the next chunk into slot, return -1 on errors */
+static int pipeline_read(struct pipeline *pl, struct slot *slot)
+{
+	size_t len = pl->carried;
+	double start = now();
+
+	memcpy(slot->in, pl->carry, len);
+	while (len < pl->chunk && !pl->eof) {
+		ssize_t r = read(pl->in, slot->in + len, pl->chunk - len);
+
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r < 0)
+			return -1;
+		if (!r)
+			pl->eof = 1;
+		len += r;
+		pl->stats.read += r;
+	}
+	if (pl->strtype == UTFCONV_AUTO) {
+		size_t bom;
+
+		pl->strtype = utfdetect(slot->in, len, &bom);
+		memmove(slot->in, slot->in + bom, len - bom);
+		len -= bom;
+	}
+	slot->len = pl->eof ? len : chunk_cut(slot->in, len, pl->strtype);
+	pl->carried = len - slot->len;
+	memcpy(pl->carry, slot->in + slot->len, pl->carried);
+	pl->stats.read_secs += now() - start;
+	return 0;
+}
+
+/* convert a slot, return -1 on errors */
+static int pipeline_conv(struct pipeline *pl, struct slot *slot, double *secs)
+{
+	double start = now();
+	int len = utfnconv(&slot->out, pl->rettype, slot->in, slot->len,
+	                   pl->strtype, pl->conv);
+
+	*secs = now() - start;
+	if (len < 0)
+		return -1;
+	slot->size = len * unit_size(pl->rettype);
+	return 0;
+}
+
+/* write a converted slot, return -1 on errors */
+static int pipeline_write(struct pipeline *pl, struct slot *slot)
+{
+	const char *p = slot->out;
+	size_t n = slot->size;
+	double start = now();
+
+	while (n) {
+		ssize_t r = write(pl->out, p, n);
+
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r < 0)
+			return -1;
+		p += r;
+		n -= r;
+	}
+	pl->stats.written += slot->size;
+	pl->stats.write_secs += now() - start;
+	free(slot->out);
+	slot->out = NULL;
+	return 0;
+}
+
+/* read, convert and write one chunk after another in the caller */
+static int pipeline_sync(struct pipeline *pl)
+{
+	struct slot *slot = pl->slots;
+	double secs;
+
+	while (!pl->eof || pl->carried) {
+		if (pipeline_read(pl, slot))
+			return -1;
+		/* chunks are only empty at the end */
+		if (!slot->len)
+			break;
+		if (pipeline_conv(pl, slot, &secs))
+			return -1;
+		pl->stats.conv_secs += secs;
+		if (pipeline_write(pl, slot))
+			return -1;
+	}
+	return 0;
+}
+
+static void *worker(void *arg)
+{
+	struct pipeline *pl = arg;
+
+	pthread_mutex_lock(&pl->lock);
+	for (;;) {
+		struct slot *slot = NULL;
+		double secs;
+		size_t i;
+		int err;
+
+		/* the oldest chunk first, so the writer can go on */
+		for (i = 0; i < pl->nslots; i++) {
+			struct slot *s = pl->slots + i;
+
+			if (s->state == SLOT_READ &&
+			    (!slot || s->seq < slot->seq))
+				slot = s;
+		}
+		if (pl->err || (!slot && pl->done))
+			break;
+		if (!slot) {
+			pthread_cond_wait(&pl->cond, &pl->lock);
+			continue;
+		}
+		slot->state = SLOT_CONVERTING;
+		pthread_mutex_unlock(&pl->lock);
+		err = pipeline_conv(pl, slot, &secs);
+		pthread_mutex_lock(&pl->lock);
+		pl->stats.conv_secs += secs;
+		if (err)
+			pl->err = 1;
+		slot->state = SLOT_CONVERTED;
+		pthread_cond_broadcast(&pl->cond);
+	}
+	pthread_mutex_unlock(&pl->lock);
+	return NULL;
+}
+
+static void *writer(void *arg)
+{
+	struct pipeline *pl = arg;
+	size_t seq;
+
+	pthread_mutex_lock(&pl->lock);
+	for (seq = 0; !pl->err; seq++) {
+		struct slot *slot = pl->slots + seq % pl->nslots;
+		int err;
+
+		while (!pl->err && !(pl->done && seq == pl->chunks) &&
+		       !(slot->state == SLOT_CONVERTED && slot->seq == seq))
+			pthread_cond_wait(&pl->cond, &pl->lock);
+		if (pl->err || (pl->done && seq == pl->chunks))
+			break;
+		pthread_mutex_unlock(&pl->lock);
+		err = pipeline_write(pl, slot);
+		pthread_mutex_lock(&pl->lock);
+		if (err)
+			pl->err = 1;
+		slot->state = SLOT_FREE;
+		pthread_cond_broadcast(&pl->cond);
+	}
+	pthread_mutex_unlock(&pl->lock);
+	return NULL;
+}
+
+/* read in the caller while workers convert and a thread writes */
+static int pipeline_async(struct pipeline *pl, int workers)
+{
+	pthread_t *threads = malloc((workers + 1) * sizeof(*threads));
+	int started = 0, i, err;
+
+	if (!threads)
+		return -1;
+	pthread_mutex_lock(&pl->lock);
+	while (started <= workers) {
+		if (pthread_create(threads + started, NULL,
+		                   started ? worker : writer, pl)) {
+			pl->err = 1;
+			break;
+		}
+		started++;
+	}
+	while (!pl->err && (!pl->eof || pl->carried)) {
+		struct slot *slot = pl->slots + pl->chunks % pl->nslots;
+
+		while (!pl->err && slot->state != SLOT_FREE)
+			pthread_cond_wait(&pl->cond, &pl->lock);
+		if (pl->err)
+			break;
+		/* the slot is ours alone while it's free */
+		pthread_mutex_unlock(&pl->lock);
+		err = pipeline_read(pl, slot);
+		pthread_mutex_lock(&pl->lock);
+		if (err) {
+			pl->err = 1;
+			break;
+		}
+		/* chunks are only empty at the end */
+		if (!slot->len)
+			break;
+		slot->seq = pl->chunks++;
+		slot->state = SLOT_READ;
+		pthread_cond_broadcast(&pl->cond);
+	}
+	pl->done = 1;
+	pthread_cond_broadcast(&pl->cond);
+	pthread_mutex_unlock(&pl->lock);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+	free(threads);
+	return pl->err ? -1 : 0;
+}
+
+int utftranscode(int out, enum utfconv_type rettype, int in,
+                 enum utfconv_type strtype,
+                 const struct utftranscode_opts *opts,
+                 struct utftranscode_stats *stats)
+{
+	struct pipeline pl;
+	int workers = opts ? opts->workers : 0, retval = -1;
+	size_t i, inflight = opts ? opts->inflight : 0;
+
+	memset(&pl, 0, sizeof(pl));
+	pl.in = in;
+	pl.out = out;
+	pl.rettype = rettype;
+	pl.strtype = strtype;
+	pl.conv = opts ? opts->conv : NULL;
+	pl.chunk = (opts && opts->chunk) ? opts->chunk : TRANSCODE_CHUNK;
+	/* every chunk needs to fit a whole rune */
+	if (pl.chunk < UTFCONVmax)
+		pl.chunk = UTFCONVmax;
+	if (rettype >= UTFCONV_AUTO || strtype > UTFCONV_AUTO || workers < 0)
+		goto out;
+	if (!inflight)
+		inflight = workers ? workers * TRANSCODE_INFLIGHT : 1;
+	/* the writer and a worker need a chunk each besides the reader */
+	if (workers && inflight < 2)
+		inflight = 2;
+	pl.nslots = workers ? inflight : 1;
+	pl.slots = calloc(pl.nslots, sizeof(*pl.slots));
+	if (!pl.slots)
+		goto out;
+	for (i = 0; i < pl.nslots; i++) {
+		pl.slots[i].in = malloc(pl.chunk + UTFCONVmax);
+		if (!pl.slots[i].in)
+			goto out;
+	}
+	if (!workers) {
+		retval = pipeline_sync(&pl);
+		goto out;
+	}
+	if (pthread_mutex_init(&pl.lock, NULL))
+		goto out;
+	if (pthread_cond_init(&pl.cond, NULL)) {
+		pthread_mutex_destroy(&pl.lock);
+		goto out;
+	}
+	retval = pipeline_async(&pl, workers);
+	pthread_cond_destroy(&pl.cond);
+	pthread_mutex_destroy(&pl.lock);
+out:
+	for (i = 0; pl.slots && i < pl.nslots; i++) {
+		free(pl.slots[i].in);
+		free(pl.slots[i].out);
+	}
+	free(pl.slots);
+	if (stats)
+		*stats = pl.stats;
+	return retval;
+}
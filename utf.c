@@ -1,181 +1,167 @@
 #include <stdlib.h>
 #include <string.h>
 #include "utf.h"
+#include "utfint.h"
 
-union utf8 {
-	const char *cp;   /* const pointer */
-	unsigned char *p; /* pointer */
-	char *pc;         /* plain char */
-};
-
-union utf16 {
-	const char16_t *cp; /* const pointer */
-	char16_t *p;        /* pointer */
-	unsigned char *b;   /* byte buffer */
-};
-
-union utf32 {
-	const char32_t *cp; /* const pointer */
-	char32_t *p;        /* pointer */
-	unsigned char *b;   /* byte buffer */
-};
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 Rune Runeerror = 0xfffd;
 
-/* return 1 if it's just ascii */
-#define UTF8_IS_ASCII(c) (((unsigned char)(c) & 0x80) != 0x80)
+#ifdef UTF_STATS
+__thread struct utfstats utf_stats;
+#endif
 
-/* return 1 if continuation bytes are introduced */
-static inline int UTF8_IS_LEADING(unsigned char c) { return c >> 7 & c >> 6; }
+int runetochar(char *buf, Rune *rune)
+{
+	return utf_runetochar(buf, rune);
+}
 
-/* return 1 if it's a continuation byte */
-static inline int UTF8_IS_TRAILING(unsigned char c) { return c >> 7 & ~c >> 6; }
+int chartorune(Rune *rune, const char *str)
+{
+	return utf_chartorune(rune, str, Runeerror);
+}
 
-/* return 1 if it's a high surrogate */
-#define UTF16_IS_LEADING(c) (((char16_t)(c) & 0xfc00) == 0xd800)
+int charntorune(Rune *rune, const char *str, size_t n)
+{
+	return utf_charntorune(rune, str, n, Runeerror);
+}
 
-/* return 1 if it's a low surrogate */
-#define UTF16_IS_TRAILING(c) (((char16_t)(c) & 0xfc00) == 0xdc00)
+#define dec_utf8(rune, str, n, err) utf_charntorune(rune, str, n, err)
 
-/* get the max rune for rune with x continuation bytes */
-static inline Rune RuneX(int x)
+/* return the utf-8 size of a valid rune */
+static inline int runelen_valid(Rune c)
 {
-	return x ? ((1u << (6 - x + (x * 6))) - 1) : ((1u << 7) - 1);
+	return 1 + (c >= 0x80) + (c >= 0x800) + (c >= 0x10000);
 }
 
-/* return the number of trailing bytes */
-static inline int utf8_trail_cnt(unsigned char c)
+/* return 1 if a rune is invalid, without branching */
+static inline int runeinvalid(Rune c)
 {
-	if (c < 0x80)
-		return 0;
-	else if (c < 0xc0)
-		return -1;
-	else if (c < 0xe0)
-		return 1;
-	else if (c < 0xf0)
-		return 2;
-	else if (c < 0xf8)
-		return 3;
-	else if (c < 0xfc)
-		return 4;
-	else if (c < 0xfe)
-		return 5;
-	else
-		return -1;
+	return (c > Runemax) | ((c & 0xfffff800) == 0xd800);
 }
 
-int runetochar(char *buf, Rune *rune)
+int runelen(Rune rune)
 {
-	union utf8 u = {.pc = buf};
-	unsigned char *ptr, lead_byte;
-	Rune c = *rune;
-	int n, retval;
+	Rune mask = -(Rune)runeinvalid(rune);
 
-	if (c < Runeself) {
-		*u.p = c;
-		return 1;
-	} else if (!validrune(c)) {
-		c = Runeerror;
-	}
-	for (n = 1; n < UTFmax; n++) {
-		if (c <= RuneX(n))
-			break;
-	}
-	retval = n + 1;
-	ptr = (u.p += n);
-	lead_byte = (((1u << (n + 1)) - 1) << (7 - n));
-	while (n--) {
-		*ptr-- = (c & 0x3F) | 0x80;
-		c >>= 6;
-	}
-	*ptr = c | lead_byte;
-	return retval;
+	return runelen_valid((rune & ~mask) | (Runeerror & mask));
 }
 
-int chartorune(Rune *rune, const char *str)
+int runenlen(Rune *rune, int n)
 {
-	unsigned char tmp = *str++;
-	int i = 0, n = utf8_trail_cnt(tmp);
-	int retval = n + 1;
-	Rune c = tmp;
-
-	if (n > 0 && n < UTFmax) {
-		c &= ((1u << (6 - n)) - 1);
-		for (; (tmp = *str++) && i < n; i++) {
-			if (!UTF8_IS_TRAILING(tmp))
-				break;
-			c <<= 6;
-			c |= tmp & 0x3f;
-		}
-	}
-	if (n < 0 || n >= UTFmax || i < n || !validrune(c) ||
-	    (n > 0 && c <= RuneX(n - 1))) {
-		c = Runeerror;
-		retval = 1;
-	}
-	*rune = c;
-	return retval;
+	return (n > 0) ? (int)runenlen8(rune, n) : 0;
 }
 
-int charntorune(Rune *rune, const char *str, size_t n)
+#ifdef __SSE2__
+/*
+ * Sum up the sizes of runes 4 at a time, @len1 to @len4 being the sizes
+ * needed by runes of up to 7, 11, 16 and 21 bits, and @errlen the size of
+ * Runeerror that replaces invalid runes.
+ */
+static size_t runenlen_sse2(const Rune *rune, size_t n, int len1, int len2,
+                            int len3, int len4, int errlen)
 {
-	*rune = Runeerror;
-	if (!n)
-		return 0;
-	else if (!fullrune(str, n))
-		return 1;
-	else
-		return chartorune(rune, str);
+	const __m128i sign = _mm_set1_epi32((int)0x80000000);
+	const __m128i max = _mm_set1_epi32((int)(0x80000000 | Runemax));
+	const __m128i surmask = _mm_set1_epi32((int)0xfffff800);
+	const __m128i sur = _mm_set1_epi32(0xd800);
+	const __m128i lim1 = _mm_set1_epi32(0x7f);
+	const __m128i lim2 = _mm_set1_epi32(0x7ff);
+	const __m128i lim3 = _mm_set1_epi32(0xffff);
+	const __m128i d2 = _mm_set1_epi32(len2 - len1);
+	const __m128i d3 = _mm_set1_epi32(len3 - len2);
+	const __m128i d4 = _mm_set1_epi32(len4 - len3);
+	const __m128i base = _mm_set1_epi32(len1);
+	const __m128i err = _mm_set1_epi32(errlen);
+	uint32_t lanes[4];
+	size_t i = 0, total = 0;
+
+	while (n - i >= 4) {
+		/* 32-bit lanes can't overflow within a block */
+		size_t end = i + (((n - i) / 4 < 0x100000) ? (n - i) / 4 :
+		                  0x100000) * 4;
+		__m128i acc = _mm_setzero_si128();
+
+		for (; i < end; i += 4) {
+			__m128i v = _mm_loadu_si128((const __m128i *)(rune + i));
+			__m128i bad = _mm_or_si128(
+				_mm_cmpgt_epi32(_mm_xor_si128(v, sign), max),
+				_mm_cmpeq_epi32(_mm_and_si128(v, surmask), sur));
+			__m128i len = _mm_add_epi32(base, _mm_add_epi32(
+				_mm_and_si128(_mm_cmpgt_epi32(v, lim1), d2),
+				_mm_add_epi32(
+				_mm_and_si128(_mm_cmpgt_epi32(v, lim2), d3),
+				_mm_and_si128(_mm_cmpgt_epi32(v, lim3), d4))));
+
+			len = _mm_or_si128(_mm_andnot_si128(bad, len),
+			                   _mm_and_si128(bad, err));
+			acc = _mm_add_epi32(acc, len);
+		}
+		_mm_storeu_si128((__m128i *)lanes, acc);
+		total += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+	return total;
 }
+#endif
 
-int runelen(Rune rune)
+size_t runenlen8(const Rune *rune, size_t n)
 {
-	char tmp[UTFmax];
+	size_t i = 0, retval = 0;
 
-	return runetochar(tmp, &rune);
+#ifdef __SSE2__
+	i = n & ~(size_t)3;
+	retval = runenlen_sse2(rune, i, 1, 2, 3, 4, runelen(Runeerror));
+#endif
+	for (; i < n; i++)
+		retval += runelen(rune[i]);
+	return retval;
 }
 
-int runenlen(Rune *rune, int n)
+size_t runenlen16(const Rune *rune, size_t n)
 {
-	int retval = 0;
+	int errlen = (Runeerror > 0xffff) ? 2 : 1;
+	size_t i = 0, retval = 0;
 
-	while(n-- > 0)
-		retval += runelen(*rune++);
+#ifdef __SSE2__
+	i = n & ~(size_t)3;
+	retval = runenlen_sse2(rune, i, 1, 1, 1, 2, errlen);
+#endif
+	for (; i < n; i++)
+		retval += runeinvalid(rune[i]) ? errlen : 1 + (rune[i] > 0xffff);
 	return retval;
 }
 
 int fullrune(const char *str, size_t n)
 {
-	int t = utf8_trail_cnt(*str);
-
-	if (n <= 0)
-		return 0;
-	if (t < 0 || t >= UTFmax)
-		return 1;
-	else
-		return n >= (size_t)t + 1;
+	return utf_fullrune(str, n);
 }
 
 int validrune(Rune rune)
 {
-	if (rune > Runemax || (rune & 0xf800) == 0xd800)
-		return 0;
-	else
-		return 1;
+	return utf_validrune(rune);
 }
 
 size_t utflen(const char *str)
 {
+	STAT(const char *start = str; uint64_t ascii = 0);
 	size_t len;
 	Rune rune;
 
-	for (len = 0; *str; len++)
-		str += chartorune(&rune, str);
+	for (len = 0; *str; len++) {
+		int n = chartorune(&rune, str);
+
+		STAT(ascii += n == 1 && rune < 0x80);
+		str += n;
+	}
+	STAT(stats_add(str - start, len, ascii, 0, 0));
 	return len;
 }
 
 size_t utfnlen(const char *str, size_t maxlen)
 {
+	STAT(const char *start = str; uint64_t ascii = 0);
 	size_t len;
 	Rune rune;
 	int n;
@@ -183,34 +169,85 @@ size_t utfnlen(const char *str, size_t maxlen)
 	for (len = 0; (n = charntorune(&rune, str, maxlen)); len++) {
 		if (!rune)
 			break;
+		STAT(ascii += n == 1 && rune < 0x80);
 		str += n;
 		maxlen -= n;
 	}
+	STAT(stats_add(str - start, len, ascii, 0, 0));
 	return len;
 }
 
+/* return the number of bytes in a word that aren't continuation bytes */
+static inline unsigned word_starts(uint64_t w)
+{
+	return word_cnt((~w | w << 1) & WORD_HIGH_BITS);
+}
+
+size_t utfseek(const char *str, size_t n, size_t k)
+{
+	const unsigned char *s = (const unsigned char *)str;
+	size_t i = 1;
+	STAT(size_t want = k);
+
+	/* the first byte always starts a rune, find the start of the k+1th */
+	if (!k || !n)
+		return 0;
+	for (; i + 8 <= n; i += 8) {
+		unsigned cnt = word_starts(load64(s + i));
+
+		if (cnt >= k)
+			break;
+		k -= cnt;
+	}
+	for (; i < n; i++) {
+		if (!UTF8_IS_TRAILING(s[i]) && !--k)
+			break;
+	}
+	STAT(stats_add(i, want - k, 0, 0, 0));
+	return i;
+}
+
+char *utfsubstr(const char *str, size_t n, size_t start, size_t count,
+                size_t *len)
+{
+	size_t off = utfseek(str, n, start);
+
+	if (len)
+		*len = utfseek(str + off, n - off, count);
+	return (char *)str + off;
+}
+
 char *utfrune(const char *str, Rune rune)
 {
 	union utf8 u = {.cp = str};
 	Rune c;
+	int n;
+	STAT(uint64_t runes = 0, ascii = 0);
 
-	if (rune < Runeself)
-		return strchr(str, rune);
+	if (rune < Runeself) {
+		u.pc = strchr(str, rune);
+		STAT(stats_search(str, u.pc ? 0 : strlen(str), u.pc, 1));
+		return u.pc;
+	}
 	if (rune != Runeerror) {
 		char tmp[UTFmax + 1];
-		int n = runetochar(tmp, &rune);
 
+		n = runetochar(tmp, &rune);
 		tmp[n] = '\0';
-		return strstr(str, tmp);
+		u.pc = strstr(str, tmp);
+		STAT(stats_search(str, u.pc ? 0 : strlen(str), u.pc, n));
+		return u.pc;
 	}
-	do {
-		int n = chartorune(&c, u.cp);
-
+	for (;; u.p += n) {
+		n = chartorune(&c, u.cp);
+		if (!c)
+			break;
+		STAT(runes++, ascii += c < 0x80);
 		if (c == rune)
-			return u.pc;
-		u.p += n;
-	} while (c);
-	return NULL;
+			break;
+	}
+	STAT(stats_add(u.cp - str + (c ? n : 0), runes, ascii, 0, 0));
+	return c ? u.pc : NULL;
 }
 
 char *utfrrune(const char *str, Rune rune)
@@ -218,16 +255,22 @@ char *utfrrune(const char *str, Rune rune)
 	union utf8 u = {.cp = str};
 	char *save = NULL;
 	Rune c;
+	int n;
+	STAT(uint64_t runes = 0, ascii = 0);
 
-	if (rune < Runeself)
+	if (rune < Runeself) {
+		STAT(stats_add(strlen(str), 0, 0, 0, 0));
 		return strrchr(str, rune);
-	do {
-		int n = chartorune(&c, u.cp);
-
+	}
+	for (;; u.p += n) {
+		n = chartorune(&c, u.cp);
+		if (!c)
+			break;
+		STAT(runes++, ascii += c < 0x80);
 		if (c == rune)
 			save = u.pc;
-		u.p += n;
-	} while (c);
+	}
+	STAT(stats_add(u.cp - str, runes, ascii, 0, 0));
 	return save;
 }
 
@@ -238,8 +281,12 @@ char *utfutf(const char *str, const char *substr)
 	union utf8 u;
 	size_t len;
 
-	if (c < Runeself)
-		return strstr(str, substr);
+	if (c < Runeself) {
+		u.pc = strstr(str, substr);
+		STAT(stats_search(str, u.pc ? 0 : strlen(str), u.pc,
+		                  strlen(substr)));
+		return u.pc;
+	}
 	len = strlen(substr);
 	u.cp = str;
 	for (; (u.pc = utfrune(u.cp, c)); u.p += n) {
@@ -249,6 +296,139 @@ char *utfutf(const char *str, const char *substr)
 	return NULL;
 }
 
+char *utfnrune(const char *str, size_t n, Rune rune)
+{
+	const char *p = str, *end = str + n;
+	char tmp[UTFmax];
+	Rune c;
+	int w;
+	STAT(uint64_t runes = 0, ascii = 0);
+
+	if (rune < Runeself) {
+		p = memchr(str, rune, n);
+		STAT(stats_search(str, n, p, 1));
+		return (char *)p;
+	}
+	if (rune != Runeerror) {
+		w = runetochar(tmp, &rune);
+		p = mem_mem(str, n, tmp, w);
+		STAT(stats_search(str, n, p, w));
+		return (char *)p;
+	}
+	for (; p < end; p += w) {
+		w = charntorune(&c, p, end - p);
+		STAT(runes++, ascii += c < 0x80);
+		if (c == rune)
+			break;
+	}
+	STAT(stats_add((p < end) ? (size_t)(p - str) + w : n, runes, ascii, 0,
+	               0));
+	return (p < end) ? (char *)p : NULL;
+}
+
+char *utfnrrune(const char *str, size_t n, Rune rune)
+{
+	const char *p = str, *end = str + n, *save = NULL;
+	char tmp[UTFmax];
+	Rune c;
+	STAT(uint64_t runes = 0, ascii = 0);
+
+	/* searching from the end, the bytes after the match are looked at */
+	if (rune < Runeself) {
+		p = mem_rchr(str, rune, n);
+		STAT(stats_add(p ? (size_t)(end - p) : n, 0, 0, 0, 0));
+		return (char *)p;
+	}
+	if (rune != Runeerror) {
+		p = mem_rmem(str, n, tmp, runetochar(tmp, &rune));
+		STAT(stats_add(p ? (size_t)(end - p) : n, 0, 0, 0, 0));
+		return (char *)p;
+	}
+	while (p < end) {
+		int w = charntorune(&c, p, end - p);
+
+		STAT(runes++, ascii += c < 0x80);
+		if (c == rune)
+			save = p;
+		p += w;
+	}
+	STAT(stats_add(n, runes, ascii, 0, 0));
+	return (char *)save;
+}
+
+char *utfnutf(const char *str, size_t n, const char *substr, size_t m)
+{
+	const char *p = str, *end = str + n;
+	Rune c;
+
+	if (!m)
+		return (char *)str;
+	/* a valid leading rune can only match at a rune boundary */
+	if (utf_charntorune(&c, substr, m, RUNEBAD) && c != RUNEBAD) {
+		p = mem_mem(str, n, substr, m);
+		STAT(stats_search(str, n, p, m));
+		return (char *)p;
+	}
+	for (; (size_t)(end - p) >= m; p += charntorune(&c, p, end - p)) {
+		if (!memcmp(p, substr, m)) {
+			STAT(stats_search(str, n, p, m));
+			return (char *)p;
+		}
+	}
+	STAT(stats_add(n, 0, 0, 0, 0));
+	return NULL;
+}
+
+int utfnvalid(const char *str, size_t n, size_t *runes)
+{
+	size_t i = 0, cnt = 0;
+	int valid = 1;
+	STAT(uint64_t ascii = 0);
+
+	while (i < n) {
+		size_t span = ascii_span(str + i, n - i);
+		Rune rune;
+
+		i += span;
+		cnt += span;
+		STAT(ascii += span);
+		if (i == n)
+			break;
+		i += utf_charntorune(&rune, str + i, n - i, RUNEBAD);
+		cnt++;
+		if (rune == RUNEBAD) {
+			valid = 0;
+			if (!runes)
+				break;
+		}
+	}
+	STAT(stats_add(i, cnt, ascii, 0, 0));
+	if (runes)
+		*runes = cnt;
+	return valid;
+}
+
+int utfrevalid(const char *str, size_t n, size_t off, size_t len,
+               size_t *runes)
+{
+	const unsigned char *s = (const unsigned char *)str;
+	size_t start = off, end = off + len;
+
+	/* start at the rune still reaching into the changed bytes, if any */
+	while (start > 0 && off - start < UTFmax - 1 &&
+	       UTF8_IS_TRAILING(s[start - 1]))
+		start--;
+	if (start > 0 && UTF8_IS_LEADING(s[start - 1]) &&
+	    (size_t)utf_trail_cnt(s[start - 1]) >= off - start + 1)
+		start--;
+	else
+		start = off;
+	/* continuation bytes after the change belonged to a changed rune */
+	while (end < n && UTF8_IS_TRAILING(s[end]))
+		end++;
+	return utfnvalid(str + start, end - start, runes);
+}
+
 #define RUNETOCHAR16(buf, rune)                          \
 	do {                                             \
 		Rune c = *rune;                          \
@@ -325,12 +505,12 @@ int runetowchar(wchar_t *buf, Rune *rune)
 		RUNETOCHAR32(buf, rune);
 }
 
-#define CHAR16TORUNE(rune, str, n)                             \
+#define CHAR16TORUNE(rune, str, n, err)                        \
 	do {                                                   \
 		int retval;                                    \
 		Rune c;                                        \
 		char16_t tmp;                                  \
-		*rune = Runeerror;                             \
+		*rune = (err);                                 \
 		if (!n)                                        \
 			return 0;                              \
 		if (UTF16_IS_LEADING(*str) && n == 1)          \
@@ -344,7 +524,7 @@ int runetowchar(wchar_t *buf, Rune *rune)
 				c += 0x10000;                  \
 				retval++;                      \
 			} else {                               \
-				c = Runeerror;                 \
+				c = (err);                     \
 			}                                      \
 		}                                              \
 		if (validrune(c))                              \
@@ -352,21 +532,23 @@ int runetowchar(wchar_t *buf, Rune *rune)
 		return retval;                                 \
 	} while (0)
 
-
-
-int char16ntorune(Rune *rune, const char16_t *str, size_t n)
+/* char16ntorune() with @err read for invalid encodings */
+static inline int dec_utf16(Rune *rune, const char16_t *str, size_t n,
+                            Rune err)
 {
-	CHAR16TORUNE(rune, str, n);
+	CHAR16TORUNE(rune, str, n, err);
 }
 
-int char16xentorune(Rune *rune, const char16_t *str, size_t n, int be)
+/* char16xentorune() with @err read for invalid encodings */
+static inline int dec_utf16xe(Rune *rune, const char16_t *str, size_t n,
+                              int be, Rune err)
 {
 	union utf16 u;
 	int retval;
 	Rune c;
 	char16_t tmp;
 
-	*rune = Runeerror;
+	*rune = err;
 	if (!n)
 		return 0;
 	u.cp = str;
@@ -386,7 +568,7 @@ int char16xentorune(Rune *rune, const char16_t *str, size_t n, int be)
 			c += 0x10000; /* full 21-bit code point */
 			retval++;
 		} else {
-			c = Runeerror;
+			c = err;
 		}
 	}
 	if (validrune(c))
@@ -394,29 +576,46 @@ int char16xentorune(Rune *rune, const char16_t *str, size_t n, int be)
 	return retval;
 }
 
-#define CHAR32TORUNE(rune, str, n) \
-	do {                       \
-		Rune c;            \
-		*rune = Runeerror; \
-		if (!n)            \
-			return 0;  \
-		c = *str;          \
-		if (validrune(c))  \
-			*rune = c; \
-		return 1;          \
+#define dec_utf16le(rune, str, n, err) dec_utf16xe(rune, str, n, 0, err)
+#define dec_utf16be(rune, str, n, err) dec_utf16xe(rune, str, n, 1, err)
+
+int char16ntorune(Rune *rune, const char16_t *str, size_t n)
+{
+	return dec_utf16(rune, str, n, Runeerror);
+}
+
+int char16xentorune(Rune *rune, const char16_t *str, size_t n, int be)
+{
+	return dec_utf16xe(rune, str, n, be, Runeerror);
+}
+
+#define CHAR32TORUNE(rune, str, n, err) \
+	do {                            \
+		Rune c;                 \
+		*rune = (err);          \
+		if (!n)                 \
+			return 0;       \
+		c = *str;               \
+		if (validrune(c))       \
+			*rune = c;      \
+		return 1;               \
 	} while (0)
 
-int char32ntorune(Rune *rune, const char32_t *str, size_t n)
+/* char32ntorune() with @err read for invalid encodings */
+static inline int dec_utf32(Rune *rune, const char32_t *str, size_t n,
+                            Rune err)
 {
-	CHAR32TORUNE(rune, str, n);
+	CHAR32TORUNE(rune, str, n, err);
 }
 
-int char32xentorune(Rune *rune, const char32_t *str, size_t n, int be)
+/* char32xentorune() with @err read for invalid encodings */
+static inline int dec_utf32xe(Rune *rune, const char32_t *str, size_t n,
+                              int be, Rune err)
 {
 	union utf32 u;
 	Rune c;
 
-	*rune = Runeerror;
+	*rune = err;
 	if (!n)
 		return 0;
 	u.cp = str;
@@ -427,15 +626,84 @@ int char32xentorune(Rune *rune, const char32_t *str, size_t n, int be)
 	return 1;
 }
 
-int wcharntorune(Rune *rune, const wchar_t *str, size_t n)
+#define dec_utf32le(rune, str, n, err) dec_utf32xe(rune, str, n, 0, err)
+#define dec_utf32be(rune, str, n, err) dec_utf32xe(rune, str, n, 1, err)
+
+int char32ntorune(Rune *rune, const char32_t *str, size_t n)
+{
+	return dec_utf32(rune, str, n, Runeerror);
+}
+
+int char32xentorune(Rune *rune, const char32_t *str, size_t n, int be)
+{
+	return dec_utf32xe(rune, str, n, be, Runeerror);
+}
+
+/* wcharntorune() with @err read for invalid encodings */
+static inline int dec_wchar(Rune *rune, const wchar_t *str, size_t n, Rune err)
 {
 	if (sizeof(wchar_t) == 2) {
-		CHAR16TORUNE(rune, str, n);
+		CHAR16TORUNE(rune, str, n, err);
 	} else {
-		CHAR32TORUNE(rune, str, n);
+		CHAR32TORUNE(rune, str, n, err);
 	}
 }
 
+int wcharntorune(Rune *rune, const wchar_t *str, size_t n)
+{
+	return dec_wchar(rune, str, n, Runeerror);
+}
+
+/* read a surrogate as 3 bytes of a utf-8 variant, return 0 if there's none */
+static inline int dec_surrogate(Rune *rune, const char *str, size_t n)
+{
+	const unsigned char *s = (const unsigned char *)str;
+
+	if (n < 3 || s[0] != 0xed || (s[1] & 0xe0) != 0xa0 ||
+	    !UTF8_IS_TRAILING(s[2]))
+		return 0;
+	*rune = 0xd000 | (s[1] & 0x3f) << 6 | (s[2] & 0x3f);
+	return 3;
+}
+
+/*
+ * read a rune in a utf-8 variant, RUNEBAD for invalid encodings and lone
+ * surrogates as they are if @lone
+ */
+static inline int dec_utf8x(Rune *rune, const char *str, size_t n,
+                            enum utfconv_type type, int lone)
+{
+	const unsigned char *s = (const unsigned char *)str;
+	Rune low;
+
+	if (!dec_surrogate(rune, str, n)) {
+		if (type == UTFCONV_MUTF8 && n >= 2 && s[0] == 0xc0 &&
+		    s[1] == 0x80) {
+			*rune = 0;
+			return 2;
+		}
+		/* only wtf-8 has 4-byte sequences */
+		if (s[0] >= 0xf0 && type != UTFCONV_WTF8) {
+			*rune = RUNEBAD;
+			return 1;
+		}
+		return dec_utf8(rune, str, n, RUNEBAD);
+	}
+	/* wtf-8 has no pairs, cesu-8 and modified utf-8 need them */
+	if (UTF16_IS_LEADING(*rune) && dec_surrogate(&low, str + 3, n - 3) &&
+	    UTF16_IS_TRAILING(low)) {
+		if (type == UTFCONV_WTF8) {
+			*rune = RUNEBAD;
+			return 3;
+		}
+		*rune = 0x10000 + ((*rune & 0x3ff) << 10 | (low & 0x3ff));
+		return 6;
+	}
+	if (!lone)
+		*rune = RUNEBAD;
+	return 3;
+}
+
 #define MAX(a, b) (((a) > (b)) ? (a) : (b))
 
 #define UTFCONV(fromtype, fromfunc, totype, tofunc, factor)               \
@@ -443,233 +711,696 @@ int wcharntorune(Rune *rune, const wchar_t *str, size_t n)
 		totype **ret = retv, *buf, *dest;                         \
 		const fromtype *str = strv, *ptr;                         \
 		Rune rune;                                                \
-		size_t i, n, len;                                         \
+		size_t n, len, partial = 0, alloc;                        \
 		int w, retval;                                            \
-		for (ptr = str; *ptr; ptr++)                              \
-			/* do nothing */;                                 \
-		len = (size_t)((uintptr_t)ptr - (uintptr_t)str) /         \
-		      sizeof(*str) + 1;                                   \
-		*ret = buf = malloc(len * (factor) * sizeof(*buf));       \
+		STAT(uint64_t runes = 0, ascii = 0, replaced = 0);        \
+		if (size == (size_t)-1) {                                 \
+			for (ptr = str; *ptr; ptr++)                      \
+				/* do nothing */;                         \
+			n = ptr - str;                                    \
+		} else {                                                  \
+			n = size / sizeof(*str);                          \
+			partial = (size % sizeof(*str)) != 0;             \
+		}                                                         \
+		if (partial && strict) {                                  \
+			*ret = NULL;                                      \
+			return -1;                                        \
+		}                                                         \
+		alloc = (n + partial) * (factor) + 1;                     \
+		*ret = buf = malloc(alloc * sizeof(*buf));                \
 		if (!buf)                                                 \
 			return -1;                                        \
 		dest = buf;                                               \
-		for (i = 0, n = len; i < n; i += w) {                     \
-			w = fromfunc(&rune, str, len);                    \
+		for (len = n; len; len -= w) {                            \
+			w = fromfunc(&rune, str, len, RUNEBAD);           \
+			if (rune == RUNEBAD) {                            \
+				if (strict) {                             \
+					free(buf);                        \
+					*ret = NULL;                      \
+					return -1;                        \
+				}                                         \
+				rune = repl;                              \
+				STAT(replaced++);                         \
+			}                                                 \
+			STAT(runes++, ascii += rune < 0x80);              \
 			dest += tofunc(dest, &rune);                      \
 			str += w;                                         \
-			len -= w;                                         \
 		}                                                         \
+		/* a trailing partial code unit is one invalid rune */    \
+		if (partial) {                                            \
+			rune = repl;                                      \
+			dest += tofunc(dest, &rune);                      \
+			STAT(runes++, ascii += rune < 0x80, replaced++);  \
+		}                                                         \
+		*dest = 0;                                                \
 		retval = dest - buf;                                      \
-		buf = realloc(buf, retval * sizeof(*buf));                \
+		buf = realloc(buf, (retval + 1) * sizeof(*buf));          \
 		if (buf)                                                  \
 			*ret = buf;                                       \
-		return retval - 1;                                        \
+		STAT(stats_add(n, runes, ascii, replaced,                 \
+		               alloc * sizeof(*buf)),                     \
+		     utf_stats.conv[strtype][rettype]++);                 \
+		return retval;                                            \
 	} while (0)
 
-int utfconv(void *retv, enum utfconv_type rettype, const void *strv,
-            enum utfconv_type strtype)
+/*
+ * read a rune from n bytes in any encoding, RUNEBAD for invalid ones and
+ * lone surrogates in utf-16 and the utf-8 variants as they are if @lone, and
+ * return the number of bytes consumed, a partial code unit being one rune
+ */
+static inline size_t dec_type(Rune *rune, const char *str, size_t n,
+                              enum utfconv_type type, int lone)
 {
+	char16_t u16[2];
+	char32_t u32;
+	wchar_t uw[2];
+	size_t w, i;
+
+	/* str is a byte offset, the units are read without alignment */
+	switch (type) {
+	case UTFCONV_UTF8:
+		return dec_utf8(rune, str, n, RUNEBAD);
+	case UTFCONV_MUTF8:
+	case UTFCONV_CESU8:
+	case UTFCONV_WTF8:
+		return dec_utf8x(rune, str, n, type, lone);
+	case UTFCONV_UTF16:
+	case UTFCONV_UTF16LE:
+	case UTFCONV_UTF16BE:
+		if (n < sizeof(char16_t))
+			break;
+		n /= sizeof(char16_t);
+		if (n > 2)
+			n = 2;
+		for (i = 0; i < n; i++)
+			u16[i] = load16(str + i * sizeof(char16_t), type);
+		w = dec_utf16(rune, u16, n, RUNEBAD) * sizeof(char16_t);
+		goto lone;
+	case UTFCONV_UTF32:
+	case UTFCONV_UTF32LE:
+	case UTFCONV_UTF32BE:
+		if (n < sizeof(char32_t))
+			break;
+		u32 = load32(str, type);
+		return dec_utf32(rune, &u32, 1, RUNEBAD) * sizeof(char32_t);
+	default:
+		if (n < sizeof(wchar_t))
+			break;
+		n /= sizeof(wchar_t);
+		if (n > 2)
+			n = 2;
+		for (i = 0; i < n; i++)
+			uw[i] = (sizeof(wchar_t) == 2) ?
+			        (wchar_t)load16(str + i * sizeof(wchar_t), type) :
+			        (wchar_t)load32(str + i * sizeof(wchar_t), type);
+		w = dec_wchar(rune, uw, n, RUNEBAD) * sizeof(wchar_t);
+		goto lone;
+	}
+	*rune = RUNEBAD;
+	return n;
+lone:
+	/* the only invalid single code units of utf-16 are surrogates */
+	if (lone && *rune == RUNEBAD && w == 2)
+		*rune = load16(str, type);
+	return w;
+}
+
+/*
+ * utfconv_repl() a rune at a time between types the macro doesn't cover,
+ * keeping lone surrogates if both types hold them
+ */
+static int utfconv_any(void *retv, enum utfconv_type rettype,
+                       const void *strv, size_t size,
+                       enum utfconv_type strtype, Rune repl, int strict)
+{
+	static const char zero[sizeof(char32_t)];
+	char **ret = retv, *buf, *dest;
+	const char *str = strv;
+	size_t unit = unit_size(strtype), retunit = unit_size(rettype);
+	size_t i, w, alloc;
+	int lone = holds_lone(strtype) && holds_lone(rettype), retval;
+	Rune rune;
+	STAT(uint64_t runes = 0, ascii = 0, replaced = 0);
+
+	if (size == (size_t)-1) {
+		for (size = 0; memcmp(str + size, zero, unit); size += unit)
+			/* do nothing */;
+	}
+	if (size % unit && strict) {
+		*ret = NULL;
+		return -1;
+	}
+	/* a partial code unit is a rune too */
+	alloc = (size / unit + 1) * UTFCONVmax + retunit;
+	*ret = buf = malloc(alloc);
+	if (!buf)
+		return -1;
+	dest = buf;
+	for (i = 0; i < size; i += w) {
+		/* ascii from the 8-bit types, found 8 bytes at a time */
+		if (unit == 1 && retunit <= 2 &&
+		    (w = ascii_span(str + i, size - i))) {
+			const char *nul = (rettype == UTFCONV_MUTF8) ?
+			                  memchr(str + i, 0, w) : NULL;
+			size_t k;
+
+			if (nul)
+				w = nul - (str + i);
+			if (retunit == 1)
+				memcpy(dest, str + i, w);
+			for (k = 0; retunit == 2 && k < w; k++)
+				store16(dest + 2 * k, str[i + k], rettype);
+			dest += w * retunit;
+			STAT(runes += w, ascii += w);
+			if (w)
+				continue;
+		}
+		w = dec_type(&rune, str + i, size - i, strtype, lone);
+		if (rune == RUNEBAD) {
+			if (strict) {
+				free(buf);
+				*ret = NULL;
+				return -1;
+			}
+			rune = repl;
+			STAT(replaced++);
+		}
+		STAT(runes++, ascii += rune < 0x80);
+		dest += enc_any(dest, rune, rettype, lone);
+	}
+	memcpy(dest, zero, retunit);
+	retval = (dest - buf) / retunit;
+	buf = realloc(buf, dest - buf + retunit);
+	if (buf)
+		*ret = buf;
+	STAT(stats_add(size / unit, runes, ascii, replaced, alloc),
+	     utf_stats.conv[strtype][rettype]++);
+	return retval;
+}
+
+/*
+ * utfconv() of @size bytes, or up to the terminator if @size is (size_t)-1,
+ * writing @repl for invalid encodings, unless @strict
+ */
+static inline int utfconv_repl(void *retv, enum utfconv_type rettype,
+                               const void *strv, size_t size,
+                               enum utfconv_type strtype, Rune repl,
+                               int strict)
+{
+	if (strtype == UTFCONV_AUTO) {
+		size_t bom;
+
+		if (size == (size_t)-1)
+			return -1;
+		strtype = utfdetect(strv, size, &bom);
+		strv = (const char *)strv + bom;
+		size -= bom;
+	}
+	if (rettype >= UTFCONV_AUTO || strtype >= UTFCONV_AUTO)
+		return -1;
+	if (rettype > UTFCONV_WCHAR || strtype > UTFCONV_WCHAR)
+		return utfconv_any(retv, rettype, strv, size, strtype, repl,
+		                   strict);
 	if (strtype == UTFCONV_UTF8) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(char, charntorune, char, runetochar,
-			        runelen(Runeerror));
+			UTFCONV(char, dec_utf8, char, runetochar,
+			        runelen_valid(repl));
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(char, charntorune, char16_t, runetochar16, 1);
+			UTFCONV(char, dec_utf8, char16_t, runetochar16,
+			        (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(char, charntorune, char16_t, runetochar16le, 1);
+			UTFCONV(char, dec_utf8, char16_t, runetochar16le,
+			        (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(char, charntorune, char16_t, runetochar16be, 1);
+			UTFCONV(char, dec_utf8, char16_t, runetochar16be,
+			        (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(char, charntorune, char32_t, runetochar32, 1);
+			UTFCONV(char, dec_utf8, char32_t, runetochar32, 1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(char, charntorune, char32_t, runetochar32le, 1);
+			UTFCONV(char, dec_utf8, char32_t, runetochar32le, 1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(char, charntorune, char32_t, runetochar32be, 1);
+			UTFCONV(char, dec_utf8, char32_t, runetochar32be, 1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(char, charntorune, wchar_t, runetowchar, 1);
+			UTFCONV(char, dec_utf8, wchar_t, runetowchar,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
+			                                 1 : 2 : 1);
 	} else if (strtype == UTFCONV_UTF16) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(char16_t, char16ntorune, char, runetochar,
-			        MAX(runelen(Runeerror), 3));
+			UTFCONV(char16_t, dec_utf16, char, runetochar,
+			        MAX(runelen_valid(repl), 3));
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(char16_t, char16ntorune, char16_t, runetochar16,
-			        (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16, char16_t, runetochar16,
+			        (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(char16_t, char16ntorune, char16_t,
-			        runetochar16le, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16, char16_t,
+			        runetochar16le, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(char16_t, char16ntorune, char16_t,
-			        runetochar16be, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16, char16_t,
+			        runetochar16be, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(char16_t, char16ntorune, char32_t, runetochar32,
+			UTFCONV(char16_t, dec_utf16, char32_t, runetochar32,
 			        1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(char16_t, char16ntorune, char32_t,
+			UTFCONV(char16_t, dec_utf16, char32_t,
 			        runetochar32le, 1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(char16_t, char16ntorune, char32_t,
+			UTFCONV(char16_t, dec_utf16, char32_t,
 			        runetochar32be, 1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(char16_t, char16ntorune, wchar_t, runetowchar,
-			        (sizeof(wchar_t) == 2) ? (Runeerror < 0x10000) ?
+			UTFCONV(char16_t, dec_utf16, wchar_t, runetowchar,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
 			                                 1 : 2 : 1);
 	} else if (strtype == UTFCONV_UTF16LE) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(char16_t, char16lentorune, char, runetochar,
-			        MAX(runelen(Runeerror), 3));
+			UTFCONV(char16_t, dec_utf16le, char, runetochar,
+			        MAX(runelen_valid(repl), 3));
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(char16_t, char16lentorune, char16_t,
-			        runetochar16, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16le, char16_t,
+			        runetochar16, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(char16_t, char16lentorune, char16_t,
-			        runetochar16le, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16le, char16_t,
+			        runetochar16le, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(char16_t, char16lentorune, char16_t,
-			        runetochar16be, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16le, char16_t,
+			        runetochar16be, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(char16_t, char16lentorune, char32_t,
+			UTFCONV(char16_t, dec_utf16le, char32_t,
 			        runetochar32, 1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(char16_t, char16lentorune, char32_t,
+			UTFCONV(char16_t, dec_utf16le, char32_t,
 			        runetochar32le, 1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(char16_t, char16lentorune, char32_t,
+			UTFCONV(char16_t, dec_utf16le, char32_t,
 			        runetochar32be, 1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(char16_t, char16lentorune, wchar_t, runetowchar,
-			        (sizeof(wchar_t) == 2) ? (Runeerror < 0x10000) ?
+			UTFCONV(char16_t, dec_utf16le, wchar_t, runetowchar,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
 			                                 1 : 2 : 1);
 	} else if (strtype == UTFCONV_UTF16BE) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(char16_t, char16bentorune, char, runetochar,
-			        MAX(runelen(Runeerror), 3));
+			UTFCONV(char16_t, dec_utf16be, char, runetochar,
+			        MAX(runelen_valid(repl), 3));
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(char16_t, char16bentorune, char16_t,
-			        runetochar16, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16be, char16_t,
+			        runetochar16, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(char16_t, char16bentorune, char16_t,
-			        runetochar16le, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16be, char16_t,
+			        runetochar16le, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(char16_t, char16bentorune, char16_t,
-			        runetochar16be, (Runeerror < 0x10000) ? 1 : 2);
+			UTFCONV(char16_t, dec_utf16be, char16_t,
+			        runetochar16be, (repl < 0x10000) ? 1 : 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(char16_t, char16bentorune, char32_t,
+			UTFCONV(char16_t, dec_utf16be, char32_t,
 			        runetochar32, 1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(char16_t, char16bentorune, char32_t,
+			UTFCONV(char16_t, dec_utf16be, char32_t,
 			        runetochar32le, 1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(char16_t, char16bentorune, char32_t,
+			UTFCONV(char16_t, dec_utf16be, char32_t,
 			        runetochar32be, 1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(char16_t, char16bentorune, wchar_t, runetowchar,
-			        (sizeof(wchar_t) == 2) ? (Runeerror < 0x10000) ?
+			UTFCONV(char16_t, dec_utf16be, wchar_t, runetowchar,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
 			                                 1 : 2 : 1);
 	} else if (strtype == UTFCONV_UTF32) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(char32_t, char32ntorune, char, runetochar,
+			UTFCONV(char32_t, dec_utf32, char, runetochar,
 			        UTFmax);
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(char32_t, char32ntorune, char16_t, runetochar16,
+			UTFCONV(char32_t, dec_utf32, char16_t, runetochar16,
 			        2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(char32_t, char32ntorune, char16_t,
+			UTFCONV(char32_t, dec_utf32, char16_t,
 			        runetochar16le, 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(char32_t, char32ntorune, char16_t,
+			UTFCONV(char32_t, dec_utf32, char16_t,
 			        runetochar16be, 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(char32_t, char32ntorune, char32_t,
+			UTFCONV(char32_t, dec_utf32, char32_t,
 			        runetochar32, 1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(char32_t, char32ntorune, char32_t,
+			UTFCONV(char32_t, dec_utf32, char32_t,
 			        runetochar32le, 1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(char32_t, char32ntorune, char32_t,
+			UTFCONV(char32_t, dec_utf32, char32_t,
 			        runetochar32be, 1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(char32_t, char32ntorune, wchar_t, runetowchar,
+			UTFCONV(char32_t, dec_utf32, wchar_t, runetowchar,
 			        (sizeof(wchar_t) == 2) ? 2 : 1);
 	} else if (strtype == UTFCONV_UTF32LE) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(char32_t, char32lentorune, char, runetochar,
+			UTFCONV(char32_t, dec_utf32le, char, runetochar,
 			        UTFmax);
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(char32_t, char32lentorune, char16_t,
+			UTFCONV(char32_t, dec_utf32le, char16_t,
 			        runetochar16, 2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(char32_t, char32lentorune, char16_t,
+			UTFCONV(char32_t, dec_utf32le, char16_t,
 			        runetochar16le, 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(char32_t, char32lentorune, char16_t,
+			UTFCONV(char32_t, dec_utf32le, char16_t,
 			        runetochar16be, 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(char32_t, char32lentorune, char32_t,
+			UTFCONV(char32_t, dec_utf32le, char32_t,
 			        runetochar32, 1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(char32_t, char32lentorune, char32_t,
+			UTFCONV(char32_t, dec_utf32le, char32_t,
 			        runetochar32le, 1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(char32_t, char32lentorune, char32_t,
+			UTFCONV(char32_t, dec_utf32le, char32_t,
 			        runetochar32be, 1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(char32_t, char32lentorune, wchar_t, runetowchar,
+			UTFCONV(char32_t, dec_utf32le, wchar_t, runetowchar,
 			        (sizeof(wchar_t) == 2) ? 2 : 1);
 	} else if (strtype == UTFCONV_UTF32BE) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(char32_t, char32bentorune, char, runetochar,
+			UTFCONV(char32_t, dec_utf32be, char, runetochar,
 			        UTFmax);
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(char32_t, char32bentorune, char16_t,
+			UTFCONV(char32_t, dec_utf32be, char16_t,
 			        runetochar16, 2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(char32_t, char32bentorune, char16_t,
+			UTFCONV(char32_t, dec_utf32be, char16_t,
 			        runetochar16le, 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(char32_t, char32bentorune, char16_t,
+			UTFCONV(char32_t, dec_utf32be, char16_t,
 			        runetochar16be, 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(char32_t, char32bentorune, char32_t,
+			UTFCONV(char32_t, dec_utf32be, char32_t,
 			        runetochar32, 1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(char32_t, char32bentorune, char32_t,
+			UTFCONV(char32_t, dec_utf32be, char32_t,
 			        runetochar32le, 1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(char32_t, char32bentorune, char32_t,
+			UTFCONV(char32_t, dec_utf32be, char32_t,
 			        runetochar32be, 1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(char32_t, char32bentorune, wchar_t, runetowchar,
+			UTFCONV(char32_t, dec_utf32be, wchar_t, runetowchar,
 			        (sizeof(wchar_t) == 2) ? 2 : 1);
 	} else if (strtype == UTFCONV_WCHAR) {
 		if (rettype == UTFCONV_UTF8)
-			UTFCONV(wchar_t, wcharntorune, char, runetochar,
-			        (sizeof(wchar_t) == 2) ? MAX(runelen(Runeerror),
-			                                     3) : UTFmax);
+			UTFCONV(wchar_t, dec_wchar, char, runetochar,
+			        (sizeof(wchar_t) == 2) ?
+			        MAX(runelen_valid(repl), 3) : UTFmax);
 		else if (rettype == UTFCONV_UTF16)
-			UTFCONV(wchar_t, wcharntorune, char16_t, runetochar16,
-			        (sizeof(wchar_t) == 2) ? (Runeerror < 0x10000) ?
+			UTFCONV(wchar_t, dec_wchar, char16_t, runetochar16,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
 			                                 1 : 2 : 2);
 		else if (rettype == UTFCONV_UTF16LE)
-			UTFCONV(wchar_t, wcharntorune, char16_t, runetochar16le,
-			        (sizeof(wchar_t) == 2) ? (Runeerror < 0x10000) ?
+			UTFCONV(wchar_t, dec_wchar, char16_t, runetochar16le,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
 			                                 1 : 2 : 2);
 		else if (rettype == UTFCONV_UTF16BE)
-			UTFCONV(wchar_t, wcharntorune, char16_t, runetochar16be,
-			        (sizeof(wchar_t) == 2) ? (Runeerror < 0x10000) ?
+			UTFCONV(wchar_t, dec_wchar, char16_t, runetochar16be,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
 			                                 1 : 2 : 2);
 		else if (rettype == UTFCONV_UTF32)
-			UTFCONV(wchar_t, wcharntorune, char32_t, runetochar32,
+			UTFCONV(wchar_t, dec_wchar, char32_t, runetochar32,
 			        1);
 		else if (rettype == UTFCONV_UTF32LE)
-			UTFCONV(wchar_t, wcharntorune, char32_t, runetochar32le,
+			UTFCONV(wchar_t, dec_wchar, char32_t, runetochar32le,
 			        1);
 		else if (rettype == UTFCONV_UTF32BE)
-			UTFCONV(wchar_t, wcharntorune, char32_t, runetochar32be,
+			UTFCONV(wchar_t, dec_wchar, char32_t, runetochar32be,
 			        1);
 		else if (rettype == UTFCONV_WCHAR)
-			UTFCONV(wchar_t, wcharntorune, wchar_t, runetowchar,
-			        (sizeof(wchar_t) == 2) ? (Runeerror < 0x10000) ?
+			UTFCONV(wchar_t, dec_wchar, wchar_t, runetowchar,
+			        (sizeof(wchar_t) == 2) ? (repl < 0x10000) ?
 			                                 1 : 2 : 1);
 	}
 	return -1;
 }
+
+int utfconv(void *retv, enum utfconv_type rettype, const void *strv,
+            enum utfconv_type strtype)
+{
+	Rune repl = Runeerror;
+
+	/* let the common case be specialized for a constant replacement */
+	if (repl == 0xfffd)
+		return utfconv_repl(retv, rettype, strv, (size_t)-1, strtype,
+		                    0xfffd, 0);
+	return utfconv_repl(retv, rettype, strv, (size_t)-1, strtype, repl, 0);
+}
+
+/* utfconvopts() of @size bytes, or up to the terminator if (size_t)-1 */
+static int utfconv_opts(void *retv, enum utfconv_type rettype,
+                        const void *strv, size_t size,
+                        enum utfconv_type strtype,
+                        const struct utfconv_opts *opts)
+{
+	if (!opts || (opts->replacement == 0xfffd && !opts->strict))
+		return utfconv_repl(retv, rettype, strv, size, strtype, 0xfffd,
+		                    0);
+	if (opts->strict)
+		return utfconv_repl(retv, rettype, strv, size, strtype, 0xfffd,
+		                    1);
+	if (!validrune(opts->replacement))
+		return -1;
+	return utfconv_repl(retv, rettype, strv, size, strtype,
+	                    opts->replacement, 0);
+}
+
+int utfconvopts(void *retv, enum utfconv_type rettype, const void *strv,
+                enum utfconv_type strtype, const struct utfconv_opts *opts)
+{
+	return utfconv_opts(retv, rettype, strv, (size_t)-1, strtype, opts);
+}
+
+int utfnconv(void *retv, enum utfconv_type rettype, const void *strv,
+             size_t n, enum utfconv_type strtype,
+             const struct utfconv_opts *opts)
+{
+	if (n == (size_t)-1)
+		return -1;
+	return utfconv_opts(retv, rettype, strv, n, strtype, opts);
+}
+
+/*
+ * read a rune from n bytes in any encoding, U+FFFD for invalid ones, and
+ * return the number of bytes consumed, a partial code unit being one rune
+ */
+static inline size_t dec_any(Rune *rune, const char *str, size_t n,
+                             enum utfconv_type type)
+{
+	size_t w;
+
+	if (type == UTFCONV_UTF8 && (unsigned char)*str < Runeself) {
+		*rune = (unsigned char)*str;
+		return 1;
+	}
+	w = dec_type(rune, str, n, type, 0);
+	if (*rune == RUNEBAD)
+		*rune = 0xfffd;
+	return w;
+}
+
+/* resolve UTFCONV_AUTO, skipping the byte order mark */
+static inline void detect_auto(const char **str, size_t *n,
+                               enum utfconv_type *type)
+{
+	size_t bom;
+
+	if (*type != UTFCONV_AUTO)
+		return;
+	*type = utfdetect(*str, *n, &bom);
+	*str += bom;
+	*n -= bom;
+}
+
+int utfconvcmp(const void *a, size_t alen, enum utfconv_type atype,
+               const void *b, size_t blen, enum utfconv_type btype)
+{
+	const char *s1 = a, *s2 = b;
+	size_t i = 0, j = 0;
+	int cmp = 0;
+	STAT(uint64_t runes = 0, ascii = 0);
+
+	detect_auto(&s1, &alen, &atype);
+	detect_auto(&s2, &blen, &btype);
+	/* byte order is code point order for equal ascii */
+	if (atype == UTFCONV_UTF8 && btype == UTFCONV_UTF8) {
+		size_t n = (alen < blen) ? alen : blen;
+		uint64_t w;
+
+		while (i + 8 <= n && (w = load64(s1 + i)) == load64(s2 + i) &&
+		       !(w & WORD_HIGH_BITS))
+			i += 8;
+		j = i;
+		STAT(runes = ascii = 2 * i);
+	}
+	while (i < alen && j < blen) {
+		Rune r1, r2;
+
+		i += dec_any(&r1, s1 + i, alen - i, atype);
+		j += dec_any(&r2, s2 + j, blen - j, btype);
+		STAT(runes += 2, ascii += (r1 < 0x80) + (r2 < 0x80));
+		if (r1 != r2) {
+			cmp = (r1 < r2) ? -1 : 1;
+			break;
+		}
+	}
+	if (!cmp)
+		cmp = (i < alen) - (j < blen);
+	STAT(stats_add(i / unit_size(atype) + j / unit_size(btype), runes,
+	               ascii, 0, 0));
+	return cmp;
+}
+
+/* constants of the hash, from splitmix64 */
+#define HASH_K1 ((uint64_t)0x9e3779b97f4a7c15)
+#define HASH_K2 ((uint64_t)0xbf58476d1ce4e5b9)
+#define HASH_K3 ((uint64_t)0x94d049bb133111eb)
+
+/* mix a word of two runes into the hash */
+static inline uint64_t hash_mix(uint64_t h, uint64_t w)
+{
+	w *= HASH_K1;
+	w ^= w >> 29;
+	h ^= w;
+	return (h << 27 | h >> 37) * HASH_K2;
+}
+
+static inline void hash_rune(struct utfhash *st, Rune rune)
+{
+	if (st->runes++ & 1)
+		st->h = hash_mix(st->h, st->pend | (uint64_t)rune << 32);
+	else
+		st->pend = rune;
+}
+
+/* hash n runes at once */
+static inline void hash_runes(struct utfhash *st, const Rune *r, int n)
+{
+	int i = 0;
+
+	/* an odd rune before pairs with the first */
+	if (st->runes & 1) {
+		st->h = hash_mix(st->h, st->pend | (uint64_t)r[0] << 32);
+		i = 1;
+	}
+	for (; i + 2 <= n; i += 2)
+		st->h = hash_mix(st->h, r[i] | (uint64_t)r[i + 1] << 32);
+	if (i < n)
+		st->pend = r[i];
+	st->runes += n;
+}
+
+/* hash n bytes of complete runes */
+static void hash_bytes(struct utfhash *st, const char *str, size_t n)
+{
+	const unsigned char *s = (const unsigned char *)str;
+	size_t i = 0;
+	Rune r[8];
+	STAT(uint64_t runes = st->runes, ascii = 0);
+
+	while (i < n) {
+		int k;
+
+		/* 8 ascii bytes or 4 code units outside the surrogates */
+		if (st->type == UTFCONV_UTF8 && i + 8 <= n &&
+		    !(load64(s + i) & WORD_HIGH_BITS)) {
+			for (k = 0; k < 8; k++)
+				r[k] = s[i + k];
+			hash_runes(st, r, 8);
+			i += 8;
+			STAT(ascii += 8);
+			continue;
+		}
+		if (unit_size(st->type) == 2 && i + 8 <= n) {
+			for (k = 0; k < 4; k++) {
+				char16_t c = load16(str + i + 2 * k, st->type);
+
+				if ((c & 0xf800) == 0xd800)
+					break;
+				r[k] = c;
+			}
+			if (k == 4) {
+				hash_runes(st, r, 4);
+				i += 8;
+				STAT(ascii += (r[0] < 0x80) + (r[1] < 0x80) +
+				              (r[2] < 0x80) + (r[3] < 0x80));
+				continue;
+			}
+		}
+		i += dec_any(r, str + i, n - i, st->type);
+		hash_rune(st, r[0]);
+		STAT(ascii += r[0] < 0x80);
+	}
+	STAT(stats_add(0, st->runes - runes, ascii, 0, 0));
+}
+
+void utfhashinit(struct utfhash *st, enum utfconv_type type, uint64_t seed)
+{
+	memset(st, 0, sizeof(*st));
+	st->h = seed ^ HASH_K1;
+	st->type = type;
+}
+
+void utfhashupdate(struct utfhash *st, const void *buf, size_t n)
+{
+	const char *str = buf;
+	size_t cut;
+
+	if (!n)
+		return;
+	detect_auto(&str, &n, &st->type);
+	STAT(stats_add(n / unit_size(st->type), 0, 0, 0, 0));
+	/* complete a rune split between the calls */
+	while (st->carried && n) {
+		st->carry.c[st->carried++] = *str++;
+		n--;
+		cut = chunk_cut(st->carry.c, st->carried, st->type);
+		hash_bytes(st, st->carry.c, cut);
+		memmove(st->carry.c, st->carry.c + cut, st->carried - cut);
+		st->carried -= cut;
+	}
+	if (st->carried)
+		return;
+	cut = chunk_cut(str, n, st->type);
+	hash_bytes(st, str, cut);
+	memcpy(st->carry.c, str + cut, n - cut);
+	st->carried = n - cut;
+}
+
+uint64_t utfhashfinal(struct utfhash *st)
+{
+	uint64_t h;
+
+	/* a rune cut off at the end is invalid */
+	hash_bytes(st, st->carry.c, st->carried);
+	st->carried = 0;
+	h = st->h;
+	if (st->runes & 1)
+		h = hash_mix(h, st->pend);
+	h ^= st->runes;
+	h = (h ^ h >> 30) * HASH_K2;
+	h = (h ^ h >> 27) * HASH_K3;
+	return h ^ h >> 31;
+}
+
+uint64_t utfhash(const void *str, size_t n, enum utfconv_type type,
+                 uint64_t seed)
+{
+	struct utfhash st;
+
+	utfhashinit(&st, type, seed);
+	utfhashupdate(&st, str, n);
+	return utfhashfinal(&st);
+}
+
+int utfstats(struct utfstats *stats, int reset)
+{
+#ifdef UTF_STATS
+	if (stats)
+		*stats = utf_stats;
+	if (reset)
+		memset(&utf_stats, 0, sizeof(utf_stats));
+	return 1;
+#else
+	(void)reset;
+	if (stats)
+		memset(stats, 0, sizeof(*stats));
+	return 0;
+#endif
+}
@@ -2,6 +2,7 @@
 #define UTF_H
 
 #include <stddef.h>
+#include <stdio.h>
 #include <inttypes.h>
 
 #ifndef __STD_UTF_16__
@@ -15,7 +16,8 @@ typedef uint32_t Rune;
 #define PRIRune "04"PRIX32
 
 enum {
-	UTFmax = 4 /* maximum bytes per rune */
+	UTFmax = 4,    /* maximum bytes per rune */
+	UTFCONVmax = 6 /* maximum bytes per rune in any enum utfconv_type */
 };
 
 static const Rune Runesync = 0x80; /* cannot represent part of a UTF sequence */
@@ -33,14 +35,82 @@ enum utfconv_type {
 	UTFCONV_UTF32,
 	UTFCONV_UTF32LE,
 	UTFCONV_UTF32BE,
-	UTFCONV_WCHAR
+	UTFCONV_WCHAR,
+	UTFCONV_MUTF8, /* modified utf-8 of java */
+	UTFCONV_CESU8, /* utf-8 of utf-16 code units */
+	UTFCONV_WTF8,  /* utf-8 with lone surrogates */
+	UTFCONV_AUTO   /* source only: detected by utfdetect() */
 };
 
+/* normalization forms for utfnormalize() */
+enum utfnorm_form {
+	UTFNORM_NFC,
+	UTFNORM_NFD,
+	UTFNORM_NFKC,
+	UTFNORM_NFKD
+};
+
+/* formats for utfescape() */
+enum utfescape_type {
+	UTFESCAPE_JSON,       /* for a json string */
+	UTFESCAPE_JSON_ASCII, /* for a json string, escaping all but ascii */
+	UTFESCAPE_XML         /* for xml and html text or attributes */
+};
+
+/* formats for utfunescape() */
+enum utfunescape_type {
+	UTFUNESCAPE_JSON,   /* the contents of a json string */
+	UTFUNESCAPE_PERCENT /* percent-encoding of a url component */
+};
+
+/* general categories returned by runecategory() */
+enum runecategory {
+	RUNECAT_CN, /* other, not assigned */
+	RUNECAT_LU, /* letter, uppercase */
+	RUNECAT_LL, /* letter, lowercase */
+	RUNECAT_LT, /* letter, titlecase */
+	RUNECAT_LM, /* letter, modifier */
+	RUNECAT_LO, /* letter, other */
+	RUNECAT_MN, /* mark, nonspacing */
+	RUNECAT_MC, /* mark, spacing combining */
+	RUNECAT_ME, /* mark, enclosing */
+	RUNECAT_ND, /* number, decimal digit */
+	RUNECAT_NL, /* number, letter */
+	RUNECAT_NO, /* number, other */
+	RUNECAT_PC, /* punctuation, connector */
+	RUNECAT_PD, /* punctuation, dash */
+	RUNECAT_PS, /* punctuation, open */
+	RUNECAT_PE, /* punctuation, close */
+	RUNECAT_PI, /* punctuation, initial quote */
+	RUNECAT_PF, /* punctuation, final quote */
+	RUNECAT_PO, /* punctuation, other */
+	RUNECAT_SM, /* symbol, math */
+	RUNECAT_SC, /* symbol, currency */
+	RUNECAT_SK, /* symbol, modifier */
+	RUNECAT_SO, /* symbol, other */
+	RUNECAT_ZS, /* separator, space */
+	RUNECAT_ZL, /* separator, line */
+	RUNECAT_ZP, /* separator, paragraph */
+	RUNECAT_CC, /* other, control */
+	RUNECAT_CF, /* other, format */
+	RUNECAT_CS, /* other, surrogate */
+	RUNECAT_CO  /* other, private use */
+};
+
+/* iso 15924 script code as returned by runescript(), e.g. RUNESCRIPT("Latn") */
+#define RUNESCRIPT(code)                                                  \
+	((uint32_t)(unsigned char)(code)[0] << 24 |                       \
+	 (uint32_t)(unsigned char)(code)[1] << 16 |                       \
+	 (uint32_t)(unsigned char)(code)[2] << 8 |                        \
+	 (uint32_t)(unsigned char)(code)[3])
+
 /* forward declarations */
 int runetochar16xe(char16_t *buf, Rune *rune, int be);
 int runetochar32xe(char32_t *buf, Rune *rune, int be);
 int char16xentorune(Rune *rune, const char16_t *str, size_t n, int be);
 int char32xentorune(Rune *rune, const char32_t *str, size_t n, int be);
+int utf16xevalid(const char16_t *str, size_t n, int be, size_t *err);
+int utf32xevalid(const char32_t *str, size_t n, int be, size_t *err);
 
 /**
  * loop_runes() - macro to loop through a utf-8 string's runes
@@ -64,6 +134,27 @@ int char32xentorune(Rune *rune, const char32_t *str, size_t n, int be);
 		}                                                            \
 	} while (0)
 
+/**
+ * loop_graphemes() - macro to loop through a utf-8 string's grapheme clusters
+ * @i: size_t variable holding the loop counter
+ * @cluster: const char pointer variable pointing to the actual cluster
+ * @size: size_t variable holding the size of the cluster in bytes
+ * @str: pointer to the string
+ * @n: size of the string
+ * @...: loop body that should be wrapped in {}
+ */
+#define loop_graphemes(i, cluster, size, str, n, ...)                       \
+	do {                                                                 \
+		const char *_gptr = (str);                                   \
+		size_t _glen = (n), _gw;                                     \
+		for ((i) = 0; _glen; _gptr += _gw, _glen -= _gw, (i)++) {    \
+			_gw = utfgraphemenext(_gptr, _glen);                 \
+			(cluster) = _gptr;                                   \
+			(size) = _gw;                                        \
+			__VA_ARGS__;                                         \
+		}                                                            \
+	} while (0)
+
 /**
  * runetochar() - write a rune to a buffer
  * @buf: pointer to the buffer >= UTFmax in size
@@ -118,10 +209,35 @@ int runelen(Rune rune);
  * @rune: pointer to the runes
  * @n: number of runes
  *
+ * Same as runenlen8(), but limited to int.
+ *
  * Return: The number of bytes needed to convert the runes to utf-8.
  */
 int runenlen(Rune *rune, int n);
 
+/**
+ * runenlen8() - return the size of given runes in chars
+ * @rune: pointer to the runes
+ * @n: number of runes
+ *
+ * Invalid runes count as Runeerror, as that's what runetochar() would write.
+ * Where SSE2 is available, 4 runes are measured at a time.
+ *
+ * Return: The number of bytes needed to convert the runes to utf-8.
+ */
+size_t runenlen8(const Rune *rune, size_t n);
+
+/**
+ * runenlen16() - return the size of given runes in char16_t
+ * @rune: pointer to the runes
+ * @n: number of runes
+ *
+ * Like runenlen8(), but for runetochar16().
+ *
+ * Return: The number of char16_t needed to convert the runes to utf-16.
+ */
+size_t runenlen16(const Rune *rune, size_t n);
+
 /**
  * fullrune() - check if a string is long enough to be decoded by chartorune()
  * @str: pointer to the string
@@ -163,6 +279,39 @@ size_t utflen(const char *str);
  */
 size_t utfnlen(const char *str, size_t maxlen);
 
+/**
+ * utfseek() - get the offset after a number of runes in a utf-8 string
+ * @str: pointer to the string
+ * @n: size of the string
+ * @k: number of runes to skip
+ *
+ * Instead of decoding, runes are counted 8 bytes at a time as the bytes that
+ * aren't continuation bytes, with the first byte always starting a rune. For
+ * valid utf-8 that's the same as utfnlen(), but in malformed sequences
+ * continuation bytes belong to the rune before them, while charntorune()
+ * would read each of them as Runeerror.
+ *
+ * Return: The offset of the rune after the first @k runes, or @n if @str
+ *	doesn't have more than @k runes.
+ */
+size_t utfseek(const char *str, size_t n, size_t k);
+
+/**
+ * utfsubstr() - get a range of runes in a utf-8 string
+ * @str: pointer to the string
+ * @n: size of the string
+ * @start: index of the first rune of the range
+ * @count: number of runes in the range
+ * @len: pointer that receives the size of the range, may be NULL
+ *
+ * The range is cut short at the end of @str. See utfseek() for how runes are
+ * counted.
+ *
+ * Return: Pointer to the first rune of the range within @str.
+ */
+char *utfsubstr(const char *str, size_t n, size_t start, size_t count,
+                size_t *len);
+
 /**
  * utfrune() - get the first occurrence of a rune in a utf-8 string
  * @str: pointer to the null-terminated string
@@ -194,6 +343,46 @@ char *utfrrune(const char *str, Rune rune);
  */
 char *utfutf(const char *str, const char *substr);
 
+/**
+ * utfnrune() - get the first occurrence of a rune in a fixed-size utf-8 string
+ * @str: pointer to the string
+ * @n: size of the string
+ * @rune: rune to look for
+ *
+ * Like utfrune(), but null bytes don't end @str. The encoded rune can only
+ * match at a rune boundary, so it's searched for with memchr().
+ *
+ * Return: Pointer to the encoded rune in @str, or NULL.
+ */
+char *utfnrune(const char *str, size_t n, Rune rune);
+
+/**
+ * utfnrrune() - get the last occurrence of a rune in a fixed-size utf-8 string
+ * @str: pointer to the string
+ * @n: size of the string
+ * @rune: rune to look for
+ *
+ * Like utfrrune(), but null bytes don't end @str. The search starts at the
+ * end of @str, unless @rune is Runeerror.
+ *
+ * Return: Pointer to the encoded rune in @str, or NULL.
+ */
+char *utfnrrune(const char *str, size_t n, Rune rune);
+
+/**
+ * utfnutf() - get the first occurrence of a utf-8 string in a utf-8 string
+ * @str: pointer to the string to examine
+ * @n: size of @str
+ * @substr: pointer to the string to look for
+ * @m: size of @substr
+ *
+ * Like utfutf(), but null bytes don't end either string. Matches only start
+ * at rune boundaries of @str.
+ *
+ * Return: Pointer to the found substring in @str, or NULL.
+ */
+char *utfnutf(const char *str, size_t n, const char *substr, size_t m);
+
 /**
  * utfvalid() - check if a utf-8 string is free of invalid encodings
  * @str: pointer to the null-terminated string
@@ -203,6 +392,259 @@ char *utfutf(const char *str, const char *substr);
  */
 #define utfvalid(str) (!utfrune((str), Runeerror))
 
+/* a set of runes for utfrunes(), utfspan() and utfcspan() */
+struct runeset {
+	unsigned char lo[16];    /* buckets by low nibble of the first bytes */
+	unsigned char hi[16];    /* buckets by high nibble of the first bytes */
+	unsigned char first[32]; /* bitmap of the first bytes */
+	int invalid;             /* whether Runeerror matches invalid encodings */
+	Rune *runes;             /* sorted runes >= Runeself */
+	size_t len;              /* number of runes */
+};
+
+/* state of utfsplitnext(), set the options after initializing it */
+struct utfsplit {
+	const char *str;           /* rest of the string */
+	size_t n;                  /* size of the rest */
+	const char *sep;           /* separating string, or NULL */
+	size_t seplen;             /* size of the separating string or rune */
+	char rune[UTFmax];         /* separating rune */
+	const struct runeset *set; /* separating runes, or NULL */
+	size_t limit;              /* option: max number of splits, 0 for none */
+	int collapse;              /* option: skip empty fields */
+	size_t splits;             /* number of splits so far */
+	int done;                  /* whether the last field was returned */
+};
+
+/**
+ * runesetinit() - prepare a set of runes for searching
+ * @set: pointer to the set
+ * @runes: pointer to the runes, may contain duplicates
+ * @n: number of runes
+ *
+ * Invalid runes are ignored. If Runeerror is part of the set, invalid
+ * encodings match it, like with utfrune().
+ *
+ * Return: When successful 0, otherwise -1 if malloc() failed. Call
+ *	runesetfree() when you no longer need @set.
+ */
+int runesetinit(struct runeset *set, const Rune *runes, size_t n);
+
+/**
+ * runesetfree() - free the memory of a set of runes
+ * @set: pointer to the set
+ */
+void runesetfree(struct runeset *set);
+
+/**
+ * utfrunes() - get the first occurrence of any rune of a set in a utf-8 string
+ * @str: pointer to the string
+ * @n: size of the string
+ * @set: pointer to the set
+ *
+ * Bytes no rune in @set can start with are skipped without decoding, 16 at a
+ * time where SSSE3 is available.
+ *
+ * Return: Pointer to the encoded rune in @str, or NULL.
+ */
+char *utfrunes(const char *str, size_t n, const struct runeset *set);
+
+/**
+ * utfspan() - get the size of the prefix of runes in a set
+ * @str: pointer to the string
+ * @n: size of the string
+ * @set: pointer to the set
+ *
+ * Return: Number of bytes at the start of @str made up of runes in @set.
+ */
+size_t utfspan(const char *str, size_t n, const struct runeset *set);
+
+/**
+ * utfcspan() - get the size of the prefix of runes not in a set
+ * @str: pointer to the string
+ * @n: size of the string
+ * @set: pointer to the set
+ *
+ * Same as utfrunes(), but returns an offset.
+ *
+ * Return: Number of bytes at the start of @str made up of runes not in @set.
+ */
+size_t utfcspan(const char *str, size_t n, const struct runeset *set);
+
+/**
+ * utfsplitinit() - split a utf-8 string at a utf-8 string
+ * @sp: pointer to the state
+ * @str: pointer to the string
+ * @n: size of the string
+ * @sep: pointer to the separating string, has to stay valid
+ * @m: size of the separating string, if 0 @str isn't split
+ *
+ * Separators are only found at rune boundaries, see utfnutf(). Set
+ * `@sp->limit` or `@sp->collapse` afterwards to change how @str gets split.
+ */
+void utfsplitinit(struct utfsplit *sp, const char *str, size_t n,
+                  const char *sep, size_t m);
+
+/**
+ * utfsplitrune() - split a utf-8 string at a rune
+ * @sp: pointer to the state
+ * @str: pointer to the string
+ * @n: size of the string
+ * @sep: separating rune
+ *
+ * Same as utfsplitinit() with @sep encoded.
+ */
+void utfsplitrune(struct utfsplit *sp, const char *str, size_t n, Rune sep);
+
+/**
+ * utfsplitset() - split a utf-8 string at any rune of a set
+ * @sp: pointer to the state
+ * @str: pointer to the string
+ * @n: size of the string
+ * @set: pointer to the separating runes, has to stay valid
+ *
+ * Same as utfsplitinit(), but separators are searched with utfcspan().
+ */
+void utfsplitset(struct utfsplit *sp, const char *str, size_t n,
+                 const struct runeset *set);
+
+/**
+ * utfsplitnext() - get the next field of a split utf-8 string
+ * @sp: pointer to the state
+ * @field: pointer that receives a pointer to the field within the string
+ * @len: pointer that receives the size of the field
+ *
+ * Like strsep(), but nothing is copied or written. There is one more field
+ * than separators, so an empty string has one empty field. If
+ * `@sp->collapse` is set, empty fields are skipped instead. Once
+ * `@sp->limit` separators were split at, the rest of the string is returned
+ * as the last field.
+ *
+ * Return: When a field was returned 1, otherwise 0.
+ */
+int utfsplitnext(struct utfsplit *sp, const char **field, size_t *len);
+
+/**
+ * utfnvalid() - check if a fixed-size utf-8 string is free of invalid encodings
+ * @str: pointer to the string
+ * @n: size of the string
+ * @runes: pointer that receives the number of runes in @str, may be NULL
+ *
+ * Unlike utfvalid(), a literal U+FFFD is valid and null bytes don't end
+ * @str. Invalid encodings count as 1 rune per byte, like charntorune() reads
+ * them.
+ *
+ * Return: When there is no invalid encoding in @str 1, otherwise 0.
+ */
+int utfnvalid(const char *str, size_t n, size_t *runes);
+
+/**
+ * utfrevalid() - revalidate a valid utf-8 string after a part of it changed
+ * @str: pointer to the string
+ * @n: size of the string
+ * @off: offset of the changed bytes
+ * @len: number of changed bytes
+ * @runes: pointer that receives the number of runes in the checked window,
+ *	may be NULL
+ *
+ * If @str was valid before bytes got replaced by the @len bytes at @off, only
+ * the rune boundaries around those need to be checked. The window gets
+ * extended to the boundaries by looking at the unchanged bytes around it only,
+ * so calling this on the string before the change, with the offset and size
+ * of the replaced bytes, checks the same window around them. The difference
+ * of the two @runes is how the string's length in runes changed.
+ *
+ * Return: When @str is valid again 1, otherwise 0.
+ */
+int utfrevalid(const char *str, size_t n, size_t off, size_t len,
+               size_t *runes);
+
+/**
+ * utf16valid() - check if a fixed-size utf-16 string is free of invalid
+ *	encodings
+ * @str: pointer to the string
+ * @n: size of the string
+ * @err: pointer that receives the index of the first invalid char16_t, or @n,
+ *	may be NULL
+ *
+ * Only unpaired surrogates are invalid in utf-16, a high surrogate at the end
+ * of @str is one as well. The check goes through 8 char16_t at a time.
+ *
+ * Return: When there is no invalid encoding in @str 1, otherwise 0.
+ */
+int utf16valid(const char16_t *str, size_t n, size_t *err);
+
+/**
+ * utf16levalid() - check if a fixed-size little-endian utf-16 string is free
+ *	of invalid encodings
+ * @str: pointer to the string
+ * @n: size of the string
+ * @err: pointer that receives the index of the first invalid char16_t, or @n,
+ *	may be NULL
+ *
+ * Same as utf16valid().
+ *
+ * Return: When there is no invalid encoding in @str 1, otherwise 0.
+ */
+#define utf16levalid(str, n, err) utf16xevalid((str), (n), 0, (err))
+
+/**
+ * utf16bevalid() - check if a fixed-size big-endian utf-16 string is free of
+ *	invalid encodings
+ * @str: pointer to the string
+ * @n: size of the string
+ * @err: pointer that receives the index of the first invalid char16_t, or @n,
+ *	may be NULL
+ *
+ * Same as utf16valid().
+ *
+ * Return: When there is no invalid encoding in @str 1, otherwise 0.
+ */
+#define utf16bevalid(str, n, err) utf16xevalid((str), (n), 1, (err))
+
+/**
+ * utf32valid() - check if a fixed-size utf-32 string is free of invalid
+ *	encodings
+ * @str: pointer to the string
+ * @n: size of the string
+ * @err: pointer that receives the index of the first invalid char32_t, or @n,
+ *	may be NULL
+ *
+ * A char32_t is invalid if validrune() says so. The check goes through 4
+ * char32_t at a time.
+ *
+ * Return: When there is no invalid encoding in @str 1, otherwise 0.
+ */
+int utf32valid(const char32_t *str, size_t n, size_t *err);
+
+/**
+ * utf32levalid() - check if a fixed-size little-endian utf-32 string is free
+ *	of invalid encodings
+ * @str: pointer to the string
+ * @n: size of the string
+ * @err: pointer that receives the index of the first invalid char32_t, or @n,
+ *	may be NULL
+ *
+ * Same as utf32valid().
+ *
+ * Return: When there is no invalid encoding in @str 1, otherwise 0.
+ */
+#define utf32levalid(str, n, err) utf32xevalid((str), (n), 0, (err))
+
+/**
+ * utf32bevalid() - check if a fixed-size big-endian utf-32 string is free of
+ *	invalid encodings
+ * @str: pointer to the string
+ * @n: size of the string
+ * @err: pointer that receives the index of the first invalid char32_t, or @n,
+ *	may be NULL
+ *
+ * Same as utf32valid().
+ *
+ * Return: When there is no invalid encoding in @str 1, otherwise 0.
+ */
+#define utf32bevalid(str, n, err) utf32xevalid((str), (n), 1, (err))
+
 /**
  * runetochar16() - write a rune to a char16_t-buffer
  * @buf: pointer to the buffer >= 2 in size
@@ -384,7 +826,13 @@ int wcharntorune(Rune *rune, const wchar_t *str, size_t n);
  * The pointers should match the types, so if @rettype is UTFCONV_UTF32 @retv
  * should be a pointer to `char32_t *`. If @strtype is UTFCONV_UTF8 @strv should
  * be a `char *`. UTFCONV_WCHAR uses `wchar_t *` and results in either utf-16 or
- * utf-32, depending on `sizeof(wchar_t)`.
+ * utf-32, depending on `sizeof(wchar_t)`. UTFCONV_AUTO needs utfnconv().
+ *
+ * The utf-8 variants use `char *`. UTFCONV_CESU8 and UTFCONV_MUTF8 write runes
+ * above U+FFFF as two 3-byte surrogates, UTFCONV_MUTF8 writes U+0000 as
+ * 0xc0 0x80. UTFCONV_MUTF8 and UTFCONV_WTF8 hold lone surrogates, which are
+ * kept between them and utf-16 or wchar_t as utf-16. Everywhere else lone
+ * surrogates are invalid encodings.
  *
  * Return: When successful the number of code units @retv contains, otherwise -1
  *	with `*@retv == NULL` if malloc() failed. You have to free() *@retv,
@@ -393,4 +841,829 @@ int wcharntorune(Rune *rune, const wchar_t *str, size_t n);
 int utfconv(void *retv, enum utfconv_type rettype, const void *strv,
             enum utfconv_type strtype);
 
+/* how utfconvopts() treats invalid encodings */
+struct utfconv_opts {
+	Rune replacement; /* rune written in their place */
+	int strict;       /* fail instead of replacing them */
+};
+
+/**
+ * utfconvopts() - convert a string to another utf encoding with options
+ * @retv: pointer receiving a pointer to the new string
+ * @rettype: encoding the new string should be created in
+ * @strv: pointer to the null-terminated source string
+ * @strtype: encoding the source string is in
+ * @opts: how to treat invalid encodings, or NULL for replacing them by U+FFFD
+ *
+ * Same as utfconv(), but independent of Runeerror and thus safe to use with
+ * different replacements from several threads. A literal U+FFFD in @strv is
+ * not considered invalid. The default of replacing by U+FFFD is the fastest.
+ *
+ * Return: When successful the number of code units @retv contains, otherwise -1
+ *	with `*@retv == NULL` if malloc() failed or @opts is strict and @strv
+ *	contains an invalid encoding. -1 is also returned for an invalid
+ *	replacement rune. You have to free() *@retv, when you no longer need it.
+ */
+int utfconvopts(void *retv, enum utfconv_type rettype, const void *strv,
+                enum utfconv_type strtype, const struct utfconv_opts *opts);
+
+/**
+ * utfnconv() - convert a string of known size to another utf encoding
+ * @retv: pointer receiving a pointer to the new string
+ * @rettype: encoding the new string should be created in
+ * @strv: pointer to the source string
+ * @n: size of @strv in bytes
+ * @strtype: encoding the source string is in, or UTFCONV_AUTO
+ * @opts: how to treat invalid encodings, or NULL for replacing them by U+FFFD
+ *
+ * Same as utfconvopts(), but @strv may contain null characters and needs no
+ * terminator, the new string is still null-terminated. A trailing partial
+ * code unit counts as an invalid encoding. With UTFCONV_AUTO the encoding is
+ * taken from utfdetect() and a byte order mark is skipped.
+ *
+ * Return: When successful the number of code units @retv contains, otherwise -1
+ *	as for utfconvopts().
+ */
+int utfnconv(void *retv, enum utfconv_type rettype, const void *strv,
+             size_t n, enum utfconv_type strtype,
+             const struct utfconv_opts *opts);
+
+/**
+ * utfdetect() - detect the encoding of a buffer
+ * @buf: pointer to the buffer
+ * @n: size of @buf in bytes
+ * @bomlen: pointer receiving the size of the byte order mark, may be NULL
+ *
+ * A byte order mark decides the encoding. Without one, at most the first 4096
+ * bytes are examined: null bytes in the same position of every code unit
+ * suggest utf-16 or utf-32 with that byte order, text that isn't valid utf-8
+ * but valid utf-16 is taken as utf-16 as well.
+ *
+ * Return: UTFCONV_UTF8, UTFCONV_UTF16LE, UTFCONV_UTF16BE, UTFCONV_UTF32LE or
+ *	UTFCONV_UTF32BE, utf-8 when in doubt.
+ */
+enum utfconv_type utfdetect(const void *buf, size_t n, size_t *bomlen);
+
+/**
+ * utfconvcmp() - compare two strings in any utf encodings
+ * @a: pointer to the first string
+ * @alen: size of @a in bytes
+ * @atype: encoding of @a, or UTFCONV_AUTO
+ * @b: pointer to the second string
+ * @blen: size of @b in bytes
+ * @btype: encoding of @b, or UTFCONV_AUTO
+ *
+ * The strings are compared rune by rune in code point order, without
+ * converting them, so utf-16 surrogates sort after U+E000 to U+FFFF like in
+ * utf-8. Invalid encodings compare as U+FFFD, the same as after utfnconv()
+ * with the default options. Common ascii of two utf-8 strings is skipped 8
+ * bytes at a time.
+ *
+ * Return: An integer less than, equal to or greater than 0 if @a is found to
+ *	be less than, to match or to be greater than @b.
+ */
+int utfconvcmp(const void *a, size_t alen, enum utfconv_type atype,
+               const void *b, size_t blen, enum utfconv_type btype);
+
+/* state of a hash over the runes of a string in pieces */
+struct utfhash {
+	uint64_t h;             /* hash of the pairs of runes so far */
+	uint64_t runes;         /* number of runes so far */
+	Rune pend;              /* rune waiting for a second one */
+	enum utfconv_type type; /* encoding of the pieces */
+	union {
+		char c[UTFCONVmax];
+		char32_t align;
+	} carry;                /* start of a rune split between pieces */
+	size_t carried;         /* size of @carry */
+};
+
+/**
+ * utfhashinit() - start hashing a string in pieces
+ * @st: pointer to the state
+ * @type: encoding of the string, or UTFCONV_AUTO for detecting it in the
+ *	first piece
+ * @seed: value the hash depends on
+ */
+void utfhashinit(struct utfhash *st, enum utfconv_type type, uint64_t seed);
+
+/**
+ * utfhashupdate() - hash the next piece of a string
+ * @st: pointer to the state
+ * @buf: pointer to the piece, which needs no alignment
+ * @n: size of the piece in bytes
+ *
+ * Pieces may end within a rune.
+ */
+void utfhashupdate(struct utfhash *st, const void *buf, size_t n);
+
+/**
+ * utfhashfinal() - get the hash of all pieces
+ * @st: pointer to the state
+ *
+ * Return: The same as utfhash() of the whole string.
+ */
+uint64_t utfhashfinal(struct utfhash *st);
+
+/**
+ * utfhash() - hash the runes of a string in any utf encoding
+ * @str: pointer to the string
+ * @n: size of the string in bytes
+ * @type: encoding of the string, or UTFCONV_AUTO
+ * @seed: value the hash depends on
+ *
+ * The hash is a 64-bit one over the code points, so it's the same for the
+ * same runes in any encoding. Strings utfconvcmp() finds equal hash equally,
+ * as invalid encodings are hashed as U+FFFD. Ascii in utf-8 and runs of the
+ * BMP in utf-16 skip decoding. It's fast, but not meant to resist attacks.
+ *
+ * Return: The hash.
+ */
+uint64_t utfhash(const void *str, size_t n, enum utfconv_type type,
+                 uint64_t seed);
+
+/**
+ * utfescape() - validate and escape a utf-8 string for json or xml
+ * @str: pointer to the string
+ * @n: size of the string
+ * @type: format to escape for
+ * @opts: how to treat invalid encodings, or NULL for replacing them by U+FFFD
+ * @len: pointer receiving the size of the result, can be NULL
+ *
+ * For json, `"` and `\` get a backslash, control characters become `\n` and
+ * the like or `\u00XX`. UTFESCAPE_JSON_ASCII writes runes above ascii as
+ * `\uXXXX`, with surrogate pairs above U+FFFF. For xml, `&`, `<`, `>`, `"`
+ * and `'` become entities. Control characters other than tab, line feed and
+ * carriage return, U+FFFE and U+FFFF can't be written in xml and are treated
+ * like invalid encodings. The surrounding quotes aren't added.
+ *
+ * Runs of bytes needing no escapes are found 16 or 8 bytes at a time and
+ * copied in one go. If nothing needs escaping, @str itself is returned
+ * without copying anything.
+ *
+ * Return: Either @str or a pointer to the new null-terminated string, which
+ *	you have to free() when you no longer need it. NULL if malloc() failed,
+ *	@opts is strict and @str contains an invalid encoding or the
+ *	replacement can't be written.
+ */
+char *utfescape(const char *str, size_t n, enum utfescape_type type,
+                const struct utfconv_opts *opts, size_t *len);
+
+/**
+ * utfunescape() - unescape json or percent-encoding and validate the utf-8
+ * @dest: buffer receiving the result, may be @str
+ * @size: capacity of @dest
+ * @str: pointer to the string
+ * @n: size of the string
+ * @type: format to unescape
+ * @opts: how to treat invalid encodings, or NULL for replacing them by U+FFFD
+ * @len: pointer receiving the size of the result, can be NULL
+ *
+ * For json, backslash escapes are replaced by their runes, pairs of `\uXXXX`
+ * surrogates by the runes above U+FFFF. For percent-encoding, `%XX` is
+ * replaced by its byte, and the bytes have to make up valid utf-8 together
+ * with the ones around. Malformed escapes, lone surrogates and invalid
+ * encodings of the result are treated as given by @opts. Nothing else is
+ * checked, the surrounding quotes aren't expected. The result isn't
+ * null-terminated.
+ *
+ * Runs without backslashes or percent signs are skipped 16 or 8 bytes at a
+ * time. The result is never longer than @str unless replacements are longer
+ * than what they replace, so @size of @n is enough for strict @opts.
+ *
+ * Return: When successful 0, otherwise -1 if @opts is strict and @str
+ *	contains something invalid, the result doesn't fit in @size bytes or,
+ *	in place, a replacement would overwrite what's not read yet.
+ */
+int utfunescape(char *dest, size_t size, const char *str, size_t n,
+                enum utfunescape_type type, const struct utfconv_opts *opts,
+                size_t *len);
+
+/* counters of the calling thread, collected when built with UTF_STATS */
+struct utfstats {
+	uint64_t units;     /* code units decoded */
+	uint64_t runes;     /* runes decoded */
+	uint64_t ascii;     /* runes decoded that are ascii */
+	uint64_t replaced;  /* invalid encodings replaced */
+	uint64_t allocated; /* bytes allocated for returned strings */
+	/* utfconv(), utfconvopts() and utfnconv() calls by the types */
+	uint64_t conv[UTFCONV_AUTO][UTFCONV_AUTO];
+};
+
+/**
+ * utfstats() - get the counters of the calling thread
+ * @stats: pointer that receives the counters, may be NULL
+ * @reset: whether to set the counters back to 0
+ *
+ * Each function adds its counts once per call, not per rune. Functions on
+ * strings add the code units they looked at, searches up to the match, and
+ * the runes where they decode them. The rune by rune functions, like
+ * chartorune(), runecategory(), utfgetrune() and utfputrune(), add nothing
+ * to stay cheap, while utfgetline(), the splitting and utftranscode() count
+ * through the searches and conversions they make. The counters are only
+ * collected if the library is built with UTF_STATS (`make STATS=1`),
+ * otherwise @stats is zeroed.
+ *
+ * Return: When the library collects counters 1, otherwise 0.
+ */
+int utfstats(struct utfstats *stats, int reset);
+
+/* buffered reading of utf-8 from a file descriptor or stream */
+struct utfreader {
+	int fd;      /* file descriptor read from, or -1 */
+	FILE *fp;    /* stream read from if @fd is -1 */
+	char *buf;   /* buffered bytes */
+	size_t size; /* capacity of @buf */
+	size_t pos;  /* offset of the next unread byte */
+	size_t end;  /* offset after the buffered bytes */
+	size_t last; /* size of the rune utfungetrune() can push back */
+	int eof;     /* whether the end of the file was reached */
+	int err;     /* whether reading failed */
+};
+
+/**
+ * utfreaderfd() - prepare buffered reading from a file descriptor
+ * @rd: pointer to the reader
+ * @fd: file descriptor to read from
+ *
+ * Return: When successful 0, otherwise -1 if malloc() failed.
+ */
+int utfreaderfd(struct utfreader *rd, int fd);
+
+/**
+ * utfreaderfile() - prepare buffered reading from a stream
+ * @rd: pointer to the reader
+ * @fp: stream to read from
+ *
+ * Return: When successful 0, otherwise -1 if malloc() failed.
+ */
+int utfreaderfile(struct utfreader *rd, FILE *fp);
+
+/**
+ * utfreaderfree() - free the buffer of a reader
+ * @rd: pointer to the reader
+ *
+ * The file descriptor or stream is left open.
+ */
+void utfreaderfree(struct utfreader *rd);
+
+/**
+ * utfgetrune() - read the next rune
+ * @rd: pointer to the reader
+ * @rune: pointer to the rune
+ *
+ * Sequences split between two reads are decoded as a whole, only one cut off
+ * by the end of the file is invalid and gives Runeerror. Reading stops as soon
+ * as a rune is complete, so pipes and terminals don't block on the next one.
+ *
+ * Return: The number of bytes read, 0 at the end of the file or -1 if reading
+ *	failed.
+ */
+int utfgetrune(struct utfreader *rd, Rune *rune);
+
+/**
+ * utfungetrune() - push back the rune read last
+ * @rd: pointer to the reader
+ *
+ * Only the rune of the last utfgetrune() call can be pushed back, once.
+ *
+ * Return: When successful 0, otherwise -1.
+ */
+int utfungetrune(struct utfreader *rd);
+
+/**
+ * utfgetline() - read up to and including a delimiting rune
+ * @rd: pointer to the reader
+ * @delim: rune ending the line, like '\n'
+ * @len: pointer that receives the size of the line
+ *
+ * The buffer grows for lines longer than it. The last line need not end with
+ * @delim.
+ *
+ * Return: A pointer to the line within the buffer, which is valid until the
+ *	next call on @rd, or NULL at the end of the file or if reading or
+ *	malloc() failed. The line isn't null-terminated.
+ */
+char *utfgetline(struct utfreader *rd, Rune delim, size_t *len);
+
+/**
+ * utfreaderpeek() - get the buffered bytes without reading them
+ * @rd: pointer to the reader
+ * @min: number of bytes to buffer at least, unless the file ends before
+ * @len: pointer that receives the number of buffered bytes
+ *
+ * Lets bulk consumers work on the buffer directly, utfreaderskip() marks the
+ * bytes they used as read.
+ *
+ * Return: A pointer to the buffered bytes, which is valid until the next call
+ *	on @rd, or NULL if reading or malloc() failed.
+ */
+char *utfreaderpeek(struct utfreader *rd, size_t min, size_t *len);
+
+/**
+ * utfreaderskip() - mark buffered bytes as read
+ * @rd: pointer to the reader
+ * @n: number of bytes, at most the ones utfreaderpeek() returned
+ */
+void utfreaderskip(struct utfreader *rd, size_t n);
+
+/* buffered writing of runes to a file descriptor or stream */
+struct utfwriter {
+	int fd;                 /* file descriptor written to, or -1 */
+	FILE *fp;               /* stream written to if @fd is -1 */
+	enum utfconv_type type; /* encoding written */
+	char *buf;              /* bytes not written yet */
+	size_t size;            /* capacity of @buf */
+	size_t len;             /* number of bytes in @buf */
+	int err;                /* whether writing failed */
+};
+
+/**
+ * utfwriterfd() - prepare buffered writing to a file descriptor
+ * @wr: pointer to the writer
+ * @fd: file descriptor to write to
+ * @type: encoding to write runes in, UTFCONV_AUTO isn't one
+ *
+ * Return: When successful 0, otherwise -1 if malloc() failed or @type is
+ *	invalid.
+ */
+int utfwriterfd(struct utfwriter *wr, int fd, enum utfconv_type type);
+
+/**
+ * utfwriterfile() - prepare buffered writing to a stream
+ * @wr: pointer to the writer
+ * @fp: stream to write to
+ * @type: encoding to write runes in, UTFCONV_AUTO isn't one
+ *
+ * Return: When successful 0, otherwise -1 if malloc() failed or @type is
+ *	invalid.
+ */
+int utfwriterfile(struct utfwriter *wr, FILE *fp, enum utfconv_type type);
+
+/**
+ * utfwriterfree() - flush and free the buffer of a writer
+ * @wr: pointer to the writer
+ *
+ * The file descriptor or stream is left open, a stream isn't flushed.
+ *
+ * Return: When the buffer got written 0, otherwise -1.
+ */
+int utfwriterfree(struct utfwriter *wr);
+
+/**
+ * utfflush() - write the buffered bytes
+ * @wr: pointer to the writer
+ *
+ * Once writing failed, this keeps failing.
+ *
+ * Return: When successful 0, otherwise -1.
+ */
+int utfflush(struct utfwriter *wr);
+
+/**
+ * utfputrune() - write a rune
+ * @wr: pointer to the writer
+ * @rune: rune to write, invalid ones are written as Runeerror
+ *
+ * Lone surrogates are only written by UTFCONV_MUTF8 and UTFCONV_WTF8.
+ *
+ * Return: The number of bytes buffered, or -1 if flushing failed.
+ */
+int utfputrune(struct utfwriter *wr, Rune rune);
+
+/**
+ * utfputrunes() - write an array of runes
+ * @wr: pointer to the writer
+ * @runes: pointer to the runes, invalid ones are written as Runeerror
+ * @n: number of runes
+ *
+ * Return: When successful 0, otherwise -1 if flushing failed.
+ */
+int utfputrunes(struct utfwriter *wr, const Rune *runes, size_t n);
+
+/**
+ * utfwrite() - write bytes that are encoded already
+ * @wr: pointer to the writer
+ * @buf: pointer to the bytes
+ * @n: number of bytes
+ *
+ * Bytes that don't fit into the buffer are written right away, together with
+ * the buffer in one writev() call.
+ *
+ * Return: When successful 0, otherwise -1 if writing failed.
+ */
+int utfwrite(struct utfwriter *wr, const void *buf, size_t n);
+
+/**
+ * utfwriterreserve() - get room at the end of the buffer
+ * @wr: pointer to the writer
+ * @n: number of bytes needed
+ *
+ * Lets callers encode directly into the buffer, utfwritercommit() adds the
+ * bytes they used. The buffer is flushed or grows as needed.
+ *
+ * Return: A pointer to at least @n bytes, which is valid until the next call
+ *	on @wr, or NULL if flushing or malloc() failed.
+ */
+char *utfwriterreserve(struct utfwriter *wr, size_t n);
+
+/**
+ * utfwritercommit() - add bytes written into the buffer
+ * @wr: pointer to the writer
+ * @n: number of bytes, at most the ones utfwriterreserve() returned
+ */
+void utfwritercommit(struct utfwriter *wr, size_t n);
+
+/* how utftranscode() works through a file */
+struct utftranscode_opts {
+	size_t chunk;                    /* bytes read at once, 0 for 1MB */
+	size_t inflight;                 /* chunks in memory, 0 for 2/worker */
+	int workers;                     /* converting threads, 0 for none */
+	const struct utfconv_opts *conv; /* for utfnconv(), may be NULL */
+};
+
+/* what utftranscode() did, each stage's throughput is bytes by seconds */
+struct utftranscode_stats {
+	uint64_t read;     /* bytes read */
+	uint64_t written;  /* bytes written */
+	double read_secs;  /* time spent reading */
+	double conv_secs;  /* time spent converting, summed over the workers */
+	double write_secs; /* time spent writing */
+};
+
+/**
+ * utftranscode() - convert a file to another utf encoding
+ * @out: file descriptor to write to
+ * @rettype: encoding to write
+ * @in: file descriptor to read from
+ * @strtype: encoding to read, or UTFCONV_AUTO
+ * @opts: chunk size, workers and conversion options, or NULL for the defaults
+ * @stats: pointer that receives the counters, may be NULL
+ *
+ * @in is read in chunks that are cut at rune boundaries and converted with
+ * utfnconv(). With workers, the caller reads while the workers convert and
+ * another thread writes the chunks in order, so reading, converting and
+ * writing overlap. Without, each chunk is read, converted and written in
+ * turn. With UTFCONV_AUTO, the first chunk gets passed to utfdetect().
+ *
+ * Return: When successful 0, otherwise -1 if reading, writing, malloc() or
+ *	starting a thread failed, or a strict conversion met an invalid
+ *	encoding. Part of the output may have been written then.
+ */
+int utftranscode(int out, enum utfconv_type rettype, int in,
+                 enum utfconv_type strtype,
+                 const struct utftranscode_opts *opts,
+                 struct utftranscode_stats *stats);
+
+/**
+ * runecasefold() - apply unicode simple case folding to a rune
+ * @rune: rune to be folded
+ *
+ * Runes without a folding, including invalid ones, are returned unchanged.
+ *
+ * Return: The folded rune.
+ */
+Rune runecasefold(Rune rune);
+
+/**
+ * utfcasefold() - case fold a fixed-size utf-8 string into a buffer
+ * @buf: pointer to the buffer receiving the folded string
+ * @size: size of the buffer
+ * @str: pointer to the string
+ * @n: size of the string
+ *
+ * Every rune of @str is folded with runecasefold() and written to @buf, as
+ * long as it fits in whole. Invalid encodings are written as Runeerror. @buf
+ * is not null-terminated, and it may be NULL if @size is 0.
+ *
+ * Return: The number of bytes the complete folded string needs. If this is
+ *	greater than @size, @buf only holds the runes that fit.
+ */
+size_t utfcasefold(char *buf, size_t size, const char *str, size_t n);
+
+/**
+ * utfcasecmp() - compare two utf-8 strings ignoring case
+ * @s1: pointer to the first null-terminated string
+ * @s2: pointer to the second null-terminated string
+ *
+ * Both strings are case folded on the fly with runecasefold() and compared in
+ * code point order, without allocating any memory.
+ *
+ * Return: An integer less than, equal to, or greater than 0 if @s1 is found to
+ *	be less than, to match, or be greater than @s2.
+ */
+int utfcasecmp(const char *s1, const char *s2);
+
+/**
+ * utfncasecmp() - compare the beginning of two utf-8 strings ignoring case
+ * @s1: pointer to the first null-terminated string
+ * @s2: pointer to the second null-terminated string
+ * @n: maximum number of runes to compare
+ *
+ * Like utfcasecmp(), but stops after @n runes.
+ *
+ * Return: An integer less than, equal to, or greater than 0 if @s1 is found to
+ *	be less than, to match, or be greater than @s2.
+ */
+int utfncasecmp(const char *s1, const char *s2, size_t n);
+
+/**
+ * utfcaseutf() - get the first occurrence of a utf-8 string ignoring case
+ * @str: pointer to the null-terminated string to examine
+ * @substr: pointer to the null-terminated string to look for
+ *
+ * Like utfutf(), but runes are compared after runecasefold().
+ *
+ * Return: Pointer to the found substring in @str, or NULL.
+ */
+char *utfcaseutf(const char *str, const char *substr);
+
+/**
+ * utfnormspan() - quick check how much of a utf-8 string is normalized
+ * @str: pointer to the string
+ * @n: size of the string
+ * @form: normalization form to check against
+ *
+ * This only uses the unicode quick check property and the combining classes,
+ * so it never decomposes or composes anything. Malformed sequences end the
+ * normalized prefix, as they would be replaced by Runeerror.
+ *
+ * Return: @n if @str is known to be normalized, otherwise the size of the
+ *	prefix that is, which always ends before a rune that normalization may
+ *	have to change or combine with what follows.
+ */
+size_t utfnormspan(const char *str, size_t n, enum utfnorm_form form);
+
+/**
+ * utfnormalize() - normalize a fixed-size utf-8 string
+ * @str: pointer to the string
+ * @n: size of the string
+ * @form: normalization form to convert to
+ * @len: pointer receiving the size of the result, can be NULL
+ *
+ * If utfnormspan() finds @str to be normalized already, @str itself is returned
+ * without copying anything. Otherwise a new null-terminated string is created,
+ * where only the parts that failed the quick check get decomposed (and
+ * composed again for UTFNORM_NFC and UTFNORM_NFKC). Malformed sequences are
+ * replaced by Runeerror.
+ *
+ * Return: Either @str or a pointer to the normalized string, which you have to
+ *	free() when you no longer need it, or NULL if malloc() failed.
+ */
+char *utfnormalize(const char *str, size_t n, enum utfnorm_form form,
+                   size_t *len);
+
+/**
+ * utfgraphemenext() - return the size of a utf-8 string's first grapheme
+ * @str: pointer to the string
+ * @n: size of the string
+ *
+ * Grapheme cluster boundaries are determined by the extended grapheme cluster
+ * rules of UAX #29. Malformed sequences are treated like Runeerror.
+ *
+ * Return: The number of bytes of the first extended grapheme cluster in @str,
+ *	or 0 if @n is 0.
+ */
+size_t utfgraphemenext(const char *str, size_t n);
+
+/**
+ * utfgraphemelen() - return a utf-8 string's length in grapheme clusters
+ * @str: pointer to the string
+ * @n: size of the string
+ *
+ * Runs of ascii are counted without decoding, since every ascii byte but a CR
+ * followed by LF forms a cluster of its own unless a combining mark follows.
+ *
+ * Return: Length of @str in extended grapheme clusters.
+ */
+size_t utfgraphemelen(const char *str, size_t n);
+
+/**
+ * runewidth() - return the number of terminal columns a rune occupies
+ * @rune: rune to be analyzed
+ *
+ * East asian wide and fullwidth runes as well as emoji with default emoji
+ * presentation take 2 columns, combining marks, format characters and other
+ * default ignorable runes take 0. Unlike wcwidth(), control codes and invalid
+ * runes count as 0 instead of -1, and the result doesn't depend on the locale.
+ *
+ * Return: The width of @rune: 0, 1 or 2.
+ */
+int runewidth(Rune rune);
+
+/**
+ * utfwidth() - return the number of terminal columns a utf-8 string occupies
+ * @str: pointer to the string
+ * @n: size of the string
+ *
+ * Ascii is measured 8 bytes at a time, everything else with runewidth().
+ * Malformed sequences count as Runeerror.
+ *
+ * Return: The width of @str in columns.
+ */
+size_t utfwidth(const char *str, size_t n);
+
+/**
+ * utfwidthtrunc() - return how much of a utf-8 string fits into some columns
+ * @str: pointer to the string
+ * @n: size of the string
+ * @maxcols: number of available columns
+ *
+ * Runes of width 0 following the last rune that fits are included, so
+ * combining marks aren't cut off their base.
+ *
+ * Return: The size in bytes of the longest prefix of @str whose utfwidth() is
+ *	at most @maxcols.
+ */
+size_t utfwidthtrunc(const char *str, size_t n, size_t maxcols);
+
+/**
+ * runecategory() - return the general category of a rune
+ * @rune: rune to be analyzed
+ *
+ * Return: The general category of @rune, RUNECAT_CN for invalid runes.
+ */
+enum runecategory runecategory(Rune rune);
+
+/**
+ * runescript() - return the script of a rune
+ * @rune: rune to be analyzed
+ *
+ * Runes used by several scripts are in "Zyyy" (common), combining marks that
+ * take the script of their base are in "Zinh" (inherited).
+ *
+ * Return: The iso 15924 code of @rune's script as made by RUNESCRIPT(), or
+ *	RUNESCRIPT("Zzzz") for unassigned and invalid runes.
+ */
+uint32_t runescript(Rune rune);
+
+/**
+ * runeisspace() - check if a rune has the unicode White_Space property
+ * @rune: rune to be analyzed
+ *
+ * Return: When @rune is white space 1, otherwise 0.
+ */
+int runeisspace(Rune rune);
+
+/**
+ * runeisalpha() - check if a rune has the unicode Alphabetic property
+ * @rune: rune to be analyzed
+ *
+ * Return: When @rune is alphabetic 1, otherwise 0.
+ */
+int runeisalpha(Rune rune);
+
+/**
+ * runeisupper() - check if a rune has the unicode Uppercase property
+ * @rune: rune to be analyzed
+ *
+ * Return: When @rune is uppercase 1, otherwise 0.
+ */
+int runeisupper(Rune rune);
+
+/**
+ * runeislower() - check if a rune has the unicode Lowercase property
+ * @rune: rune to be analyzed
+ *
+ * Return: When @rune is lowercase 1, otherwise 0.
+ */
+int runeislower(Rune rune);
+
+/**
+ * runeisdigit() - check if a rune is a decimal digit
+ * @rune: rune to be analyzed
+ *
+ * Return: When @rune is in the general category Nd 1, otherwise 0.
+ */
+int runeisdigit(Rune rune);
+
+/*
+ * Definitions of the utf-8 primitives, so they can be inlined into hot loops.
+ * Define UTF_INLINE before including utf.h to have chartorune(),
+ * charntorune(), runetochar(), fullrune() and validrune() (and thus
+ * loop_runes()) use them. The library provides the external functions either
+ * way, (chartorune)(rune, str) still calls those.
+ */
+
+/* return the number of continuation bytes after c, -1 if c can't lead */
+static inline int utf_trail_cnt(unsigned char c)
+{
+	if (c < 0x80)
+		return 0;
+	else if (c < 0xc0)
+		return -1;
+	else if (c < 0xe0)
+		return 1;
+	else if (c < 0xf0)
+		return 2;
+	else if (c < 0xf8)
+		return 3;
+	else if (c < 0xfc)
+		return 4;
+	else if (c < 0xfe)
+		return 5;
+	else
+		return -1;
+}
+
+/* get the max rune for rune with x continuation bytes */
+static inline Rune utf_runex(int x)
+{
+	return x ? ((1u << (6 - x + (x * 6))) - 1) : ((1u << 7) - 1);
+}
+
+static inline int utf_validrune(Rune rune)
+{
+	return rune <= Runemax && (rune & 0xfffff800) != 0xd800;
+}
+
+static inline int utf_fullrune(const char *str, size_t n)
+{
+	int t;
+
+	if (!n)
+		return 0;
+	t = utf_trail_cnt(*str);
+	if (t < 0 || t >= UTFmax)
+		return 1;
+	else
+		return n >= (size_t)t + 1;
+}
+
+/* chartorune() reading @err for invalid encodings */
+static inline int utf_chartorune(Rune *rune, const char *str, Rune err)
+{
+	const unsigned char *s = (const unsigned char *)str;
+	unsigned char tmp = *s++;
+	int i = 0, n = utf_trail_cnt(tmp);
+	Rune c = tmp;
+
+	if (!n) {
+		*rune = c;
+		return 1;
+	}
+	if (n > 0 && n < UTFmax) {
+		c &= (1u << (6 - n)) - 1;
+		for (; i < n && ((tmp = *s++) & 0xc0) == 0x80; i++)
+			c = c << 6 | (tmp & 0x3f);
+	}
+	if (n < 0 || n >= UTFmax || i < n || !utf_validrune(c) ||
+	    c <= utf_runex(n - 1)) {
+		*rune = err;
+		return 1;
+	}
+	*rune = c;
+	return n + 1;
+}
+
+/* charntorune() reading @err for invalid encodings */
+static inline int utf_charntorune(Rune *rune, const char *str, size_t n,
+                                  Rune err)
+{
+	*rune = err;
+	if (!n)
+		return 0;
+	else if (!utf_fullrune(str, n))
+		return 1;
+	else
+		return utf_chartorune(rune, str, err);
+}
+
+static inline int utf_runetochar(char *buf, const Rune *rune)
+{
+	unsigned char *p = (unsigned char *)buf;
+	Rune c = *rune;
+
+	if (!utf_validrune(c))
+		c = Runeerror;
+	if (c < 0x80) {
+		p[0] = c;
+		return 1;
+	} else if (c < 0x800) {
+		p[0] = 0xc0 | c >> 6;
+		p[1] = 0x80 | (c & 0x3f);
+		return 2;
+	} else if (c < 0x10000) {
+		p[0] = 0xe0 | c >> 12;
+		p[1] = 0x80 | (c >> 6 & 0x3f);
+		p[2] = 0x80 | (c & 0x3f);
+		return 3;
+	} else {
+		p[0] = 0xf0 | c >> 18;
+		p[1] = 0x80 | (c >> 12 & 0x3f);
+		p[2] = 0x80 | (c >> 6 & 0x3f);
+		p[3] = 0x80 | (c & 0x3f);
+		return 4;
+	}
+}
+
+#ifdef UTF_INLINE
+#define chartorune(rune, str) utf_chartorune((rune), (str), Runeerror)
+#define charntorune(rune, str, n) \
+	utf_charntorune((rune), (str), (n), Runeerror)
+#define runetochar(buf, rune) utf_runetochar((buf), (rune))
+#define fullrune(str, n) utf_fullrune((str), (n))
+#define validrune(rune) utf_validrune(rune)
+#endif
+
 #endif /* UTF_H */
@@ -0,0 +1,130 @@
+#include <string.h>
+#include "utf.h"
+#include "utfint.h"
+#include "casefold.h"
+
+/* fold a rune that is known to be ascii */
+static inline Rune ascii_fold(Rune c)
+{
+	return (c - 'A' < 26) ? c + ('a' - 'A') : c;
+}
+
+Rune runecasefold(Rune rune)
+{
+	if (rune < Runeself)
+		return ascii_fold(rune);
+	if (rune > Runemax)
+		return rune;
+	return rune + casefold_delta[casefold_lookup(rune)];
+}
+
+size_t utfcasefold(char *buf, size_t size, const char *str, size_t n)
+{
+	size_t len = 0;
+	Rune rune;
+	int w;
+	STAT(size_t units = n; uint64_t runes = 0, ascii = 0);
+
+	while (n) {
+		unsigned char c = *str;
+
+		if (c < Runeself) {
+			if (len < size)
+				buf[len] = ascii_fold(c);
+			len++;
+			str++;
+			n--;
+			STAT(runes++, ascii++);
+			continue;
+		}
+		w = charntorune(&rune, str, n);
+		rune = runecasefold(rune);
+		if (len + runelen(rune) <= size)
+			len += runetochar(buf + len, &rune);
+		else
+			len += runelen(rune);
+		str += w;
+		n -= w;
+		STAT(runes++);
+	}
+	STAT(stats_add(units, runes, ascii, 0, 0));
+	return len;
+}
+
+/* read and fold the next rune of a null-terminated string */
+static inline int nextfold(Rune *rune, const char *str)
+{
+	unsigned char c = *str;
+
+	if (c < Runeself) {
+		*rune = ascii_fold(c);
+		return 1;
+	} else {
+		int w = chartorune(rune, str);
+
+		*rune = runecasefold(*rune);
+		return w;
+	}
+}
+
+int utfncasecmp(const char *s1, const char *s2, size_t n)
+{
+	Rune r1, r2;
+	int cmp = 0;
+	STAT(const char *a = s1, *b = s2; uint64_t runes = 0, ascii = 0);
+
+	for (; n; n--) {
+		unsigned char c1 = *s1, c2 = *s2;
+
+		if ((c1 | c2) < Runeself) {
+			r1 = ascii_fold(c1);
+			r2 = ascii_fold(c2);
+			s1++;
+			s2++;
+		} else {
+			s1 += nextfold(&r1, s1);
+			s2 += nextfold(&r2, s2);
+		}
+		STAT(runes += 2, ascii += (c1 < Runeself) + (c2 < Runeself));
+		if (r1 != r2) {
+			cmp = (r1 < r2) ? -1 : 1;
+			break;
+		}
+		if (!r1)
+			break;
+	}
+	STAT(stats_add((s1 - a) + (s2 - b), runes, ascii, 0, 0));
+	return cmp;
+}
+
+int utfcasecmp(const char *s1, const char *s2)
+{
+	return utfncasecmp(s1, s2, (size_t)-1);
+}
+
+char *utfcaseutf(const char *str, const char *substr)
+{
+	const char *p, *q;
+	Rune first, r1, r2;
+	int w;
+	STAT(const char *start = str; uint64_t runes = 0, ascii = 0);
+
+	w = nextfold(&first, substr);
+	if (!first)
+		return (char *)str;
+	substr += w;
+	for (; *str; str += w) {
+		STAT(runes++, ascii += (unsigned char)*str < Runeself);
+		w = nextfold(&r1, str);
+		if (r1 != first)
+			continue;
+		for (p = str + w, q = substr, r2 = r1; *q && r1 == r2; ) {
+			p += nextfold(&r1, p);
+			q += nextfold(&r2, q);
+		}
+		if (r1 == r2)
+			break;
+	}
+	STAT(stats_add(str - start + (*str ? w : 0), runes, ascii, 0, 0));
+	return *str ? (char *)str : NULL;
+}
@@ -0,0 +1,366 @@
+#ifndef UTFINT_H
+#define UTFINT_H
+
+/* internal helpers shared by the library's translation units */
+
+#include <string.h>
+#include "utf.h"
+
+union utf8 {
+	const char *cp;   /* const pointer */
+	unsigned char *p; /* pointer */
+	char *pc;         /* plain char */
+};
+
+union utf16 {
+	const char16_t *cp; /* const pointer */
+	char16_t *p;        /* pointer */
+	unsigned char *b;   /* byte buffer */
+};
+
+union utf32 {
+	const char32_t *cp; /* const pointer */
+	char32_t *p;        /* pointer */
+	unsigned char *b;   /* byte buffer */
+};
+
+/* return 1 if it's just ascii */
+#define UTF8_IS_ASCII(c) (((unsigned char)(c) & 0x80) != 0x80)
+
+/* return 1 if continuation bytes are introduced */
+static inline int UTF8_IS_LEADING(unsigned char c) { return c >> 7 & c >> 6; }
+
+/* return 1 if it's a continuation byte */
+static inline int UTF8_IS_TRAILING(unsigned char c) { return c >> 7 & ~c >> 6; }
+
+/* return 1 if it's a high surrogate */
+#define UTF16_IS_LEADING(c) (((char16_t)(c) & 0xfc00) == 0xd800)
+
+/* return 1 if it's a low surrogate */
+#define UTF16_IS_TRAILING(c) (((char16_t)(c) & 0xfc00) == 0xdc00)
+
+/* read by the internal decoders for invalid encodings, never a valid rune */
+#define RUNEBAD ((Rune)-1)
+
+#ifdef UTF_STATS
+extern __thread struct utfstats utf_stats;
+
+/* code only compiled in with UTF_STATS */
+#define STAT(...) __VA_ARGS__
+
+/* add the counts of a call to the calling thread's counters */
+static inline void stats_add(uint64_t units, uint64_t runes, uint64_t ascii,
+                             uint64_t replaced, uint64_t allocated)
+{
+	utf_stats.units += units;
+	utf_stats.runes += runes;
+	utf_stats.ascii += ascii;
+	utf_stats.replaced += replaced;
+	utf_stats.allocated += allocated;
+}
+
+/* add the bytes a search looked at, up to the match of len bytes or all n */
+static inline void stats_search(const char *str, size_t n, const char *match,
+                                size_t len)
+{
+	stats_add(match ? (size_t)(match - str) + len : n, 0, 0, 0, 0);
+}
+#else
+#define STAT(...)
+#endif
+
+/* high bit of every byte in a word */
+#define WORD_HIGH_BITS ((uint64_t)0x8080808080808080)
+
+/* low bit of every byte in a word */
+#define WORD_LOW_BITS ((uint64_t)0x0101010101010101)
+
+/* return the number of bytes with their high bit set in a masked word */
+static inline unsigned word_cnt(uint64_t hibits)
+{
+	return (hibits >> 7) * WORD_LOW_BITS >> 56;
+}
+
+/* read 8 bytes at an arbitrary address */
+static inline uint64_t load64(const void *ptr)
+{
+	uint64_t w;
+
+	memcpy(&w, ptr, sizeof(w));
+	return w;
+}
+
+/* return the number of leading ascii bytes, looking at 8 bytes at a time */
+static inline size_t ascii_span(const char *str, size_t n)
+{
+	size_t i = 0;
+
+	for (; i + 8 <= n; i += 8) {
+		if (load64(str + i) & WORD_HIGH_BITS)
+			break;
+	}
+	while (i < n && !((unsigned char)str[i] & 0x80))
+		i++;
+	return i;
+}
+
+/* return the size of a code unit */
+static inline size_t unit_size(enum utfconv_type type)
+{
+	switch (type) {
+	case UTFCONV_UTF8:
+	case UTFCONV_MUTF8:
+	case UTFCONV_CESU8:
+	case UTFCONV_WTF8:
+		return 1;
+	case UTFCONV_UTF16:
+	case UTFCONV_UTF16LE:
+	case UTFCONV_UTF16BE:
+		return sizeof(char16_t);
+	case UTFCONV_WCHAR:
+		return sizeof(wchar_t);
+	default:
+		return sizeof(char32_t);
+	}
+}
+
+/* return 1 if the encoding can hold lone surrogates */
+static inline int holds_lone(enum utfconv_type type)
+{
+	return type == UTFCONV_MUTF8 || type == UTFCONV_WTF8 ||
+	       unit_size(type) == 2;
+}
+
+/* read the utf-16 code unit at s */
+static inline char16_t load16(const char *s, enum utfconv_type type)
+{
+	const unsigned char *u = (const unsigned char *)s;
+	char16_t c;
+
+	if (type == UTFCONV_UTF16LE)
+		return u[1] << 8 | u[0];
+	if (type == UTFCONV_UTF16BE)
+		return u[0] << 8 | u[1];
+	memcpy(&c, s, sizeof(c));
+	return c;
+}
+
+/* read the utf-32 code unit at s */
+static inline char32_t load32(const char *s, enum utfconv_type type)
+{
+	const unsigned char *u = (const unsigned char *)s;
+	char32_t c;
+
+	if (type == UTFCONV_UTF32LE)
+		return (char32_t)u[3] << 24 | (char32_t)u[2] << 16 |
+		       (char32_t)u[1] << 8 | u[0];
+	if (type == UTFCONV_UTF32BE)
+		return (char32_t)u[0] << 24 | (char32_t)u[1] << 16 |
+		       (char32_t)u[2] << 8 | u[3];
+	memcpy(&c, s, sizeof(c));
+	return c;
+}
+
+/* write a utf-16 code unit at s */
+static inline void store16(char *s, char16_t c, enum utfconv_type type)
+{
+	unsigned char *u = (unsigned char *)s;
+
+	if (type == UTFCONV_UTF16LE) {
+		u[0] = c & 0xff;
+		u[1] = c >> 8;
+	} else if (type == UTFCONV_UTF16BE) {
+		u[0] = c >> 8;
+		u[1] = c & 0xff;
+	} else {
+		memcpy(s, &c, sizeof(c));
+	}
+}
+
+/* return 1 if the utf-16 code unit at s is a high surrogate */
+static inline int high_surrogate(const char *s, enum utfconv_type type)
+{
+	return UTF16_IS_LEADING(load16(s, type));
+}
+
+/* return 1 if the 3 bytes at s are a high surrogate in a utf-8 variant */
+static inline int high_surrogate8(const char *s)
+{
+	const unsigned char *u = (const unsigned char *)s;
+
+	return u[0] == 0xed && (u[1] & 0xf0) == 0xa0 && UTF8_IS_TRAILING(u[2]);
+}
+
+/* return the size of the first n bytes without a rune cut off at the end */
+static inline size_t chunk_cut(const char *s, size_t n, enum utfconv_type type)
+{
+	size_t unit = unit_size(type), i;
+	/* cesu-8 and modified utf-8 have no 4-byte sequences, but pairs */
+	int pairs = type == UTFCONV_CESU8 || type == UTFCONV_MUTF8;
+
+	n -= n % unit;
+	if (unit == 1) {
+		for (i = n; i > 0 && n - i < (pairs ? 2u : UTFmax - 1u); i--) {
+			if (!UTF8_IS_TRAILING(s[i - 1]))
+				break;
+		}
+		if (i > 0 && UTF8_IS_LEADING(s[i - 1]) &&
+		    !fullrune(s + i - 1, n - i + 1))
+			n = i - 1;
+		if (pairs && n >= 3 && high_surrogate8(s + n - 3))
+			n -= 3;
+	} else if (unit == 2 && n && high_surrogate(s + n - 2, type)) {
+		return n - 2;
+	}
+	return n;
+}
+
+/* write a surrogate or a rune below U+10000 as up to 3 bytes of utf-8 */
+static inline int enc_bmp(unsigned char *p, Rune c)
+{
+	if (c < 0x80) {
+		p[0] = c;
+		return 1;
+	} else if (c < 0x800) {
+		p[0] = 0xc0 | c >> 6;
+		p[1] = 0x80 | (c & 0x3f);
+		return 2;
+	}
+	p[0] = 0xe0 | c >> 12;
+	p[1] = 0x80 | (c >> 6 & 0x3f);
+	p[2] = 0x80 | (c & 0x3f);
+	return 3;
+}
+
+/* write a rune in a utf-8 variant, keeping surrogates if it holds them */
+static inline int enc_utf8x(char *buf, Rune c, enum utfconv_type type)
+{
+	unsigned char *p = (unsigned char *)buf;
+
+	if (c > Runemax || (!holds_lone(type) && (c & 0xfffff800) == 0xd800))
+		c = Runeerror;
+	if (!c && type == UTFCONV_MUTF8) {
+		p[0] = 0xc0;
+		p[1] = 0x80;
+		return 2;
+	}
+	if (c < 0x10000)
+		return enc_bmp(p, c);
+	if (type == UTFCONV_WTF8)
+		return runetochar(buf, &c);
+	c -= 0x10000;
+	enc_bmp(p, 0xd800 | c >> 10);
+	enc_bmp(p + 3, 0xdc00 | (c & 0x3ff));
+	return 6;
+}
+
+/*
+ * write a rune at dest in any encoding and return the number of bytes, with
+ * lone surrogates kept in utf-16 if @lone
+ */
+static inline int enc_any(char *dest, Rune rune, enum utfconv_type type,
+                          int lone)
+{
+	union {
+		char16_t c16[2];
+		char32_t c32;
+		wchar_t wc[2];
+	} u;
+	int w;
+
+	switch (type) {
+	case UTFCONV_UTF8:
+		return runetochar(dest, &rune);
+	case UTFCONV_MUTF8:
+	case UTFCONV_CESU8:
+	case UTFCONV_WTF8:
+		return enc_utf8x(dest, rune, type);
+	default:
+		break;
+	}
+	if (lone && unit_size(type) == 2 && (rune & 0xfffff800) == 0xd800) {
+		store16(dest, rune, type);
+		return 2;
+	}
+	switch (type) {
+	case UTFCONV_UTF16:
+		w = runetochar16(u.c16, &rune) * sizeof(char16_t);
+		break;
+	case UTFCONV_UTF16LE:
+		w = runetochar16le(u.c16, &rune) * sizeof(char16_t);
+		break;
+	case UTFCONV_UTF16BE:
+		w = runetochar16be(u.c16, &rune) * sizeof(char16_t);
+		break;
+	case UTFCONV_UTF32:
+		w = runetochar32(&u.c32, &rune) * sizeof(char32_t);
+		break;
+	case UTFCONV_UTF32LE:
+		w = runetochar32le(&u.c32, &rune) * sizeof(char32_t);
+		break;
+	case UTFCONV_UTF32BE:
+		w = runetochar32be(&u.c32, &rune) * sizeof(char32_t);
+		break;
+	default:
+		w = runetowchar(u.wc, &rune) * sizeof(wchar_t);
+		break;
+	}
+	/* dest has no alignment for wider code units */
+	memcpy(dest, &u, w);
+	return w;
+}
+
+/* return the last occurrence of c in the n bytes at str, or NULL */
+static inline const char *mem_rchr(const char *str, unsigned char c, size_t n)
+{
+	uint64_t pat = c * WORD_LOW_BITS;
+
+	for (; n >= 8; n -= 8) {
+		uint64_t w = load64(str + n - 8) ^ pat;
+
+		/* a byte is 0 if it matches */
+		if ((w - WORD_LOW_BITS) & ~w & WORD_HIGH_BITS)
+			break;
+	}
+	while (n--) {
+		if ((unsigned char)str[n] == c)
+			return str + n;
+	}
+	return NULL;
+}
+
+/* return the first occurrence of needle in the n bytes at str, or NULL */
+static inline const char *mem_mem(const char *str, size_t n,
+                                  const char *needle, size_t m)
+{
+	const char *end = str + n, *p;
+
+	if (!m)
+		return str;
+	if (m > n)
+		return NULL;
+	for (p = str; (p = memchr(p, *needle, end - p - m + 1)); p++) {
+		if (!memcmp(p + 1, needle + 1, m - 1))
+			return p;
+	}
+	return NULL;
+}
+
+/* return the last occurrence of needle in the n bytes at str, or NULL */
+static inline const char *mem_rmem(const char *str, size_t n,
+                                   const char *needle, size_t m)
+{
+	const char *p;
+
+	if (!m)
+		return str + n;
+	if (m > n)
+		return NULL;
+	for (n -= m - 1; (p = mem_rchr(str, *needle, n)); n = p - str) {
+		if (!memcmp(p + 1, needle + 1, m - 1))
+			return p;
+	}
+	return NULL;
+}
+
+#endif /* UTFINT_H */
@@ -0,0 +1,150 @@
+#include "utf.h"
+#include "utfint.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* return 1 if the host is big-endian */
+static inline int host_be(void)
+{
+	const union {
+		uint16_t u;
+		unsigned char b[2];
+	} e = { 0x0102 };
+
+	return e.b[0] == 1;
+}
+
+static inline char16_t unit16(const char16_t *p, int swap)
+{
+	char16_t c = *p;
+
+	return swap ? (char16_t)(c << 8 | c >> 8) : c;
+}
+
+static inline Rune unit32(const char32_t *p, int swap)
+{
+	Rune c = *p;
+
+	if (swap)
+		c = c << 24 | (c & 0xff00) << 8 | (c >> 8 & 0xff00) | c >> 24;
+	return c;
+}
+
+/* return the index of the first invalid code unit from i before end */
+static size_t scan16(const char16_t *str, size_t i, size_t end, size_t n,
+                     int swap)
+{
+	while (i < end) {
+		char16_t c = unit16(str + i, swap);
+
+		if ((c & 0xf800) != 0xd800) {
+			i++;
+			continue;
+		}
+		/* a pair may reach past end, but not past n */
+		if (!UTF16_IS_LEADING(c) || i + 1 >= n ||
+		    !UTF16_IS_TRAILING(unit16(str + i + 1, swap)))
+			return i;
+		i += 2;
+	}
+	return i;
+}
+
+static int valid16(const char16_t *str, size_t n, int swap, size_t *err)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	/* a byte swapped surrogate has its high bits in the low byte */
+	__m128i mask = _mm_set1_epi16(swap ? 0x00f8 : (short)0xf800);
+	__m128i surr = _mm_set1_epi16(swap ? 0x00d8 : (short)0xd800);
+
+	while (i + 8 <= n) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(str + i));
+		size_t j;
+
+		v = _mm_cmpeq_epi16(_mm_and_si128(v, mask), surr);
+		if (!_mm_movemask_epi8(v)) {
+			i += 8;
+			continue;
+		}
+		/* check the surrogates, a pair may end right after */
+		j = scan16(str, i, i + 8, n, swap);
+		if (j < i + 8)
+			break;
+		i = j;
+	}
+#endif
+	i = scan16(str, i, n, n, swap);
+	STAT(stats_add(i, 0, 0, 0, 0));
+	if (err)
+		*err = i;
+	return i == n;
+}
+
+/* return the index of the first invalid code unit from i before n */
+static size_t scan32(const char32_t *str, size_t i, size_t n, int swap)
+{
+	for (; i < n; i++) {
+		if (!validrune(unit32(str + i, swap)))
+			break;
+	}
+	return i;
+}
+
+static int valid32(const char32_t *str, size_t n, int swap, size_t *err)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	__m128i max = _mm_set1_epi32(Runemax >> 16);
+	__m128i mask = _mm_set1_epi32((int)0xfffff800);
+	__m128i surr = _mm_set1_epi32(0xd800);
+	__m128i lo = _mm_set1_epi32(0xff00);
+
+	for (; i + 4 <= n; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(str + i));
+
+		if (swap)
+			v = _mm_or_si128(
+				_mm_or_si128(_mm_slli_epi32(v, 24),
+				             _mm_srli_epi32(v, 24)),
+				_mm_or_si128(
+					_mm_slli_epi32(_mm_and_si128(v, lo), 8),
+					_mm_and_si128(_mm_srli_epi32(v, 8),
+					              lo)));
+		/* the shifted runes are small enough for a signed compare */
+		v = _mm_or_si128(_mm_cmpgt_epi32(_mm_srli_epi32(v, 16), max),
+		                 _mm_cmpeq_epi32(_mm_and_si128(v, mask), surr));
+		if (_mm_movemask_epi8(v))
+			break;
+	}
+#endif
+	i = scan32(str, i, n, swap);
+	STAT(stats_add(i, i, 0, 0, 0));
+	if (err)
+		*err = i;
+	return i == n;
+}
+
+int utf16valid(const char16_t *str, size_t n, size_t *err)
+{
+	return valid16(str, n, 0, err);
+}
+
+int utf16xevalid(const char16_t *str, size_t n, int be, size_t *err)
+{
+	return valid16(str, n, be != host_be(), err);
+}
+
+int utf32valid(const char32_t *str, size_t n, size_t *err)
+{
+	return valid32(str, n, 0, err);
+}
+
+int utf32xevalid(const char32_t *str, size_t n, int be, size_t *err)
+{
+	return valid32(str, n, be != host_be(), err);
+}
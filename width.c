@@ -0,0 +1,78 @@
+#include "utf.h"
+#include "utfint.h"
+#include "width.h"
+
+int runewidth(Rune rune)
+{
+	if (rune < Runeself)
+		return rune >= 0x20 && rune != 0x7f;
+	if (rune > Runemax)
+		return 0;
+	return width_lookup(rune);
+}
+
+/* return the number of printable bytes in a word of ascii */
+static inline unsigned ascii_width(uint64_t w)
+{
+	uint64_t printable = w + 0x60 * WORD_LOW_BITS; /* >= 0x20 */
+	uint64_t notdel = (w ^ 0x7f * WORD_LOW_BITS) + 0x7f * WORD_LOW_BITS;
+
+	return word_cnt(printable & notdel & WORD_HIGH_BITS);
+}
+
+size_t utfwidth(const char *str, size_t n)
+{
+	size_t cols = 0;
+	Rune rune;
+	int w;
+	STAT(size_t units = n; uint64_t runes = 0, ascii = 0);
+
+	while (n) {
+		for (; n >= 8; str += 8, n -= 8) {
+			uint64_t word = load64(str);
+
+			if (word & WORD_HIGH_BITS)
+				break;
+			cols += ascii_width(word);
+			STAT(runes += 8, ascii += 8);
+		}
+		if (!n)
+			break;
+		w = charntorune(&rune, str, n);
+		cols += runewidth(rune);
+		str += w;
+		n -= w;
+		STAT(runes++, ascii += rune < 0x80);
+	}
+	STAT(stats_add(units, runes, ascii, 0, 0));
+	return cols;
+}
+
+size_t utfwidthtrunc(const char *str, size_t n, size_t maxcols)
+{
+	size_t i = 0, cols = 0;
+	Rune rune;
+	int w;
+	STAT(uint64_t runes = 0, ascii = 0);
+
+	while (i < n) {
+		for (; n - i >= 8 && maxcols - cols >= 8; i += 8) {
+			uint64_t word = load64(str + i);
+
+			if (word & WORD_HIGH_BITS)
+				break;
+			cols += ascii_width(word);
+			STAT(runes += 8, ascii += 8);
+		}
+		if (i == n)
+			break;
+		w = charntorune(&rune, str + i, n - i);
+		if (cols + runewidth(rune) > maxcols)
+			break;
+		cols += runewidth(rune);
+		i += w;
+		STAT(runes++, ascii += rune < 0x80);
+	}
+	STAT(stats_add(i, runes, ascii, 0, 0));
+	return i;
+}
@@ -0,0 +1,166 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "utf.h"
+#include "utfint.h"
+
+/* size of a new buffer, written in one go */
+#define WRITER_SIZE 65536
+
+static int writer_init(struct utfwriter *wr, int fd, FILE *fp,
+                       enum utfconv_type type)
+{
+	memset(wr, 0, sizeof(*wr));
+	if (type >= UTFCONV_AUTO)
+		return -1;
+	wr->fd = fd;
+	wr->fp = fp;
+	wr->type = type;
+	wr->buf = malloc(WRITER_SIZE);
+	if (!wr->buf)
+		return -1;
+	wr->size = WRITER_SIZE;
+	return 0;
+}
+
+int utfwriterfd(struct utfwriter *wr, int fd, enum utfconv_type type)
+{
+	return writer_init(wr, fd, NULL, type);
+}
+
+int utfwriterfile(struct utfwriter *wr, FILE *fp, enum utfconv_type type)
+{
+	return writer_init(wr, -1, fp, type);
+}
+
+int utfwriterfree(struct utfwriter *wr)
+{
+	int retval = utfflush(wr);
+
+	free(wr->buf);
+	wr->buf = NULL;
+	wr->size = wr->len = 0;
+	return retval;
+}
+
+/* write both buffers in full, return -1 on errors */
+static int writer_out(struct utfwriter *wr, const void *data, size_t n)
+{
+	struct iovec iov[2] = {
+		{ .iov_base = wr->buf, .iov_len = wr->len },
+		{ .iov_base = (void *)data, .iov_len = n }
+	};
+	struct iovec *v = iov;
+	/* utfflush() has no data, which may be a null pointer */
+	int cnt = n ? 2 : 1;
+
+	if (wr->err)
+		return -1;
+	if (wr->fd < 0) {
+		if ((wr->len &&
+		     fwrite(wr->buf, 1, wr->len, wr->fp) != wr->len) ||
+		    (n && fwrite(data, 1, n, wr->fp) != n)) {
+			wr->err = 1;
+			return -1;
+		}
+		wr->len = 0;
+		return 0;
+	}
+	while (cnt) {
+		ssize_t r = writev(wr->fd, v, cnt);
+
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r < 0) {
+			wr->err = 1;
+			return -1;
+		}
+		/* skip what got written */
+		for (; cnt && (size_t)r >= v->iov_len; v++, cnt--)
+			r -= v->iov_len;
+		if (cnt) {
+			v->iov_base = (char *)v->iov_base + r;
+			v->iov_len -= r;
+		}
+	}
+	wr->len = 0;
+	return 0;
+}
+
+int utfflush(struct utfwriter *wr)
+{
+	return writer_out(wr, NULL, 0);
+}
+
+int utfputrune(struct utfwriter *wr, Rune rune)
+{
+	int w;
+
+	if (wr->size - wr->len < UTFCONVmax && utfflush(wr))
+		return -1;
+	if (rune < Runeself && wr->type == UTFCONV_UTF8) {
+		wr->buf[wr->len++] = rune;
+		return 1;
+	}
+	w = enc_any(wr->buf + wr->len, rune, wr->type, 0);
+	wr->len += w;
+	return w;
+}
+
+int utfputrunes(struct utfwriter *wr, const Rune *runes, size_t n)
+{
+	size_t i = 0;
+	STAT(uint64_t ascii = 0);
+
+	while (i < n) {
+		/* encode as many as surely fit without checking each */
+		size_t end = i + (wr->size - wr->len) / UTFCONVmax;
+
+		if (end > n)
+			end = n;
+		if (end == i) {
+			if (utfflush(wr))
+				return -1;
+			continue;
+		}
+		for (; i < end; i++) {
+			wr->len += enc_any(wr->buf + wr->len, runes[i],
+			                   wr->type, 0);
+			STAT(ascii += runes[i] < 0x80);
+		}
+	}
+	STAT(stats_add(n, n, ascii, 0, 0));
+	return 0;
+}
+
+int utfwrite(struct utfwriter *wr, const void *buf, size_t n)
+{
+	if (n <= wr->size - wr->len) {
+		memcpy(wr->buf + wr->len, buf, n);
+		wr->len += n;
+		return 0;
+	}
+	/* write large blocks along with the buffer instead of copying them */
+	return writer_out(wr, buf, n);
+}
+
+char *utfwriterreserve(struct utfwriter *wr, size_t n)
+{
+	if (n > wr->size - wr->len && utfflush(wr))
+		return NULL;
+	if (n > wr->size) {
+		char *buf = realloc(wr->buf, n);
+
+		if (!buf)
+			return NULL;
+		wr->buf = buf;
+		wr->size = n;
+	}
+	return wr->buf + wr->len;
+}
+
+void utfwritercommit(struct utfwriter *wr, size_t n)
+{
+	wr->len += n;
+}